@@ -47,7 +47,7 @@ void testFFT() {
     using OutputType    = std::complex<PrecisionType>;
     using FFTAlgo       = Algorithm<T, OutputType>;
 
-    for (std::size_t N : {512UZ, 1024UZ, 8192UZ, 65536UZ, 1009UZ /* prime */}) {
+    for (std::size_t N : {512UZ, 1024UZ, 8192UZ, 65536UZ, 960UZ /* 2^6*3*5 */, 6144UZ /* 2^11*3 */, 1009UZ /* prime */}) {
         constexpr int         nRepetitions{1000};
         constexpr std::size_t binnedFrequency{5UZ};
 
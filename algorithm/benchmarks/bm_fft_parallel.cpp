@@ -0,0 +1,74 @@
+#include <benchmark.hpp>
+
+#include <bit>
+#include <cmath>
+#include <format>
+#include <numbers>
+#include <thread>
+
+#include <gnuradio-4.0/algorithm/fourier/fft.hpp>
+#include <gnuradio-4.0/algorithm/fourier/fft_parallel.hpp>
+
+/**
+ * thread-scaling of the six-step 'FFTParallel' for long transforms vs. the single-threaded native 'FFT'
+ */
+
+template<typename T>
+std::vector<T> generateSignal(std::size_t N) {
+    std::vector<T> signal(N);
+    for (std::size_t i = 0UZ; i < N; ++i) {
+        const double phase = 2. * std::numbers::pi * 1234.5 * static_cast<double>(i) / static_cast<double>(N);
+        if constexpr (gr::meta::complex_like<T>) {
+            signal[i] = T(static_cast<typename T::value_type>(std::cos(phase)), static_cast<typename T::value_type>(std::sin(phase)));
+        } else {
+            signal[i] = static_cast<T>(std::cos(phase));
+        }
+    }
+    return signal;
+}
+
+template<typename T>
+struct ComplexOf {
+    using type = std::complex<T>;
+};
+
+template<gr::meta::complex_like T>
+struct ComplexOf<T> {
+    using type = T;
+};
+
+template<typename T>
+void runScaling(std::size_t N) {
+    using namespace boost::ut;
+    using namespace boost::ut::reflection;
+    using OutputType = typename ComplexOf<T>::type;
+
+    constexpr std::size_t   nRepetitions = 5UZ;
+    const std::size_t       scaling      = static_cast<std::size_t>(static_cast<double>(N) * std::log2(static_cast<double>(N)));
+    const std::vector<T>    signal       = generateSignal<T>(N);
+    std::vector<OutputType> output(N);
+
+    gr::algorithm::FFT<T, OutputType> serialFft;
+    output = serialFft.compute(signal, output); // warm-up: twiddles and plans
+    ::benchmark::benchmark<nRepetitions>(std::format("FFT         - {:20} N = 2^{} single-threaded", type_name<T>(), std::countr_zero(N)), scaling) = [&] { output = serialFft.compute(signal, output); };
+
+    const std::size_t maxThreads = std::max(1UZ, static_cast<std::size_t>(std::thread::hardware_concurrency()));
+    for (std::size_t nThreads = 1UZ; nThreads <= maxThreads; nThreads *= 2UZ) {
+        gr::algorithm::FFTParallel<T, OutputType> parallelFft;
+        parallelFft.nThreads = nThreads;
+        output               = parallelFft.compute(signal, output);
+        ::benchmark::benchmark<nRepetitions>(std::format("FFTParallel - {:20} N = 2^{} nThreads = {:3}", type_name<T>(), std::countr_zero(N), nThreads), scaling) = [&] { output = parallelFft.compute(signal, output); };
+    }
+    ::benchmark::results::add_separator();
+}
+
+inline const boost::ut::suite<"six-step FFT thread scaling"> _fftParallelBenchmarks = [] {
+    for (std::size_t N : {1UZ << 20U, 1UZ << 22U, 1UZ << 24U}) {
+        runScaling<std::complex<float>>(N);
+        runScaling<float>(N);
+    }
+    runScaling<std::complex<double>>(1UZ << 22U);
+    std::println("N.B. ops/s values are scaled with N*log2(N).");
+};
+
+int main() { /* not needed by the UT framework */ }
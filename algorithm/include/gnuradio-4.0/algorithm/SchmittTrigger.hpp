@@ -3,6 +3,10 @@
 
 #include <cmath>
 #include <cstddef>
+#include <limits>
+#include <span>
+
+#include <vir/simd.h>
 
 #include <gnuradio-4.0/HistoryBuffer.hpp>
 #include <gnuradio-4.0/meta/UncertainValue.hpp>
@@ -206,6 +210,70 @@ struct SchmittTrigger {
         return EdgeDetection::NONE;
     }
 
+    /**
+     * @brief fast-forwards over leading samples that cannot produce an edge or change the internal trigger state.
+     *
+     * Since edges are typically rare, most samples are far from the relevant hysteresis threshold. The samples are
+     * tested in SIMD-width chunks against the threshold of the current state (for LINEAR_INTERPOLATION: the start of an
+     * accumulation window) and the scan stops at the first sample that needs the full stateful 'processOne' logic.
+     * The per-sample book-keeping of the skipped samples (history buffer, 'lastEdgeIdx') is applied in bulk, so that
+     * the detected edges and interpolated offsets are identical to calling 'processOne' for every sample.
+     *
+     * @return number of skipped samples, i.e. the caller continues with 'processOne(samples[n])'
+     */
+    std::size_t skipQuietSamples(std::span<const T> samples) noexcept {
+        using enum InterpolationMethod;
+        if (samples.empty() || (Method != NO_INTERPOLATION && _historyBuffer.size() == 0UZ) || (Method == LINEAR_INTERPOLATION && accumulatedSamples > 0UZ)) {
+            return 0UZ; // warm-up or edge candidate being tracked -> per-sample processing
+        }
+
+        // LINEAR_INTERPOLATION: accumulation starts when 'inZone' toggles from false to true between consecutive samples
+        auto inZone = [this](const auto& x) {
+            if constexpr (Method == LINEAR_INTERPOLATION) {
+                return _lastState ? (x < _upperThreshold) : (x > _lowerThreshold);
+            } else { // threshold crossing yields an edge
+                return _lastState ? (x <= _lowerThreshold) : (x >= _upperThreshold);
+            }
+        };
+        bool prevInZone = Method == LINEAR_INTERPOLATION && inZone(gr::value(_historyBuffer[0]));
+
+        std::size_t nSkip = 0UZ;
+        if constexpr (std::is_arithmetic_v<T>) {
+            using V = vir::stdx::native_simd<T>;
+            for (; nSkip + V::size() <= samples.size(); nSkip += V::size()) {
+                const auto mask = inZone(V(&samples[nSkip], vir::stdx::element_aligned));
+                if constexpr (Method == LINEAR_INTERPOLATION) {
+                    if (!(vir::stdx::none_of(mask) || (prevInZone && vir::stdx::all_of(mask)))) {
+                        break;
+                    }
+                    prevInZone = mask[V::size() - 1UZ];
+                } else if (vir::stdx::any_of(mask)) {
+                    break;
+                }
+            }
+        }
+        for (; nSkip < samples.size(); ++nSkip) { // scalar epilogue -- also locates the exact sample within the last SIMD chunk
+            const bool zone = inZone(gr::value(samples[nSkip]));
+            if (zone && (Method != LINEAR_INTERPOLATION || !prevInZone)) {
+                break;
+            }
+            prevInZone = zone;
+        }
+
+        if constexpr (Method != NO_INTERPOLATION) {
+            _historyBuffer.push_front(samples.first(nSkip));
+        }
+        if constexpr (Method != LINEAR_INTERPOLATION) { // equivalent to the per-sample 'lastEdgeIdx' update in 'processOne'
+            if (nSkip > 0UZ && lastEdgeIdx <= 0) {
+                const auto delta = static_cast<std::int64_t>(2UZ * nSkip);
+                lastEdgeIdx      = static_cast<std::int32_t>(std::max<std::int64_t>(std::int64_t{lastEdgeIdx} - delta, std::numeric_limits<std::int32_t>::min()));
+            } else if (nSkip > 0UZ) {
+                lastEdgeIdx = 1;
+            }
+        }
+        return nSkip;
+    }
+
     std::optional<T> findCrossingIndexLinearRegression(const auto& samples, std::size_t nSamples, value_t offset) {
         using comp_t = std::conditional_t<std::is_floating_point_v<value_t>, value_t, float>; // temporary compute type to avoid conversion losses/errors/warnings
         if (nSamples < 2) {                                                                   // not enough samples to perform linear regression
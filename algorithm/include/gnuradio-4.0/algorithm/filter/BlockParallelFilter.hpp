@@ -0,0 +1,189 @@
+#ifndef GNURADIO_ALGORITHM_BLOCKPARALLELFILTER_HPP
+#define GNURADIO_ALGORITHM_BLOCKPARALLELFILTER_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <vir/simd.h>
+
+#include <gnuradio-4.0/algorithm/filter/FilterTool.hpp>
+#include <gnuradio-4.0/algorithm/filter/MultiChannelFilter.hpp>
+
+namespace gr::filter {
+
+enum class Processing {
+    Serial,       /// sample-by-sample recurrence: latency bound by one multiply-add chain per sample
+    BlockParallel /// long chunks are split into independent segments advanced in SIMD lanes and stitched via their states
+};
+
+/**
+ * @brief Single-channel IIR/FIR filter cascade (direct form II, cf. 'Filter<T>') that optionally breaks the serial recurrence
+ * of long chunks into independent, SIMD-parallel segments.
+ *
+ * The cascade is a linear state-space system s[n+1] = A·s[n] + B·x[n] with the state s = (w[n-1], w[n-2], …) of all sections.
+ * For 'Processing::BlockParallel', each chunk of K·L samples (K = 'nSegments()' segments of length L = 'segmentLength()') is
+ * processed in three steps:
+ *   1. zero-state pass: all K segments are filtered simultaneously (one segment per SIMD lane) starting from s = 0,
+ *      yielding the zero-state end-states z_k;
+ *   2. stitching: the true segment start states follow serially from s_{k+1} = Φ·s_k + z_k with the precomputed
+ *      state-transition matrix Φ = A^L (O(K·N²) for a total filter order N);
+ *   3. final pass: all segments are re-filtered in SIMD lanes from their stitched start states.
+ * Remaining samples (< K·L) and 'processOne(..)' use the serial recurrence and share the same state.
+ *
+ * Tolerance: the block-parallel output differs from the serial recurrence only by the rounding of the stitched states, i.e. by
+ * the regular floating-point round-off amplified by the filter's noise gain. For stable, well-conditioned cascades up to order 12
+ * the deviation stays below 1e-4 (float) and 1e-10 (double) relative to the output amplitude (see qa_FilterTool).
+ * Filters with poles very close to the unit circle may require a shorter segment length.
+ *
+ * usage example:
+ * BlockParallelFilter<float> filter(iir::designFilter<float>(Type::LOWPASS, {.order = 8UZ, .fLow = 100., .fs = 10'000.}));
+ * filter.setProcessing(Processing::BlockParallel);
+ * filter.processBlock(input, output); // in-place supported
+ */
+template<typename T>
+class BlockParallelFilter {
+    static_assert(std::is_floating_point_v<T>, "BlockParallelFilter requires a floating-point sample type");
+    static constexpr std::size_t kSegments = 4UZ * vir::stdx::native_simd<T>::size(); // 4 lane groups -> hides the multiply-add latency
+
+    std::vector<FilterCoefficients<T>> _sections{};
+    Processing                         _processing{Processing::Serial};
+    std::size_t                        _segmentLength{64UZ};
+    MultiChannelFilter<T>              _serial{1UZ, FilterCoefficients<T>{.b = {1}, .a = {1}}};
+    MultiChannelFilter<T>              _segments{};
+    std::vector<T>                     _transition{}; // Φ = A^L, [N][N] row-major
+    std::vector<T>                     _states{};     // [K + 1][N] stitched segment start states + scratch
+    std::vector<T>                     _scratch{};    // [K][L] zero-state pass output
+
+public:
+    BlockParallelFilter() = default;
+
+    template<typename... TFilterCoefficients>
+    requires(!std::is_same_v<std::remove_cvref_t<TFilterCoefficients>, BlockParallelFilter> && ...)
+    explicit BlockParallelFilter(TFilterCoefficients&&... filterSections) : _sections{std::forward<TFilterCoefficients>(filterSections)...}, _serial(1UZ, _sections) {}
+
+    [[nodiscard]] constexpr Processing  processing() const noexcept { return _processing; }
+    [[nodiscard]] constexpr std::size_t segmentLength() const noexcept { return _segmentLength; }
+    [[nodiscard]] static constexpr std::size_t nSegments() noexcept { return kSegments; }
+
+    void setProcessing(Processing processing, std::size_t segmentLength = 64UZ) {
+        if (segmentLength == 0UZ) {
+            throw std::invalid_argument("BlockParallelFilter: segment length must be > 0");
+        }
+        _processing    = processing;
+        _segmentLength = segmentLength;
+        if (_processing == Processing::BlockParallel) {
+            initBlockParallel();
+        } else {
+            _segments = MultiChannelFilter<T>();
+            _transition.clear();
+            _states.clear();
+            _scratch.clear();
+        }
+    }
+
+    constexpr void reset(T defaultValue = T()) { _serial.reset(defaultValue); }
+
+    [[nodiscard]] T processOne(T input) noexcept { return _serial.processOne(input); }
+
+    /// filters a contiguous chunk (in-place supported), block-parallel for every complete group of 'nSegments()·segmentLength()' samples
+    void processBlock(std::span<const T> input, std::span<T> output) noexcept {
+        assert(output.size() >= input.size());
+        std::size_t offset = 0UZ;
+        if (_processing == Processing::BlockParallel && !_transition.empty()) {
+            const std::size_t superBlock = kSegments * _segmentLength;
+            for (; offset + superBlock <= input.size(); offset += superBlock) {
+                processSuperBlock(input.subspan(offset, superBlock), output.subspan(offset, superBlock));
+            }
+        }
+        if (offset < input.size()) {
+            _serial.processBlock(input.subspan(offset), output.subspan(offset, input.size() - offset)); // single channel: interleaved == contiguous
+        }
+    }
+
+private:
+    void initBlockParallel() {
+        const std::size_t N = _serial.stateSize();
+        _segments           = MultiChannelFilter<T>(kSegments, _sections);
+        _transition.assign(N * N, T(0));
+        _states.assign((kSegments + 1UZ) * N, T(0));
+        _scratch.assign(kSegments * _segmentLength, T(0));
+        if (N == 0UZ) { // pure gain cascade: no recurrence to break
+            _transition.clear();
+            return;
+        }
+
+        // Φ = A^L: column i is the state reached after L zero-input samples starting from the unit state e_i
+        MultiChannelFilter<T> unitResponses(N, _sections);
+        std::vector<T>        state(N, T(0));
+        for (std::size_t i = 0UZ; i < N; ++i) {
+            state[i] = T(1);
+            unitResponses.setState(i, state);
+            state[i] = T(0);
+        }
+        std::vector<T> frame(N, T(0));
+        for (std::size_t n = 0UZ; n < _segmentLength; ++n) {
+            std::ranges::fill(frame, T(0));
+            unitResponses.processOne(frame, frame);
+        }
+        for (std::size_t i = 0UZ; i < N; ++i) {
+            unitResponses.getState(i, state);
+            for (std::size_t r = 0UZ; r < N; ++r) {
+                _transition[r * N + i] = state[r];
+            }
+        }
+    }
+
+    void processSuperBlock(std::span<const T> input, std::span<T> output) noexcept {
+        const std::size_t N = _serial.stateSize();
+        const std::size_t L = _segmentLength;
+
+        std::array<std::span<const T>, kSegments> in;
+        std::array<std::span<T>, kSegments>       out;
+        for (std::size_t k = 0UZ; k < kSegments; ++k) {
+            in[k]  = input.subspan(k * L, L);
+            out[k] = std::span<T>(_scratch).subspan(k * L, L);
+        }
+
+        // 1. zero-state responses of all segments
+        _segments.reset();
+        _segments.processBlock(in, out);
+
+        // 2. stitch: s_{k+1} = Φ·s_k + z_k
+        const auto stateOf = [this, N](std::size_t k) { return std::span<T>(_states).subspan(k * N, N); };
+        _serial.getState(0UZ, stateOf(0UZ));
+        std::span<T> zeroState = stateOf(kSegments); // scratch row
+        for (std::size_t k = 0UZ; k + 1UZ < kSegments; ++k) {
+            _segments.getState(k, zeroState);
+            const std::span<const T> s     = stateOf(k);
+            const std::span<T>       sNext = stateOf(k + 1UZ);
+            for (std::size_t r = 0UZ; r < N; ++r) {
+                const T* phi = &_transition[r * N];
+                T        acc = zeroState[r];
+                for (std::size_t c = 0UZ; c < N; ++c) {
+                    acc += phi[c] * s[c];
+                }
+                sNext[r] = acc;
+            }
+        }
+
+        // 3. re-filter all segments from their stitched start states
+        for (std::size_t k = 0UZ; k < kSegments; ++k) {
+            _segments.setState(k, stateOf(k));
+            out[k] = output.subspan(k * L, L);
+        }
+        _segments.processBlock(in, out);
+
+        _segments.getState(kSegments - 1UZ, zeroState);
+        _serial.setState(0UZ, zeroState);
+    }
+};
+
+} // namespace gr::filter
+
+#endif // GNURADIO_ALGORITHM_BLOCKPARALLELFILTER_HPP
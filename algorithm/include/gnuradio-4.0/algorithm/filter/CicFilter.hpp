@@ -0,0 +1,297 @@
+#ifndef GNURADIO_ALGORITHM_CICFILTER_HPP
+#define GNURADIO_ALGORITHM_CICFILTER_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <gnuradio-4.0/HistoryBuffer.hpp>
+#include <gnuradio-4.0/algorithm/filter/FilterTool.hpp>
+
+namespace gr::filter::cic {
+
+/**
+ * @brief Cascaded integrator-comb (CIC, Hogenauer) decimation and interpolation engines.
+ *
+ * A CIC of order N, differential delay M and rate R realises H(z) = [(1 - z^{-R·M}) / (1 - z^{-1})]^N, i.e. N cascaded
+ * moving sums of length R·M, without any multiplications and independent of R in cost:
+ *   - integer samples: N integrators at the high and N combs at the low rate. The registers are two's-complement modular
+ *     (std::uint64_t) so that the integrator wrap-around cancels exactly in the combs (Hogenauer) as long as the output
+ *     fits into the register, i.e. for B_in + ⌈log2(gain)⌉ <= 64 bits. The output is normalised by the (integer) DC gain
+ *     and rounded to nearest, which keeps it within the input type range (all impulse-response weights are positive).
+ *   - floating-point samples: the integrators would grow without bound and lose their precision. Instead, the
+ *     mathematically identical cascade of N running moving sums is used (2 additions per stage and high-rate sample).
+ *
+ * An optional compensation FIR (cf. fir::designCicCompensator(..)) flattens the sinc^N pass-band droop at the low rate,
+ * i.e. after decimation or before interpolation. For integer samples, it is computed in double precision and rounded
+ * (and saturated) to the sample type.
+ */
+template<typename T>
+using Accumulator = std::conditional_t<std::is_integral_v<T>, std::uint64_t, std::conditional_t<meta::complex_like<T>, std::complex<double>, double>>;
+
+template<typename T>
+using CompensatorSample = std::conditional_t<std::is_integral_v<T>, double, T>;
+
+template<typename T>
+using CompensatorValue = meta::fundamental_base_value_type_t<CompensatorSample<T>>;
+
+template<typename T>
+concept CicSample = (std::is_integral_v<T> && sizeof(T) <= sizeof(std::int32_t)) || std::floating_point<T> || meta::complex_like<T>;
+
+/// N cascaded integrators y[n] = y[n-1] + x[n]
+template<typename TAcc>
+struct Integrators {
+    std::vector<TAcc> state;
+
+    explicit Integrators(std::size_t order = 1UZ) : state(order, TAcc{}) {}
+
+    [[nodiscard]] constexpr TAcc operator()(TAcc x) noexcept {
+        for (TAcc& stage : state) {
+            stage += x;
+            x = stage;
+        }
+        return x;
+    }
+};
+
+/// N cascaded combs y[n] = x[n] - x[n-M]
+template<typename TAcc>
+struct Combs {
+    std::vector<TAcc> delay; // N consecutive delay lines of length M
+    std::size_t       diffDelay;
+    std::size_t       pos = 0UZ;
+
+    explicit Combs(std::size_t order = 1UZ, std::size_t diffDelay_ = 1UZ) : delay(order * diffDelay_, TAcc{}), diffDelay(diffDelay_) {}
+
+    [[nodiscard]] constexpr TAcc operator()(TAcc x) noexcept {
+        for (std::size_t k = pos; k < delay.size(); k += diffDelay) {
+            const TAcc y = x - delay[k];
+            delay[k]     = x;
+            x            = y;
+        }
+        pos = pos + 1UZ == diffDelay ? 0UZ : pos + 1UZ;
+        return x;
+    }
+};
+
+/// N cascaded running moving sums of length L = R·M, the non-recursive equivalent of the integrator-comb pairs
+template<typename TAcc>
+struct MovingSums {
+    std::vector<TAcc> history; // N consecutive delay lines of length L
+    std::vector<TAcc> sum;
+    std::size_t       length;
+    std::size_t       pos = 0UZ;
+
+    explicit MovingSums(std::size_t order = 1UZ, std::size_t length_ = 1UZ) : history(order * length_, TAcc{}), sum(order, TAcc{}), length(length_) {}
+
+    [[nodiscard]] constexpr TAcc operator()(TAcc x) noexcept {
+        for (std::size_t k = 0UZ; k < sum.size(); ++k) {
+            TAcc& oldest = history[k * length + pos];
+            sum[k] += x - oldest;
+            oldest = x;
+            x      = sum[k];
+        }
+        pos = pos + 1UZ == length ? 0UZ : pos + 1UZ;
+        return x;
+    }
+};
+
+namespace detail {
+[[nodiscard]] inline double gain(std::size_t order, std::size_t diffDelay, std::size_t rate) { return std::pow(static_cast<double>(rate * diffDelay), static_cast<double>(order)); }
+
+template<typename T>
+void checkParameters(std::size_t order, std::size_t diffDelay, std::size_t rate, double dcGain) {
+    if (order == 0UZ || diffDelay == 0UZ || rate == 0UZ) {
+        throw std::invalid_argument(std::format("CIC: order ({}), differential delay ({}) and rate ({}) must be > 0", order, diffDelay, rate));
+    }
+    if constexpr (std::is_integral_v<T>) {
+        const std::size_t requiredBits = static_cast<std::size_t>(std::numeric_limits<T>::digits + 1) + static_cast<std::size_t>(std::ceil(std::log2(dcGain)));
+        if (requiredBits > 64UZ) {
+            throw std::invalid_argument(std::format("CIC: order {}, differential delay {} and rate {} require a {}-bit register for {} samples (max: 64)", order, diffDelay, rate, requiredBits, meta::type_name<T>()));
+        }
+    }
+}
+
+/// exact (R·M)^N / divisor, N.B. only valid after checkParameters(..) bounded it to the 64-bit register
+[[nodiscard]] constexpr std::int64_t integerGain(std::size_t order, std::size_t diffDelay, std::size_t rate, std::size_t divisor) noexcept {
+    std::uint64_t result = 1U;
+    for (std::size_t i = 0UZ; i < order; ++i) {
+        result *= rate * diffDelay;
+    }
+    return static_cast<std::int64_t>(result / divisor);
+}
+
+template<std::integral T>
+[[nodiscard]] constexpr std::uint64_t toAccumulator(T x) noexcept {
+    return static_cast<std::uint64_t>(static_cast<std::int64_t>(x));
+}
+
+template<std::integral T>
+[[nodiscard]] constexpr T fromAccumulator(std::uint64_t acc, std::int64_t dcGain) noexcept { // rounds to nearest, ties away from zero
+    const bool          negative  = static_cast<std::int64_t>(acc) < 0;
+    const std::uint64_t magnitude = negative ? 0UL - acc : acc; // N.B. also valid for -2^63
+    const std::uint64_t quotient  = (magnitude + static_cast<std::uint64_t>(dcGain / 2)) / static_cast<std::uint64_t>(dcGain);
+    return negative ? static_cast<T>(-static_cast<std::int64_t>(quotient)) : static_cast<T>(quotient);
+}
+
+template<std::integral T>
+[[nodiscard]] constexpr T saturate(double value) noexcept {
+    return static_cast<T>(std::clamp(std::round(value), static_cast<double>(std::numeric_limits<T>::lowest()), static_cast<double>(std::numeric_limits<T>::max())));
+}
+
+/// linear-phase compensation FIR at the low rate (newest sample first, cf. 'fir_filter')
+template<typename T>
+struct Compensator {
+    std::vector<CompensatorValue<T>>    b;
+    HistoryBuffer<CompensatorSample<T>> history{1UZ};
+
+    Compensator() = default;
+    explicit Compensator(std::vector<CompensatorValue<T>> coefficients) : b(std::move(coefficients)), history(std::max(1UZ, b.size())) {
+        for (std::size_t i = 0UZ; i < b.size(); ++i) {
+            history.push_front(CompensatorSample<T>{});
+        }
+    }
+
+    [[nodiscard]] bool enabled() const noexcept { return !b.empty(); }
+
+    [[nodiscard]] CompensatorSample<T> operator()(CompensatorSample<T> x) noexcept {
+        history.push_front(x);
+        const auto window = history.first(b.size());
+        return std::transform_reduce(b.cbegin(), b.cend(), window.begin(), CompensatorSample<T>{}, std::plus<>{}, std::multiplies<>{});
+    }
+};
+} // namespace detail
+
+template<CicSample T>
+class Decimator {
+    using TAcc = Accumulator<T>;
+
+    std::size_t            _rate = 1UZ;
+    double                 _dcGain{1.0};
+    std::int64_t           _integerGain{1}; // exact DC gain for integer samples
+    detail::Compensator<T> _compensator;
+    Integrators<TAcc>      _integrators;
+    Combs<TAcc>            _combs;
+    MovingSums<TAcc>       _movingSums;
+
+public:
+    Decimator() = default;
+
+    /// @param compensator optional FIR coefficients applied after decimation (empty: none)
+    Decimator(std::size_t order, std::size_t diffDelay, std::size_t rate, std::vector<CompensatorValue<T>> compensator = {}) : _rate(rate), _dcGain(detail::gain(order, diffDelay, rate)), _compensator(std::move(compensator)) {
+        detail::checkParameters<T>(order, diffDelay, rate, _dcGain);
+        if constexpr (std::is_integral_v<T>) {
+            _integerGain = detail::integerGain(order, diffDelay, rate, 1UZ);
+            _integrators = Integrators<TAcc>(order);
+            _combs       = Combs<TAcc>(order, diffDelay);
+        } else {
+            _movingSums = MovingSums<TAcc>(order, rate * diffDelay);
+        }
+    }
+
+    [[nodiscard]] std::size_t rate() const noexcept { return _rate; }
+    [[nodiscard]] double      dcGain() const noexcept { return _dcGain; }
+
+    /// consumes input.size() (a multiple of rate()) samples and produces input.size() / rate() samples
+    void process(std::span<const T> input, std::span<T> output) noexcept {
+        assert(input.size() % _rate == 0UZ && output.size() >= input.size() / _rate);
+        std::size_t outIdx = 0UZ;
+        for (std::size_t offset = 0UZ; offset < input.size(); offset += _rate) {
+            output[outIdx++] = processChunk(input.subspan(offset, _rate));
+        }
+    }
+
+private:
+    [[nodiscard]] T processChunk(std::span<const T> chunk) noexcept {
+        if constexpr (std::is_integral_v<T>) {
+            TAcc integrated{};
+            for (const T& x : chunk) {
+                integrated = _integrators(detail::toAccumulator(x));
+            }
+            const TAcc combed = _combs(integrated);
+            if (!_compensator.enabled()) {
+                return detail::fromAccumulator<T>(combed, _integerGain);
+            }
+            return detail::saturate<T>(_compensator(static_cast<double>(static_cast<std::int64_t>(combed)) / _dcGain));
+        } else {
+            TAcc summed{};
+            for (const T& x : chunk) {
+                summed = _movingSums(static_cast<TAcc>(x));
+            }
+            const auto normalised = static_cast<T>(summed / _dcGain);
+            return _compensator.enabled() ? _compensator(normalised) : normalised;
+        }
+    }
+};
+
+template<CicSample T>
+class Interpolator {
+    using TAcc = Accumulator<T>;
+
+    std::size_t            _rate = 1UZ;
+    double                 _dcGain{1.0}; // (R·M)^N / R: the zero-stuffing divides the input DC level by R
+    std::int64_t           _integerGain{1};
+    detail::Compensator<T> _compensator;
+    Integrators<TAcc>      _integrators;
+    Combs<TAcc>            _combs;
+    MovingSums<TAcc>       _movingSums;
+
+public:
+    Interpolator() = default;
+
+    /// @param compensator optional FIR coefficients applied before interpolation (empty: none)
+    Interpolator(std::size_t order, std::size_t diffDelay, std::size_t rate, std::vector<CompensatorValue<T>> compensator = {}) : _rate(rate), _dcGain(detail::gain(order, diffDelay, rate) / static_cast<double>(std::max(1UZ, rate))), _compensator(std::move(compensator)) {
+        detail::checkParameters<T>(order, diffDelay, rate, _dcGain);
+        if constexpr (std::is_integral_v<T>) {
+            _integerGain = detail::integerGain(order, diffDelay, rate, rate);
+            _integrators = Integrators<TAcc>(order);
+            _combs       = Combs<TAcc>(order, diffDelay);
+        } else {
+            _movingSums = MovingSums<TAcc>(order, rate * diffDelay);
+        }
+    }
+
+    [[nodiscard]] std::size_t rate() const noexcept { return _rate; }
+    [[nodiscard]] double      dcGain() const noexcept { return _dcGain; }
+
+    /// consumes input.size() samples and produces input.size() · rate() samples
+    void process(std::span<const T> input, std::span<T> output) noexcept {
+        assert(output.size() >= input.size() * _rate);
+        for (std::size_t i = 0UZ; i < input.size(); ++i) {
+            processSample(input[i], output.subspan(i * _rate, _rate));
+        }
+    }
+
+private:
+    void processSample(T x, std::span<T> chunk) noexcept {
+        if constexpr (std::is_integral_v<T>) {
+            if (_compensator.enabled()) {
+                x = detail::saturate<T>(_compensator(static_cast<double>(x)));
+            }
+            TAcc stuffed = _combs(detail::toAccumulator(x));
+            for (T& y : chunk) {
+                y       = detail::fromAccumulator<T>(_integrators(stuffed), _integerGain);
+                stuffed = TAcc{};
+            }
+        } else {
+            auto stuffed = static_cast<TAcc>(_compensator.enabled() ? _compensator(x) : x);
+            for (T& y : chunk) {
+                y       = static_cast<T>(_movingSums(stuffed) / _dcGain);
+                stuffed = TAcc{};
+            }
+        }
+    }
+};
+
+} // namespace gr::filter::cic
+
+#endif // GNURADIO_ALGORITHM_CICFILTER_HPP
@@ -1070,6 +1070,111 @@ template<std::floating_point T>
     throw std::runtime_error("unexpectedly reached this end");
 }
 
+/**
+ * @brief magnitude response of a cascaded integrator-comb (CIC) filter, normalised to unity DC gain:
+ *   |H(f)| = |sin(π·M·f) / (R·M·sin(π·f/R))|^N
+ *
+ * @param f frequency normalised to the low (i.e. decimated or not-yet-interpolated) sample rate
+ * @param order number of integrator-comb stages N
+ * @param diffDelay differential delay M of the comb stages
+ * @param rate rate-change factor R
+ */
+[[nodiscard]] inline double cicMagnitude(double f, std::size_t order, std::size_t diffDelay, std::size_t rate) {
+    const double RM = static_cast<double>(rate * diffDelay);
+    const double x  = std::numbers::pi * f / static_cast<double>(rate);
+    if (std::abs(std::sin(x)) < 1e-12) {
+        return 1.0;
+    }
+    return std::pow(std::abs(std::sin(RM * x) / (RM * std::sin(x))), static_cast<double>(order));
+}
+
+/**
+ * @brief linear-phase FIR compensating the CIC pass-band droop, operating at the low sample rate.
+ *
+ * Least-squares design of the symmetric (type I) amplitude response A(f) = h[c] + 2·Σ_k h[c±k]·cos(2π·f·k) towards
+ * 1/|H_cic(f)| in the pass-band [0, fPass] and zero in the stop-band [fStop, 0.5] with fStop = (fPass + 0.5)/2,
+ * leaving the transition band unconstrained. The result is normalised to unity DC gain.
+ *
+ * @param fPass pass-band edge normalised to the low sample rate, (0, 0.5)
+ * @param nTaps odd number of taps (>= 3)
+ */
+template<std::floating_point T>
+[[nodiscard]] inline FilterCoefficients<T> designCicCompensator(std::size_t order, std::size_t diffDelay, std::size_t rate, std::size_t nTaps, double fPass) {
+    if (order == 0UZ || diffDelay == 0UZ || rate == 0UZ) {
+        throw std::invalid_argument(std::format("CIC compensator: order ({}), differential delay ({}) and rate ({}) must be > 0", order, diffDelay, rate));
+    }
+    if (nTaps < 3UZ || nTaps % 2UZ == 0UZ) {
+        throw std::invalid_argument(std::format("CIC compensator: number of taps ({}) must be odd and >= 3", nTaps));
+    }
+    if (!(fPass > 0.0 && fPass < 0.5)) {
+        throw std::invalid_argument(std::format("CIC compensator: pass-band edge {} must be within (0, 0.5)", fPass));
+    }
+
+    const std::size_t nCoefficients = (nTaps + 1UZ) / 2UZ; // independent coefficients h[c], h[c±1], …
+    const std::size_t nGrid         = 16UZ * nTaps;
+    const double      fStop         = 0.5 * (fPass + 0.5);
+    const auto        basis         = [](std::size_t k, double f) { return k == 0UZ ? 1.0 : 2.0 * std::cos(2.0 * std::numbers::pi * f * static_cast<double>(k)); };
+
+    // normal equations Q·h = d of the least-squares problem, accumulated over the pass- and stop-band grid
+    std::vector<double> Q(nCoefficients * nCoefficients, 0.0);
+    std::vector<double> d(nCoefficients, 0.0);
+    for (std::size_t g = 0UZ; g <= nGrid; ++g) {
+        const double f = 0.5 * static_cast<double>(g) / static_cast<double>(nGrid);
+        if (f > fPass && f < fStop) {
+            continue; // transition band
+        }
+        const double target = f <= fPass ? 1.0 / cicMagnitude(f, order, diffDelay, rate) : 0.0;
+        for (std::size_t j = 0UZ; j < nCoefficients; ++j) {
+            const double cj = basis(j, f);
+            d[j] += target * cj;
+            for (std::size_t k = 0UZ; k < nCoefficients; ++k) {
+                Q[j * nCoefficients + k] += cj * basis(k, f);
+            }
+        }
+    }
+
+    // Gaussian elimination with partial pivoting (Q is symmetric positive-definite and small)
+    for (std::size_t col = 0UZ; col < nCoefficients; ++col) {
+        std::size_t pivot = col;
+        for (std::size_t row = col + 1UZ; row < nCoefficients; ++row) {
+            if (std::abs(Q[row * nCoefficients + col]) > std::abs(Q[pivot * nCoefficients + col])) {
+                pivot = row;
+            }
+        }
+        if (pivot != col) {
+            std::swap_ranges(Q.begin() + static_cast<std::ptrdiff_t>(col * nCoefficients), Q.begin() + static_cast<std::ptrdiff_t>((col + 1UZ) * nCoefficients), Q.begin() + static_cast<std::ptrdiff_t>(pivot * nCoefficients));
+            std::swap(d[col], d[pivot]);
+        }
+        for (std::size_t row = col + 1UZ; row < nCoefficients; ++row) {
+            const double factor = Q[row * nCoefficients + col] / Q[col * nCoefficients + col];
+            for (std::size_t k = col; k < nCoefficients; ++k) {
+                Q[row * nCoefficients + k] -= factor * Q[col * nCoefficients + k];
+            }
+            d[row] -= factor * d[col];
+        }
+    }
+    std::vector<double> h(nCoefficients);
+    for (std::size_t col = nCoefficients; col-- > 0UZ;) {
+        double sum = d[col];
+        for (std::size_t k = col + 1UZ; k < nCoefficients; ++k) {
+            sum -= Q[col * nCoefficients + k] * h[k];
+        }
+        h[col] = sum / Q[col * nCoefficients + col];
+    }
+
+    const std::size_t     centre = nCoefficients - 1UZ;
+    FilterCoefficients<T> coefficients{.b = std::vector<T>(nTaps)};
+    for (std::size_t k = 0UZ; k < nCoefficients; ++k) {
+        coefficients.b[centre - k] = static_cast<T>(h[k]);
+        coefficients.b[centre + k] = static_cast<T>(h[k]);
+    }
+
+    if (const auto [ok, actualGain] = normaliseFilterCoefficients(coefficients, static_cast<T>(0), static_cast<T>(1)); !ok) {
+        throw std::invalid_argument(std::format("CIC compensator: gain correction {} too small for N = {}, M = {}, R = {}, fPass = {}", actualGain, order, diffDelay, rate, fPass));
+    }
+    return coefficients;
+}
+
 } // namespace fir
 } // namespace gr::filter
 
@@ -0,0 +1,346 @@
+#ifndef GNURADIO_ALGORITHM_MULTICHANNELFILTER_HPP
+#define GNURADIO_ALGORITHM_MULTICHANNELFILTER_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <format>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <vir/simd.h>
+
+#include <gnuradio-4.0/algorithm/filter/FilterTool.hpp>
+
+namespace gr::filter {
+
+/**
+ * @brief Structure-of-arrays (SoA) IIR/FIR filter engine that advances many identically structured filter cascades in
+ * lock-step -- one channel (e.g. phase, voltage/current path, ...) per SIMD lane.
+ *
+ * All channels share the number of sections and the per-section number of 'b' and 'a' coefficients, while the coefficient
+ * values may differ per channel. Each section is computed in direct form II, i.e. identical to the floating-point default
+ * of 'Filter<T>' (N.B. a[0] is assumed to be normalised to 1).
+ * Coefficients and states are stored as [row][lane] with the number of lanes padded to a multiple of the native SIMD width,
+ * so that every filter tap becomes a single SIMD multiply-add across 'native_simd<T>::size()' channels. The per-section
+ * state is a doubled circular buffer, i.e. the history is always contiguous and advances in O(1), also for long FIR filters.
+ *
+ * usage example:
+ * MultiChannelFilter<float> filter(3UZ, iir::designFilter<float>(Type::LOWPASS, {.order = 2UZ, .fLow = 50., .fs = 10'000.}));
+ * filter.processOne(frame, frame);               // one sample per channel, in-place
+ * filter.processBlock(channelsIn, channelsOut); // whole chunk, planar per-channel spans, in-place supported
+ */
+template<typename T>
+class MultiChannelFilter {
+    static_assert(std::is_floating_point_v<T>, "MultiChannelFilter requires a floating-point sample type");
+    using V                                = vir::stdx::native_simd<T>;
+    static constexpr std::size_t W         = V::size();
+    static constexpr std::size_t kBatch    = 4UZ;  // lane groups interleaved per tile -> independent multiply-add chains
+    static constexpr std::size_t kTileSize = 32UZ; // samples per tile of the block-processing API
+
+    struct SectionLayout {
+        std::size_t nB;          // number of feed-forward coefficients b[0..nB)
+        std::size_t nA;          // number of feedback coefficients a[0..nA), a[0] == 1 (implicit)
+        std::size_t length;      // state length: max(nA, nB) - 1
+        std::size_t coeffOffset; // first '_coeffs' row: b[0..nB) followed by a[1..nA)
+        std::size_t stateOffset; // first '_state' row: doubled circular buffer with 2·length rows
+        std::size_t pos = 0UZ;   // circular buffer position (shared by all lanes) -> row 'pos + j' holds w[n-1-j]
+    };
+
+    std::size_t                _nChannels{0UZ};
+    std::size_t                _nLanes{0UZ};
+    std::vector<SectionLayout> _sections{};
+    std::vector<T>             _coeffs{}; // [row][lane]
+    std::vector<T>             _state{};  // [row][lane]
+
+public:
+    MultiChannelFilter() = default;
+
+    /// same filter cascade replicated to 'nChannels' channels, 'filterSections' follows the 'Filter<T>' constructor convention
+    template<typename... TFilterCoefficients>
+    explicit MultiChannelFilter(std::size_t nChannels, TFilterCoefficients&&... filterSections) {
+        const std::vector<FilterCoefficients<T>> sections{std::forward<TFilterCoefficients>(filterSections)...};
+        init(std::vector<std::vector<FilterCoefficients<T>>>(nChannels, sections));
+    }
+
+    /// individual filter cascade per channel -- throws 'std::invalid_argument' if the cascade structures differ
+    explicit MultiChannelFilter(std::span<const std::vector<FilterCoefficients<T>>> channelSections) { init(channelSections); }
+
+    [[nodiscard]] constexpr std::size_t nChannels() const noexcept { return _nChannels; }
+    [[nodiscard]] constexpr std::size_t nLanes() const noexcept { return _nLanes; }
+    [[nodiscard]] constexpr std::size_t nSections() const noexcept { return _sections.size(); }
+
+    constexpr void reset(T defaultValue = T()) {
+        std::ranges::fill(_state, defaultValue);
+        std::ranges::for_each(_sections, [](SectionLayout& section) { section.pos = 0UZ; });
+    }
+
+    /// per-channel state dimension, i.e. the DF-II histories w[n-1], w[n-2], … of all sections in cascade order
+    [[nodiscard]] constexpr std::size_t stateSize() const noexcept {
+        return std::transform_reduce(_sections.cbegin(), _sections.cend(), 0UZ, std::plus<>(), [](const SectionLayout& section) { return section.length; });
+    }
+
+    void getState(std::size_t channel, std::span<T> state) const noexcept {
+        assert(channel < _nChannels && state.size() >= stateSize());
+        std::size_t idx = 0UZ;
+        for (const SectionLayout& section : _sections) {
+            for (std::size_t j = 0UZ; j < section.length; ++j) {
+                state[idx++] = _state[(section.stateOffset + section.pos + j) * _nLanes + channel];
+            }
+        }
+    }
+
+    void setState(std::size_t channel, std::span<const T> state) noexcept {
+        assert(channel < _nChannels && state.size() >= stateSize());
+        std::size_t idx = 0UZ;
+        for (const SectionLayout& section : _sections) {
+            for (std::size_t j = 0UZ; j < section.length; ++j, ++idx) {
+                const std::size_t row = (section.pos + j) % section.length; // both halves of the doubled circular buffer
+                _state[(section.stateOffset + row) * _nLanes + channel]                  = state[idx];
+                _state[(section.stateOffset + row + section.length) * _nLanes + channel] = state[idx];
+            }
+        }
+    }
+
+    /// advances all channels by one sample: 'input[i]'/'output[i]' correspond to channel 'i' (in-place supported)
+    void processOne(std::span<const T> input, std::span<T> output) noexcept {
+        assert(input.size() >= _nChannels && output.size() >= _nChannels);
+        for (std::size_t lane = 0UZ; lane < _nLanes; lane += W) {
+            const std::size_t nActive = std::min(W, _nChannels - lane);
+            if (nActive == W) {
+                computeLaneGroup(V(&input[lane], vir::stdx::element_aligned), lane).copy_to(&output[lane], vir::stdx::element_aligned);
+                continue;
+            }
+            std::array<T, W> frame{}; // partially occupied lane group -> padded lanes are zero
+            std::copy_n(std::next(input.begin(), static_cast<std::ptrdiff_t>(lane)), nActive, frame.begin());
+            computeLaneGroup(V(frame.data(), vir::stdx::element_aligned), lane).copy_to(frame.data(), vir::stdx::element_aligned);
+            std::copy_n(frame.begin(), nActive, std::next(output.begin(), static_cast<std::ptrdiff_t>(lane)));
+        }
+        advance();
+    }
+
+    /// single-channel convenience interface matching 'Filter<T>::processOne(T)'
+    [[nodiscard]] T processOne(T input) noexcept {
+        assert(_nChannels == 1UZ);
+        T output;
+        processOne(std::span<const T>(&input, 1UZ), std::span<T>(&output, 1UZ));
+        return output;
+    }
+
+    /// advances all channels by a whole chunk of 'input[0].size()' samples -- planar per-channel spans, in-place supported
+    void processBlock(std::span<const std::span<const T>> input, std::span<const std::span<T>> output) noexcept {
+        assert(input.size() >= _nChannels && output.size() >= _nChannels);
+        if (_nChannels == 0UZ) {
+            return;
+        }
+        const std::size_t nSamples = input[0].size();
+        for (std::size_t lane0 = 0UZ; lane0 < _nLanes; lane0 += kBatch * W) {
+            const std::size_t                     nGroups   = std::min(kBatch, (_nLanes - lane0) / W);
+            const std::size_t                     nChannels = std::min(nGroups * W, _nChannels - lane0);
+            std::array<T, kTileSize * kBatch * W> tile{}; // [sample][group][lane], padded lanes remain zero
+            for (std::size_t offset = 0UZ; offset < nSamples; offset += kTileSize) {
+                const std::size_t nTile = std::min(kTileSize, nSamples - offset);
+                for (std::size_t ch = 0UZ; ch < nChannels; ++ch) { // gather -> transpose into SIMD lanes
+                    assert(input[lane0 + ch].size() >= nSamples && output[lane0 + ch].size() >= nSamples);
+                    const T* src = input[lane0 + ch].data() + offset;
+                    for (std::size_t n = 0UZ; n < nTile; ++n) {
+                        tile[n * kBatch * W + ch] = src[n];
+                    }
+                }
+                for (const SectionLayout& section : _sections) { // section-major: coefficients and state stay in registers for the whole tile
+                    const std::size_t pos = section.length > 0UZ ? (section.pos + section.length - offset % section.length) % section.length : 0UZ;
+                    computeSectionTile(section, pos, lane0, nGroups, tile.data(), nTile);
+                }
+                for (std::size_t ch = 0UZ; ch < nChannels; ++ch) { // scatter
+                    T* dst = output[lane0 + ch].data() + offset;
+                    for (std::size_t n = 0UZ; n < nTile; ++n) {
+                        dst[n] = tile[n * kBatch * W + ch];
+                    }
+                }
+            }
+        }
+        advance(nSamples);
+    }
+
+    /// advances all channels by a whole chunk of interleaved frames, i.e. sample 'n' of channel 'i' at '[n·nChannels() + i]'
+    void processBlock(std::span<const T> input, std::span<T> output) noexcept {
+        assert(_nChannels > 0UZ && input.size() % _nChannels == 0UZ && output.size() >= input.size());
+        if (_nChannels == 1UZ) { // single channel: interleaved == planar
+            const std::array<std::span<const T>, 1UZ> in{input};
+            const std::array<std::span<T>, 1UZ>       out{output.first(input.size())};
+            processBlock(in, out);
+            return;
+        }
+        for (std::size_t offset = 0UZ; offset < input.size(); offset += _nChannels) {
+            processOne(input.subspan(offset, _nChannels), output.subspan(offset, _nChannels));
+        }
+    }
+
+private:
+    void init(std::span<const std::vector<FilterCoefficients<T>>> channelSections) {
+        _nChannels = channelSections.size();
+        _nLanes    = (_nChannels + W - 1UZ) / W * W;
+        _sections.clear();
+
+        std::size_t nCoeffRows = 0UZ;
+        std::size_t nStateRows = 0UZ;
+        if (_nChannels > 0UZ) {
+            for (const FilterCoefficients<T>& section : channelSections.front()) {
+                const std::size_t nB     = section.b.size();
+                const std::size_t nA     = std::max(section.a.size(), 1UZ);
+                const std::size_t length = std::max(nA, nB) - 1UZ;
+                _sections.push_back({.nB = nB, .nA = nA, .length = length, .coeffOffset = nCoeffRows, .stateOffset = nStateRows});
+                nCoeffRows += nB + nA - 1UZ;
+                nStateRows += 2UZ * length;
+            }
+        }
+        _coeffs.assign(nCoeffRows * _nLanes, T(0)); // padded lanes: all-zero coefficients -> zero output
+        _state.assign(nStateRows * _nLanes, T(0));
+
+        for (std::size_t channel = 0UZ; channel < _nChannels; ++channel) {
+            const std::vector<FilterCoefficients<T>>& sections = channelSections[channel];
+            if (sections.size() != _sections.size()) {
+                throw std::invalid_argument(std::format("channel {}: {} filter sections vs. {} for channel 0 -- all channels must share the same filter structure", channel, sections.size(), _sections.size()));
+            }
+            for (std::size_t s = 0UZ; s < _sections.size(); ++s) {
+                const SectionLayout&         layout = _sections[s];
+                const FilterCoefficients<T>& coeffs = sections[s];
+                if (coeffs.b.size() != layout.nB || std::max(coeffs.a.size(), 1UZ) != layout.nA) {
+                    throw std::invalid_argument(std::format("channel {}, section {}: #b={} #a={} vs. #b={} #a={} for channel 0 -- all channels must share the same filter structure", //
+                        channel, s, coeffs.b.size(), coeffs.a.size(), layout.nB, layout.nA));
+                }
+                for (std::size_t k = 0UZ; k < layout.nB; ++k) {
+                    _coeffs[(layout.coeffOffset + k) * _nLanes + channel] = coeffs.b[k];
+                }
+                for (std::size_t k = 1UZ; k < layout.nA; ++k) {
+                    _coeffs[(layout.coeffOffset + layout.nB + k - 1UZ) * _nLanes + channel] = coeffs.a[k];
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] static V load(const T* ptr) noexcept { return V(ptr, vir::stdx::element_aligned); }
+
+    // w[n] = x[n] - a[1]·w[n-1] - a[2]·w[n-2] - … - a[M]·w[n-M]
+    // y[n] =        b[0]·w[n]   + b[1]·w[n-1] + … + b[N]·w[n-N]
+    [[nodiscard]] V computeSection(const SectionLayout& section, std::size_t pos, V x, std::size_t lane) noexcept {
+        const T* b     = &_coeffs[section.coeffOffset * _nLanes + lane];
+        const T* a     = b + section.nB * _nLanes; // a[1]
+        const T* state = section.length > 0UZ ? _state.data() + (section.stateOffset + pos) * _nLanes + lane : nullptr; // pure-gain sections have no state rows
+
+        V w = x;
+        for (std::size_t k = 1UZ; k < section.nA; ++k) {
+            w -= load(a + (k - 1UZ) * _nLanes) * load(state + (k - 1UZ) * _nLanes);
+        }
+        V y = section.nB > 0UZ ? load(b) * w : V(T(0));
+        for (std::size_t k = 1UZ; k < section.nB; ++k) {
+            y += load(b + k * _nLanes) * load(state + (k - 1UZ) * _nLanes);
+        }
+        if (section.length > 0UZ) { // push w[n] into both halves of the doubled circular buffer
+            const std::size_t newPos = previous(pos, section.length);
+            w.copy_to(&_state[(section.stateOffset + newPos) * _nLanes + lane], vir::stdx::element_aligned);
+            w.copy_to(&_state[(section.stateOffset + newPos + section.length) * _nLanes + lane], vir::stdx::element_aligned);
+        }
+        return y;
+    }
+
+    [[nodiscard]] V computeLaneGroup(V x, std::size_t lane) noexcept {
+        for (const SectionLayout& section : _sections) {
+            x = computeSection(section, section.pos, x, lane);
+        }
+        return x;
+    }
+
+    // specialised tile kernel: 'nGroups' interleaved lane groups (independent dependency chains), fixed state length
+    template<std::size_t nGroups, std::size_t length>
+    void computeSectionTile(const SectionLayout& section, std::size_t pos, std::size_t lane0, T* tile, std::size_t nTile) noexcept {
+        std::array<std::array<V, length + 1UZ>, nGroups> b{}; // zero-padded to the state length
+        std::array<std::array<V, length + 1UZ>, nGroups> a{};
+        std::array<std::array<V, length>, nGroups>       w{}; // w[n-1], w[n-2], …
+        for (std::size_t g = 0UZ; g < nGroups; ++g) {
+            const std::size_t lane = lane0 + g * W;
+            for (std::size_t k = 0UZ; k < section.nB; ++k) {
+                b[g][k] = load(&_coeffs[(section.coeffOffset + k) * _nLanes + lane]);
+            }
+            for (std::size_t k = 1UZ; k < section.nA; ++k) {
+                a[g][k] = load(&_coeffs[(section.coeffOffset + section.nB + k - 1UZ) * _nLanes + lane]);
+            }
+            for (std::size_t j = 0UZ; j < length; ++j) {
+                w[g][j] = load(&_state[(section.stateOffset + pos + j) * _nLanes + lane]);
+            }
+        }
+
+        for (std::size_t n = 0UZ; n < nTile; ++n) {
+            for (std::size_t g = 0UZ; g < nGroups; ++g) {
+                T* x  = tile + (n * kBatch + g) * W;
+                V  wn = load(x);
+                for (std::size_t k = 1UZ; k <= length; ++k) {
+                    wn -= a[g][k] * w[g][k - 1UZ];
+                }
+                V y = b[g][0] * wn;
+                for (std::size_t k = 1UZ; k <= length; ++k) {
+                    y += b[g][k] * w[g][k - 1UZ];
+                }
+                for (std::size_t j = length - 1UZ; j > 0UZ; --j) {
+                    w[g][j] = w[g][j - 1UZ];
+                }
+                w[g][0] = wn;
+                y.copy_to(x, vir::stdx::element_aligned);
+            }
+        }
+
+        const std::size_t newPos = (pos + length - nTile % length) % length;
+        for (std::size_t g = 0UZ; g < nGroups; ++g) {
+            const std::size_t lane = lane0 + g * W;
+            for (std::size_t j = 0UZ; j < length; ++j) {
+                const std::size_t row = (newPos + j) % length;
+                w[g][j].copy_to(&_state[(section.stateOffset + row) * _nLanes + lane], vir::stdx::element_aligned);
+                w[g][j].copy_to(&_state[(section.stateOffset + row + length) * _nLanes + lane], vir::stdx::element_aligned);
+            }
+        }
+    }
+
+    void computeSectionTile(const SectionLayout& section, std::size_t pos, std::size_t lane0, std::size_t nGroups, T* tile, std::size_t nTile) noexcept {
+        const auto dispatch = [&]<std::size_t groups>() {
+            switch (section.length) { // common biquad (float) and 4th-order (double) sections, first-order remainder
+            case 1UZ: computeSectionTile<groups, 1UZ>(section, pos, lane0, tile, nTile); return;
+            case 2UZ: computeSectionTile<groups, 2UZ>(section, pos, lane0, tile, nTile); return;
+            case 4UZ: computeSectionTile<groups, 4UZ>(section, pos, lane0, tile, nTile); return;
+            default: break;
+            }
+            for (std::size_t g = 0UZ; g < groups; ++g) { // generic fallback, e.g. long FIR filters
+                std::size_t p = pos;
+                for (std::size_t n = 0UZ; n < nTile; ++n) {
+                    T* x = tile + (n * kBatch + g) * W;
+                    computeSection(section, p, load(x), lane0 + g * W).copy_to(x, vir::stdx::element_aligned);
+                    p = section.length > 0UZ ? previous(p, section.length) : 0UZ;
+                }
+            }
+        };
+        static_assert(kBatch == 4UZ);
+        switch (nGroups) {
+        case 1UZ: dispatch.template operator()<1UZ>(); break;
+        case 2UZ: dispatch.template operator()<2UZ>(); break;
+        case 3UZ: dispatch.template operator()<3UZ>(); break;
+        default: dispatch.template operator()<4UZ>(); break;
+        }
+    }
+
+    [[nodiscard]] static constexpr std::size_t previous(std::size_t pos, std::size_t length) noexcept { return pos == 0UZ ? length - 1UZ : pos - 1UZ; }
+
+    constexpr void advance(std::size_t nSamples = 1UZ) noexcept {
+        for (SectionLayout& section : _sections) {
+            if (section.length > 0UZ) {
+                section.pos = (section.pos + section.length - nSamples % section.length) % section.length;
+            }
+        }
+    }
+};
+
+} // namespace gr::filter
+
+#endif // GNURADIO_ALGORITHM_MULTICHANNELFILTER_HPP
@@ -1,14 +1,23 @@
 #ifndef GNURADIO_ALGORITHM_FFT_HPP
 #define GNURADIO_ALGORITHM_FFT_HPP
 
+#include <array>
 #include <bit>
+#include <cmath>
 #include <complex>
 #include <execution>
+#include <format>
+#include <memory>
 #include <numbers>
+#include <optional>
 #include <ranges>
+#include <span>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include <vir/simd.h>
+
 #include <gnuradio-4.0/meta/utils.hpp>
 
 namespace gr::algorithm {
@@ -17,99 +26,362 @@ namespace detail {
 
 template<gr::meta::complex_like T>
 constexpr T complex_mult(T a, T b) {
-    return a * b; // SIMD optimisation candidate
+    return a * b;
 }
 
-template<gr::meta::complex_like C, std::size_t N = std::dynamic_extent>
-constexpr void fft_stage_kernel(C* data, const C* twiddles, std::size_t halfsize = 0UZ) {
-    using ValueType = typename C::value_type;
-
-    if constexpr (N == 2UZ) {
-        const C a = data[0];
-        const C b = data[1];
-
-        data[0] = a + b;
-        data[1] = a - b;
-
-        // stdx::simd-fication attempt
-        // namespace stdx = vir::stdx;
-        // auto* raw    = reinterpret_cast<ValueType*>(data); // [re0, im0, re1, im1]
-        // using simd_t = stdx::fixed_size_simd<ValueType, 2>;;
-        // simd_t a(&raw[0], stdx::element_aligned);
-        // simd_t b(&raw[2], stdx::element_aligned);
-        // simd_t sum  = a + b;
-        // simd_t diff = a - b;
-        //
-        // sum.copy_to(&raw[0], stdx::element_aligned);  // data[0] = sum
-        // diff.copy_to(&raw[2], stdx::element_aligned); // data[1] = diff
-    } else if constexpr (N == 4UZ) {
-        constexpr std::array<C, 2> twiddles4 = {
-            C{1, 0},  // W_4^0
-            C{0, -1}, // W_4^1 == -j
-        };
-        const C a = data[0];
-        const C b = data[1];
-        const C c = complex_mult(data[2], twiddles4[0]); // W_4^0 == 1
-        const C d = complex_mult(data[3], twiddles4[1]); // W_4^1 == -j
-
-        data[0] = a + c;
-        data[1] = b + d;
-        data[2] = a - c;
-        data[3] = b - d;
-    } else if constexpr (N == 8UZ) {
-        constexpr auto inv_sqrt2 = static_cast<ValueType>(1 / std::numbers::sqrt2_v<ValueType>); // std::sqrt(0.5f)
-
-        constexpr std::array<C, 4> twiddles8 = {//
-            C{1, 0},                            //
-            C{inv_sqrt2, -inv_sqrt2},           //
-            C{0, -1},                           //
-            C{-inv_sqrt2, -inv_sqrt2}};
-
-        const C a0 = data[0];
-        const C a1 = data[1];
-        const C a2 = data[2];
-        const C a3 = data[3];
-
-        const C b0 = complex_mult(data[4], twiddles8[0]);
-        const C b1 = complex_mult(data[5], twiddles8[1]);
-        const C b2 = complex_mult(data[6], twiddles8[2]);
-        const C b3 = complex_mult(data[7], twiddles8[3]);
-
-        data[0] = a0 + b0;
-        data[1] = a1 + b1;
-        data[2] = a2 + b2;
-        data[3] = a3 + b3;
-
-        data[4] = a0 - b0;
-        data[5] = a1 - b1;
-        data[6] = a2 - b2;
-        data[7] = a3 - b3;
-    } else if constexpr (N == std::dynamic_extent) {
-        for (std::size_t j = 0; j < halfsize; ++j) {
-            const auto temp    = complex_mult(data[j + halfsize], twiddles[j]);
-            data[j + halfsize] = data[j] - temp;
-            data[j] += temp;
-        }
+/**
+ * in-place DFT of size P (2, 3, 4, 5, or 8) on split real/imaginary operands.
+ * 'U' is either the scalar 'T' or a 'vir::stdx::simd<T>' holding independent butterflies in its lanes.
+ */
+template<std::size_t P, typename T, typename U>
+constexpr void dftKernel(std::array<U, P>& re, std::array<U, P>& im) {
+    if constexpr (P == 2UZ) {
+        const U dr = re[0] - re[1];
+        const U di = im[0] - im[1];
+        re[0] += re[1];
+        im[0] += im[1];
+        re[1] = dr;
+        im[1] = di;
+    } else if constexpr (P == 3UZ) {
+        constexpr T c  = std::numbers::sqrt3_v<T> / T(2); // sin(2pi/3)
+        const U     sr = re[1] + re[2];
+        const U     si = im[1] + im[2];
+        const U     mr = re[0] - T(0.5) * sr;
+        const U     mi = im[0] - T(0.5) * si;
+        const U     dr = c * (im[1] - im[2]); // -i * c * (a1 - a2)
+        const U     di = c * (re[2] - re[1]);
+        re[0] += sr;
+        im[0] += si;
+        re[1] = mr + dr;
+        im[1] = mi + di;
+        re[2] = mr - dr;
+        im[2] = mi - di;
+    } else if constexpr (P == 4UZ) {
+        const U t0r = re[0] + re[2];
+        const U t0i = im[0] + im[2];
+        const U t1r = re[0] - re[2];
+        const U t1i = im[0] - im[2];
+        const U t2r = re[1] + re[3];
+        const U t2i = im[1] + im[3];
+        const U t3r = im[1] - im[3]; // -i * (a1 - a3)
+        const U t3i = re[3] - re[1];
+        re[0]       = t0r + t2r;
+        im[0]       = t0i + t2i;
+        re[1]       = t1r + t3r;
+        im[1]       = t1i + t3i;
+        re[2]       = t0r - t2r;
+        im[2]       = t0i - t2i;
+        re[3]       = t1r - t3r;
+        im[3]       = t1i - t3i;
+    } else if constexpr (P == 5UZ) {
+        constexpr T c1 = T(0.30901699437494742410L);  // cos(2pi/5)
+        constexpr T c2 = T(-0.80901699437494742410L); // cos(4pi/5)
+        constexpr T s1 = T(0.95105651629515357212L);  // sin(2pi/5)
+        constexpr T s2 = T(0.58778525229247312917L);  // sin(4pi/5)
+        const U     b1r = re[1] + re[4];
+        const U     b1i = im[1] + im[4];
+        const U     b2r = re[2] + re[3];
+        const U     b2i = im[2] + im[3];
+        const U     d1r = re[1] - re[4];
+        const U     d1i = im[1] - im[4];
+        const U     d2r = re[2] - re[3];
+        const U     d2i = im[2] - im[3];
+        const U     r1r = re[0] + c1 * b1r + c2 * b2r;
+        const U     r1i = im[0] + c1 * b1i + c2 * b2i;
+        const U     r2r = re[0] + c2 * b1r + c1 * b2r;
+        const U     r2i = im[0] + c2 * b1i + c1 * b2i;
+        const U     u1r = s1 * d1r + s2 * d2r;
+        const U     u1i = s1 * d1i + s2 * d2i;
+        const U     u2r = s2 * d1r - s1 * d2r;
+        const U     u2i = s2 * d1i - s1 * d2i;
+        re[0] += b1r + b2r;
+        im[0] += b1i + b2i;
+        re[1] = r1r + u1i; // r1 - i * u1
+        im[1] = r1i - u1r;
+        re[4] = r1r - u1i; // r1 + i * u1
+        im[4] = r1i + u1r;
+        re[2] = r2r + u2i; // r2 - i * u2
+        im[2] = r2i - u2r;
+        re[3] = r2r - u2i; // r2 + i * u2
+        im[3] = r2i + u2r;
+    } else if constexpr (P == 8UZ) { // two radix-4 DFTs (even/odd samples) combined with the W_8^k twiddles
+        constexpr T       invSqrt2 = T(1) / std::numbers::sqrt2_v<T>;
+        std::array<U, 4UZ> er{re[0], re[2], re[4], re[6]};
+        std::array<U, 4UZ> ei{im[0], im[2], im[4], im[6]};
+        std::array<U, 4UZ> orr{re[1], re[3], re[5], re[7]};
+        std::array<U, 4UZ> oi{im[1], im[3], im[5], im[7]};
+        dftKernel<4UZ, T>(er, ei);
+        dftKernel<4UZ, T>(orr, oi);
+
+        const U o1r = invSqrt2 * (orr[1] + oi[1]); // W_8^1 = (1 - i)/sqrt(2)
+        const U o1i = invSqrt2 * (oi[1] - orr[1]);
+        const U o2r = oi[2]; // W_8^2 = -i
+        const U o2i = -orr[2];
+        const U o3r = invSqrt2 * (oi[3] - orr[3]); // W_8^3 = -(1 + i)/sqrt(2)
+        const U o3i = -invSqrt2 * (orr[3] + oi[3]);
+
+        re[0] = er[0] + orr[0];
+        im[0] = ei[0] + oi[0];
+        re[4] = er[0] - orr[0];
+        im[4] = ei[0] - oi[0];
+        re[1] = er[1] + o1r;
+        im[1] = ei[1] + o1i;
+        re[5] = er[1] - o1r;
+        im[5] = ei[1] - o1i;
+        re[2] = er[2] + o2r;
+        im[2] = ei[2] + o2i;
+        re[6] = er[2] - o2r;
+        im[6] = ei[2] - o2i;
+        re[3] = er[3] + o3r;
+        im[3] = ei[3] + o3i;
+        re[7] = er[3] - o3r;
+        im[7] = ei[3] - o3i;
     } else {
-        static_assert(gr::meta::always_false<C>, "unimplemented power N of 2, 4, or 8");
+        static_assert(gr::meta::always_false<U>, "unimplemented radix P of 2, 3, 4, 5, or 8");
     }
 }
+
+/**
+ * Stockham auto-sort mixed-radix (8, 4, 2, 3, 5) forward FFT operating on split real/imaginary buffers.
+ * Each stage reads from one buffer and writes the next in natural order, i.e. no bit-reversal permutation is needed.
+ * The butterflies are vectorised with 'vir::stdx::native_simd' across the stride (later stages) or across the
+ * twiddle index (first stages where the stride is smaller than the SIMD width).
+ */
+template<std::floating_point T>
+class MixedRadixPlan {
+    using V                       = vir::stdx::native_simd<T>;
+    static constexpr std::size_t W = V::size();
+
+    struct Stage {
+        std::size_t    radix;
+        std::size_t    m;      // number of distinct twiddle sets (= remaining length / radix)
+        std::size_t    stride; // product of the previous radices
+        std::vector<T> twiddleRe{};
+        std::vector<T> twiddleIm{}; // W_len^(j*p) stored at [(j - 1) * m + p]
+    };
+
+    std::size_t                     _size{0UZ};
+    std::vector<Stage>              _stages{};
+    std::array<std::vector<T>, 2UZ> _re{};
+    std::array<std::vector<T>, 2UZ> _im{};
+    std::size_t                     _result{0UZ};
+
+public:
+    static std::optional<std::vector<std::size_t>> factorise(std::size_t n) {
+        if (n == 0UZ) {
+            return std::nullopt;
+        }
+        std::vector<std::size_t> radices;
+        for (std::size_t radix : {8UZ, 4UZ, 2UZ, 3UZ, 5UZ}) { // large radices first -> stride grows quickly to the SIMD width
+            while (n % radix == 0UZ) {
+                radices.push_back(radix);
+                n /= radix;
+            }
+        }
+        return n == 1UZ ? std::optional(radices) : std::nullopt;
+    }
+
+    static bool isSupported(std::size_t n) { return factorise(n).has_value(); }
+
+    [[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+    void init(std::size_t n) {
+        const auto radices = factorise(n);
+        if (!radices) {
+            throw std::invalid_argument(std::format("mixed-radix FFT supports only sizes with factors 2, 3, and 5, requested size: {}", n));
+        }
+        _size = n;
+        _stages.clear();
+        std::size_t length = n;
+        std::size_t stride = 1UZ;
+        for (const std::size_t radix : *radices) {
+            Stage stage{.radix = radix, .m = length / radix, .stride = stride};
+            stage.twiddleRe.resize((radix - 1UZ) * stage.m);
+            stage.twiddleIm.resize((radix - 1UZ) * stage.m);
+            for (std::size_t j = 1UZ; j < radix; ++j) {
+                for (std::size_t p = 0UZ; p < stage.m; ++p) {
+                    const double angle                          = -2. * std::numbers::pi * static_cast<double>((j * p) % length) / static_cast<double>(length);
+                    stage.twiddleRe[(j - 1UZ) * stage.m + p] = static_cast<T>(std::cos(angle));
+                    stage.twiddleIm[(j - 1UZ) * stage.m + p] = static_cast<T>(std::sin(angle));
+                }
+            }
+            _stages.push_back(std::move(stage));
+            length /= radix;
+            stride *= radix;
+        }
+        for (std::size_t i = 0UZ; i < 2UZ; ++i) {
+            _re[i].assign(n, T(0));
+            _im[i].assign(n, T(0));
+        }
+        _result = 0UZ;
+    }
+
+    [[nodiscard]] std::span<T> inputRe() noexcept { return _re[0]; }
+    [[nodiscard]] std::span<T> inputIm() noexcept { return _im[0]; }
+    [[nodiscard]] std::span<const T> outputRe() const noexcept { return _re[_result]; }
+    [[nodiscard]] std::span<const T> outputIm() const noexcept { return _im[_result]; }
+
+    void execute() {
+        std::size_t src = 0UZ;
+        for (const Stage& stage : _stages) {
+            const T* xr = _re[src].data();
+            const T* xi = _im[src].data();
+            T*       yr = _re[1UZ - src].data();
+            T*       yi = _im[1UZ - src].data();
+            switch (stage.radix) {
+            case 2UZ: runStage<2UZ>(stage, xr, xi, yr, yi); break;
+            case 3UZ: runStage<3UZ>(stage, xr, xi, yr, yi); break;
+            case 4UZ: runStage<4UZ>(stage, xr, xi, yr, yi); break;
+            case 5UZ: runStage<5UZ>(stage, xr, xi, yr, yi); break;
+            case 8UZ: runStage<8UZ>(stage, xr, xi, yr, yi); break;
+            default: std::unreachable();
+            }
+            src = 1UZ - src;
+        }
+        _result = src;
+    }
+
+private:
+    template<std::size_t P, typename U>
+    static constexpr void applyTwiddles(std::array<U, P>& re, std::array<U, P>& im, const std::array<U, P>& wr, const std::array<U, P>& wi) {
+        for (std::size_t j = 1UZ; j < P; ++j) {
+            const U r = re[j] * wr[j] - im[j] * wi[j];
+            im[j]     = re[j] * wi[j] + im[j] * wr[j];
+            re[j]     = r;
+        }
+    }
+
+    // y[q + s * (P * p + j)] = W_len^(j * p) * sum_l x[q + s * (p + m * l)] * W_P^(j * l)
+    template<std::size_t P>
+    static void runStage(const Stage& stage, const T* xr, const T* xi, T* yr, T* yi) {
+        const std::size_t m = stage.m;
+        const std::size_t s = stage.stride;
+
+        const auto scalarButterfly = [&](std::size_t p, std::size_t q) {
+            std::array<T, P> re;
+            std::array<T, P> im;
+            std::array<T, P> wr;
+            std::array<T, P> wi;
+            for (std::size_t l = 0UZ; l < P; ++l) {
+                re[l] = xr[q + s * (p + m * l)];
+                im[l] = xi[q + s * (p + m * l)];
+                wr[l] = l == 0UZ ? T(1) : stage.twiddleRe[(l - 1UZ) * m + p];
+                wi[l] = l == 0UZ ? T(0) : stage.twiddleIm[(l - 1UZ) * m + p];
+            }
+            dftKernel<P, T>(re, im);
+            applyTwiddles<P>(re, im, wr, wi);
+            for (std::size_t j = 0UZ; j < P; ++j) {
+                yr[q + s * (P * p + j)] = re[j];
+                yi[q + s * (P * p + j)] = im[j];
+            }
+        };
+
+        if (s >= W) { // vectorise across the stride: contiguous loads/stores, broadcast twiddles
+            for (std::size_t p = 0UZ; p < m; ++p) {
+                std::array<V, P> wr;
+                std::array<V, P> wi;
+                for (std::size_t l = 1UZ; l < P; ++l) {
+                    wr[l] = V(stage.twiddleRe[(l - 1UZ) * m + p]);
+                    wi[l] = V(stage.twiddleIm[(l - 1UZ) * m + p]);
+                }
+                std::size_t q = 0UZ;
+                for (; q + W <= s; q += W) {
+                    std::array<V, P> re;
+                    std::array<V, P> im;
+                    for (std::size_t l = 0UZ; l < P; ++l) {
+                        re[l] = V(&xr[q + s * (p + m * l)], vir::stdx::element_aligned);
+                        im[l] = V(&xi[q + s * (p + m * l)], vir::stdx::element_aligned);
+                    }
+                    dftKernel<P, T>(re, im);
+                    applyTwiddles<P>(re, im, wr, wi);
+                    for (std::size_t j = 0UZ; j < P; ++j) {
+                        re[j].copy_to(&yr[q + s * (P * p + j)], vir::stdx::element_aligned);
+                        im[j].copy_to(&yi[q + s * (P * p + j)], vir::stdx::element_aligned);
+                    }
+                }
+                for (; q < s; ++q) {
+                    scalarButterfly(p, q);
+                }
+            }
+            return;
+        }
+
+        // small stride: vectorise across the twiddle index p (contiguous twiddles, strided input/output)
+        for (std::size_t q = 0UZ; q < s; ++q) {
+            std::size_t p = 0UZ;
+            for (; p + W <= m; p += W) {
+                std::array<V, P> re;
+                std::array<V, P> im;
+                std::array<V, P> wr;
+                std::array<V, P> wi;
+                alignas(V) std::array<T, W> gatherRe;
+                alignas(V) std::array<T, W> gatherIm;
+                for (std::size_t l = 0UZ; l < P; ++l) {
+                    if (s == 1UZ) {
+                        re[l] = V(&xr[p + m * l], vir::stdx::element_aligned);
+                        im[l] = V(&xi[p + m * l], vir::stdx::element_aligned);
+                    } else {
+                        for (std::size_t lane = 0UZ; lane < W; ++lane) {
+                            gatherRe[lane] = xr[q + s * (p + lane + m * l)];
+                            gatherIm[lane] = xi[q + s * (p + lane + m * l)];
+                        }
+                        re[l] = V(gatherRe.data(), vir::stdx::vector_aligned);
+                        im[l] = V(gatherIm.data(), vir::stdx::vector_aligned);
+                    }
+                    if (l > 0UZ) {
+                        wr[l] = V(&stage.twiddleRe[(l - 1UZ) * m + p], vir::stdx::element_aligned);
+                        wi[l] = V(&stage.twiddleIm[(l - 1UZ) * m + p], vir::stdx::element_aligned);
+                    }
+                }
+                dftKernel<P, T>(re, im);
+                applyTwiddles<P>(re, im, wr, wi);
+                for (std::size_t j = 0UZ; j < P; ++j) {
+                    re[j].copy_to(gatherRe.data(), vir::stdx::vector_aligned);
+                    im[j].copy_to(gatherIm.data(), vir::stdx::vector_aligned);
+                    for (std::size_t lane = 0UZ; lane < W; ++lane) {
+                        yr[q + s * (P * (p + lane) + j)] = gatherRe[lane];
+                        yi[q + s * (P * (p + lane) + j)] = gatherIm[lane];
+                    }
+                }
+            }
+            for (; p < m; ++p) {
+                scalarButterfly(p, q);
+            }
+        }
+    }
+};
 } // namespace detail
 
+/**
+ * native (dependency-free) forward FFT:
+ *  - sizes with only prime factors 2, 3, and 5 use the SIMD mixed-radix Stockham kernels (radix-8/4/2/3/5),
+ *  - real-valued input of even size N is packed into an N/2-point complex FFT and post-processed into the full spectrum,
+ *  - all other sizes fall back to Bluestein's algorithm (chirp-z convolution via a power-of-two FFT).
+ * The output always contains the full (un-normalised) N-point spectrum.
+ */
 template<typename TInput, gr::meta::complex_like TOutput = std::conditional<gr::meta::complex_like<TInput>, TInput, std::complex<typename TInput::value_type>>>
 requires((gr::meta::complex_like<TInput> || std::floating_point<TInput>))
 struct FFT {
     using ValueType = typename TOutput::value_type;
 
-    std::vector<std::vector<TOutput>> stageTwiddles{};
+    detail::MixedRadixPlan<ValueType> plan{};         // N-point (complex input) or N/2-point (packed real input) transform
+    std::vector<TOutput>              realTwiddles{}; // W_N^k, k in [0, N/2], used to unpack the real-input spectrum
     std::vector<TOutput>              bluesteinExpTable{};
     std::vector<TOutput>              bluesteinChirpFFT{};
-    std::vector<std::size_t>          bitReverseTable{};
     std::size_t                       fftSize{0};
+    bool                              realInputPath{false};
 
     void initAll() {
-        precomputeTwiddleFactors();
-        precomputeBitReversal();
+        realInputPath = std::floating_point<TInput> && fftSize % 2UZ == 0UZ && detail::MixedRadixPlan<ValueType>::isSupported(fftSize / 2UZ);
+        if (realInputPath) {
+            plan.init(fftSize / 2UZ);
+            precomputeRealTwiddles();
+        } else if (detail::MixedRadixPlan<ValueType>::isSupported(fftSize)) {
+            plan.init(fftSize);
+        } else {
+            plan = {};
+            precomputeBluesteinTable(fftSize);
+        }
     }
 
     auto compute(const std::ranges::input_range auto& in, std::ranges::output_range<TOutput> auto&& out) {
@@ -128,8 +400,17 @@ struct FFT {
             fftSize = size;
             initAll();
         }
-        if (!std::has_single_bit(size) && bluesteinExpTable.size() != size) {
-            precomputeBluesteinTable(size); // added
+
+        if constexpr (std::floating_point<TInput>) {
+            if (realInputPath) {
+                transformReal(in, out);
+                return out;
+            }
+        }
+
+        if (plan.size() == size) {
+            transformMixedRadix(in, out);
+            return out;
         }
 
         std::ranges::transform(in, out.begin(), [](auto v) {
@@ -139,12 +420,7 @@ struct FFT {
                 return static_cast<TOutput>(v);
             }
         });
-
-        if (std::has_single_bit(size)) {
-            transformRadix2(out);
-        } else {
-            transformBluestein(out);
-        }
+        transformBluestein(out);
 
         return out;
     }
@@ -152,36 +428,54 @@ struct FFT {
     auto compute(const std::ranges::input_range auto& in) { return compute(in, std::vector<TOutput>(in.size())); }
 
 private:
-    void transformRadix2(std::ranges::input_range auto& inPlace) const {
-        const std::size_t N = inPlace.size();
-        if (!std::has_single_bit(N)) {
-            throw std::invalid_argument(std::format("Input data must be power-of-two, input size: {}", inPlace.size()));
+    void transformMixedRadix(const std::ranges::input_range auto& in, auto& out) {
+        std::span<ValueType> re = plan.inputRe();
+        std::span<ValueType> im = plan.inputIm();
+        std::size_t          i  = 0UZ;
+        for (const auto& v : in) {
+            if constexpr (std::floating_point<TInput>) {
+                re[i] = static_cast<ValueType>(v);
+                im[i] = ValueType(0);
+            } else {
+                re[i] = static_cast<ValueType>(v.real());
+                im[i] = static_cast<ValueType>(v.imag());
+            }
+            ++i;
         }
 
-        for (std::size_t i = 0UZ; i < N; ++i) {
-            const std::size_t j = bitReverseTable[i];
-            if (j > i) {
-                std::swap(inPlace[i], inPlace[j]);
-            }
+        plan.execute();
+
+        const std::span<const ValueType> outRe = plan.outputRe();
+        const std::span<const ValueType> outIm = plan.outputIm();
+        for (std::size_t k = 0UZ; k < fftSize; ++k) {
+            out[k] = TOutput(outRe[k], outIm[k]);
         }
+    }
 
-        const std::size_t nStages = static_cast<std::size_t>(std::countr_zero(N));
-        for (std::size_t stage = 0, size = 2; stage < nStages; size *= 2, ++stage) {
-            const auto&       twiddles = stageTwiddles[stage];
-            const std::size_t halfsize = size / 2;
-
-            for (std::size_t i = 0; i < N; i += size) {
-                TOutput* block = &inPlace[i];
-
-                switch (size) { // optimised non-branching fft sub kernels
-                case 2: detail::fft_stage_kernel<TOutput, 2>(block, twiddles.data()); break;
-                case 4: detail::fft_stage_kernel<TOutput, 4>(block, twiddles.data()); break;
-                case 8: detail::fft_stage_kernel<TOutput, 8>(block, twiddles.data()); break;
-                default: // generic case
-                    detail::fft_stage_kernel<TOutput>(block, twiddles.data(), halfsize);
-                    break;
-                    break;
-                }
+    // N real samples -> z[k] = x[2k] + i x[2k+1] -> Z = FFT_{N/2}(z) -> X[k] = Fe[k] + W_N^k Fo[k], X[N - k] = conj(X[k])
+    void transformReal(const std::ranges::input_range auto& in, auto& out) {
+        std::span<ValueType> re = plan.inputRe();
+        std::span<ValueType> im = plan.inputIm();
+        std::size_t          i  = 0UZ;
+        for (const auto& v : in) {
+            ((i % 2UZ == 0UZ) ? re : im)[i / 2UZ] = static_cast<ValueType>(v);
+            ++i;
+        }
+
+        plan.execute();
+
+        const std::span<const ValueType> zRe  = plan.outputRe();
+        const std::span<const ValueType> zIm  = plan.outputIm();
+        const std::size_t                half = fftSize / 2UZ;
+        for (std::size_t k = 0UZ; k <= half; ++k) {
+            const TOutput zk(zRe[k % half], zIm[k % half]);
+            const TOutput zc(zRe[(half - k) % half], -zIm[(half - k) % half]); // conj(Z[N/2 - k])
+            const TOutput even = ValueType(0.5) * (zk + zc);
+            const TOutput odd  = TOutput(ValueType(0), ValueType(-0.5)) * (zk - zc);
+            const TOutput xk   = even + detail::complex_mult(realTwiddles[k], odd);
+            out[k]             = xk;
+            if (k > 0UZ && k < half) {
+                out[fftSize - k] = std::conj(xk);
             }
         }
     }
@@ -218,28 +512,11 @@ private:
             bluesteinExpTable.begin(), inPlace.begin(), [scale](auto v, auto w) { return detail::complex_mult(v * scale, w); });
     }
 
-    void precomputeTwiddleFactors(bool inverse = false) {
-        stageTwiddles.clear();
-        const auto minus2Pi = ValueType(inverse ? 2 : -2) * std::numbers::pi_v<ValueType>;
-        for (std::size_t size = 2UZ; size <= fftSize; size *= 2UZ) {
-            const std::size_t    m{size / 2};
-            const TOutput        w{std::exp(TOutput(0., minus2Pi / static_cast<ValueType>(size)))};
-            std::vector<TOutput> twiddles;
-            if (size == 2) {
-                twiddles.push_back(TOutput{1.0, 0.0});
-            } else if (size == 8) {
-                twiddles.emplace_back(1.0, 0.0);                         // W_8^0
-                twiddles.emplace_back(std::sqrt(0.5), -std::sqrt(0.5));  // W_8^1
-                twiddles.emplace_back(0.0, -1.0);                        // W_8^2
-                twiddles.emplace_back(-std::sqrt(0.5), -std::sqrt(0.5)); // W_8^3
-            } else {
-                TOutput wk{1., 0.};
-                for (std::size_t j = 0UZ; j < m; ++j) {
-                    twiddles.push_back(wk);
-                    wk *= w;
-                }
-            }
-            stageTwiddles.push_back(std::move(twiddles));
+    void precomputeRealTwiddles() {
+        realTwiddles.resize(fftSize / 2UZ + 1UZ);
+        for (std::size_t k = 0UZ; k < realTwiddles.size(); ++k) {
+            const double angle = -2. * std::numbers::pi * static_cast<double>(k) / static_cast<double>(fftSize);
+            realTwiddles[k]    = TOutput(static_cast<ValueType>(std::cos(angle)), static_cast<ValueType>(std::sin(angle)));
         }
     }
 
@@ -261,18 +538,6 @@ private:
         FFT<TOutput, TOutput> fft{}; // always power-of-two
         bluesteinChirpFFT = fft.compute(b);
     }
-
-    void precomputeBitReversal() {
-        const std::size_t width = static_cast<std::size_t>(std::countr_zero(fftSize));
-        bitReverseTable.resize(fftSize);
-        for (std::size_t i = 0; i < fftSize; ++i) {
-            std::size_t val = i, result = 0;
-            for (std::size_t j = 0; j < width; ++j, val >>= 1) {
-                result = (result << 1) | (val & 1U);
-            }
-            bitReverseTable[i] = result;
-        }
-    }
 };
 
 } // namespace gr::algorithm
@@ -0,0 +1,342 @@
+#ifndef GNURADIO_ALGORITHM_FFT_PARALLEL_HPP
+#define GNURADIO_ALGORITHM_FFT_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <complex>
+#include <functional>
+#include <memory>
+#include <numbers>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <gnuradio-4.0/meta/utils.hpp>
+#include <gnuradio-4.0/thread/thread_pool.hpp>
+
+#include "fft.hpp"
+
+namespace gr::algorithm {
+
+namespace detail {
+
+/**
+ * executes 'fn(chunk, slot)' for all chunks in [0, nChunks) on up to 'nWorkers' pool tasks and the calling thread.
+ * 'slot' in [0, nWorkers] is unique per participating thread (e.g. to index per-thread scratch buffers).
+ * The calling thread drains the chunk queue as well and only waits for chunks already in progress, i.e. this does not
+ * dead-lock if the pool is saturated or if it is called from within a pool thread.
+ */
+inline void parallelChunks(thread_pool::TaskExecutor& pool, std::size_t nChunks, std::size_t nWorkers, std::function<void(std::size_t chunk, std::size_t slot)> fn) {
+    if (nChunks == 0UZ) {
+        return;
+    }
+
+    struct State {
+        std::function<void(std::size_t, std::size_t)> fn;
+        std::size_t                                    nChunks;
+        std::atomic<std::size_t>                       nextChunk{0UZ};
+        std::atomic<std::size_t>                       nextSlot{0UZ};
+        std::atomic<std::size_t>                       nDone{0UZ};
+
+        State(std::function<void(std::size_t, std::size_t)> fn_, std::size_t nChunks_) : fn(std::move(fn_)), nChunks(nChunks_) {}
+
+        void run() {
+            const std::size_t slot = nextSlot.fetch_add(1UZ, std::memory_order_relaxed);
+            for (std::size_t chunk = nextChunk.fetch_add(1UZ, std::memory_order_relaxed); chunk < nChunks; chunk = nextChunk.fetch_add(1UZ, std::memory_order_relaxed)) {
+                fn(chunk, slot);
+                if (nDone.fetch_add(1UZ, std::memory_order_acq_rel) + 1UZ == nChunks) {
+                    nDone.notify_all();
+                }
+            }
+        }
+    };
+
+    auto              state  = std::make_shared<State>(std::move(fn), nChunks);
+    const std::size_t nTasks = std::min(nWorkers, nChunks - 1UZ);
+    for (std::size_t i = 0UZ; i < nTasks; ++i) {
+        pool.execute([state] { state->run(); }); // N.B. late tasks find the queue empty and return immediately
+    }
+    state->run();
+
+    for (std::size_t done = state->nDone.load(std::memory_order_acquire); done < nChunks; done = state->nDone.load(std::memory_order_acquire)) {
+        state->nDone.wait(done, std::memory_order_acquire);
+    }
+}
+
+/// visits all (row, col) elements of the rows [rowBegin, rowEnd) of a row-major 'rows x cols' matrix in cache-sized tiles
+template<typename Fn>
+void forEachTiled(std::size_t cols, std::size_t rowBegin, std::size_t rowEnd, Fn&& fn) {
+    constexpr std::size_t kTile = 32UZ; // 32x32 tiles of source and destination fit comfortably into L1
+    for (std::size_t r0 = rowBegin; r0 < rowEnd; r0 += kTile) {
+        const std::size_t r1 = std::min(r0 + kTile, rowEnd);
+        for (std::size_t c0 = 0UZ; c0 < cols; c0 += kTile) {
+            const std::size_t c1 = std::min(c0 + kTile, cols);
+            for (std::size_t r = r0; r < r1; ++r) {
+                for (std::size_t c = c0; c < c1; ++c) {
+                    fn(r, c);
+                }
+            }
+        }
+    }
+}
+
+} // namespace detail
+
+/**
+ * multi-threaded forward FFT for very long transforms (e.g. 2^20 ... 2^26 points) using the six-step decomposition N = N1 * N2:
+ *  1. transpose the N1 x N2 input matrix (cache-blocked),
+ *  2. N2 row FFTs of length N1, each multiplied by the twiddle factors W_N^(n2 * k1),
+ *  3. transpose,
+ *  4. N1 row FFTs of length N2,
+ *  5. transpose into natural output order.
+ * The transposes and row FFTs (native mixed-radix kernels, one plan per thread) are dispatched on the
+ * 'thread_pool::Manager' CPU pool, with the calling thread participating. Real-valued input of even size is
+ * packed into an N/2-point complex transform. Sizes that cannot be decomposed fall back to the single-threaded 'FFT'.
+ * The output always contains the full (un-normalised) N-point spectrum, identical to 'FFT'.
+ */
+template<typename TInput, gr::meta::complex_like TOutput = std::conditional<gr::meta::complex_like<TInput>, TInput, std::complex<typename TInput::value_type>>>
+requires((gr::meta::complex_like<TInput> || std::floating_point<TInput>))
+struct FFTParallel {
+    using ValueType = typename TOutput::value_type;
+    using Complex   = std::complex<ValueType>;
+    using Plan      = detail::MixedRadixPlan<ValueType>;
+
+    std::size_t                                fftSize{0UZ};
+    std::size_t                                nThreads{0UZ}; // total number of threads incl. the caller (0: the pool's max. thread count)
+    std::shared_ptr<thread_pool::TaskExecutor> pool{};        // (default: thread_pool::Manager::defaultCpuPool())
+
+    /// true if 'size' is handled by the six-step algorithm rather than the single-threaded fallback
+    static bool isSupported(std::size_t size) {
+        const std::size_t n = (std::floating_point<TInput> && size % 2UZ == 0UZ) ? size / 2UZ : size;
+        return Plan::isSupported(n) && splitSize(n) > 1UZ;
+    }
+
+    auto compute(const std::ranges::input_range auto& in, std::ranges::output_range<TOutput> auto&& out) {
+        if constexpr (requires { out.resize(in.size()); }) {
+            if (out.size() != in.size()) {
+                out.resize(in.size());
+            }
+        }
+
+        const auto size = in.size();
+        if (size == 0UZ) {
+            return out;
+        }
+        if (fftSize != size || _nSlots != nSlots()) {
+            fftSize = size;
+            initAll();
+        }
+        if (!_supported) {
+            _fallback.compute(in, out);
+            return out;
+        }
+
+        loadInput(in);
+        sixStep();
+        if (_realInput) {
+            unpackRealSpectrum(out);
+        } else {
+            storeTransposed(out);
+        }
+        return out;
+    }
+
+    auto compute(const std::ranges::input_range auto& in) { return compute(in, std::vector<TOutput>(in.size())); }
+
+private:
+    struct Worker {
+        Plan rows{}; // N1-point row FFTs
+        Plan cols{}; // N2-point row FFTs (after transposition)
+    };
+
+    bool                   _supported{false};
+    bool                   _realInput{false};
+    std::size_t            _n{0UZ}; // complex transform size (N, or N/2 for packed real input)
+    std::size_t            _n1{0UZ};
+    std::size_t            _n2{0UZ};
+    std::size_t            _nSlots{0UZ};
+    std::vector<ValueType> _aRe{};
+    std::vector<ValueType> _aIm{};
+    std::vector<ValueType> _bRe{};
+    std::vector<ValueType> _bIm{};
+    std::vector<Complex>   _twiddleLo{}; // W_n^i, i < N1
+    std::vector<Complex>   _twiddleHi{}; // W_n^(i * N1), i < N2 -> W_n^m = hi[m / N1] * lo[m % N1] with O(sqrt(n)) storage
+    std::vector<TOutput>   _realTwiddles{};
+    std::vector<Worker>    _workers{};
+    FFT<TInput, TOutput>   _fallback{};
+
+    static std::size_t splitSize(std::size_t n) { // largest divisor <= sqrt(n)
+        for (std::size_t d = static_cast<std::size_t>(std::sqrt(static_cast<double>(n))); d > 1UZ; --d) {
+            if (n % d == 0UZ) {
+                return d;
+            }
+        }
+        return 1UZ;
+    }
+
+    std::size_t nSlots() {
+        if (!pool) {
+            pool = thread_pool::Manager::defaultCpuPool();
+        }
+        return std::max(1UZ, nThreads > 0UZ ? nThreads : static_cast<std::size_t>(pool->maxThreads()));
+    }
+
+    static Complex twiddle(std::size_t m, std::size_t n) {
+        const double angle = -2. * std::numbers::pi * static_cast<double>(m % n) / static_cast<double>(n);
+        return Complex(static_cast<ValueType>(std::cos(angle)), static_cast<ValueType>(std::sin(angle)));
+    }
+
+    void initAll() {
+        _nSlots    = nSlots();
+        _supported = isSupported(fftSize);
+        if (!_supported) {
+            return;
+        }
+        _realInput = std::floating_point<TInput> && fftSize % 2UZ == 0UZ;
+        _n         = _realInput ? fftSize / 2UZ : fftSize;
+        _n1        = splitSize(_n);
+        _n2        = _n / _n1;
+
+        for (auto* buffer : {&_aRe, &_aIm, &_bRe, &_bIm}) {
+            buffer->assign(_n, ValueType(0));
+        }
+        _twiddleLo.resize(_n1);
+        for (std::size_t i = 0UZ; i < _n1; ++i) {
+            _twiddleLo[i] = twiddle(i, _n);
+        }
+        _twiddleHi.resize(_n2);
+        for (std::size_t i = 0UZ; i < _n2; ++i) {
+            _twiddleHi[i] = twiddle(i * _n1, _n);
+        }
+        if (_realInput) {
+            _realTwiddles.resize(_n + 1UZ);
+            for (std::size_t k = 0UZ; k <= _n; ++k) {
+                _realTwiddles[k] = twiddle(k, fftSize);
+            }
+        }
+        _workers.resize(_nSlots);
+        for (Worker& worker : _workers) {
+            worker.rows.init(_n1);
+            worker.cols.init(_n2);
+        }
+    }
+
+    /// calls 'fn(begin, end, slot)' for disjoint sub-ranges of [0, nItems) in parallel, 'grain' being the minimum sub-range size
+    void parallelFor(std::size_t nItems, std::size_t grain, const std::function<void(std::size_t, std::size_t, std::size_t)>& fn) {
+        const std::size_t nChunks   = std::clamp(nItems / std::max(grain, 1UZ), 1UZ, 4UZ * _nSlots); // over-partition for load balancing
+        const std::size_t chunkSize = (nItems + nChunks - 1UZ) / nChunks;
+        detail::parallelChunks(*pool, nChunks, _nSlots - 1UZ, [&](std::size_t chunk, std::size_t slot) {
+            const std::size_t begin = chunk * chunkSize;
+            const std::size_t end   = std::min(nItems, begin + chunkSize);
+            if (begin < end) {
+                fn(begin, end, slot);
+            }
+        });
+    }
+
+    void loadInput(const std::ranges::input_range auto& in) {
+        const auto load = [this](std::size_t i, const auto& v) {
+            if constexpr (std::floating_point<TInput>) {
+                if (_realInput) { // z[k] = x[2k] + i x[2k+1]
+                    ((i % 2UZ == 0UZ) ? _aRe : _aIm)[i / 2UZ] = static_cast<ValueType>(v);
+                } else {
+                    _aRe[i] = static_cast<ValueType>(v);
+                    _aIm[i] = ValueType(0);
+                }
+            } else {
+                _aRe[i] = static_cast<ValueType>(v.real());
+                _aIm[i] = static_cast<ValueType>(v.imag());
+            }
+        };
+
+        if constexpr (std::ranges::random_access_range<decltype(in)>) {
+            parallelFor(fftSize, 1UZ << 14U, [&](std::size_t begin, std::size_t end, std::size_t) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    load(i, std::ranges::begin(in)[static_cast<std::ptrdiff_t>(i)]);
+                }
+            });
+        } else {
+            std::size_t i = 0UZ;
+            for (const auto& v : in) {
+                load(i++, v);
+            }
+        }
+    }
+
+    static void transpose(const std::vector<ValueType>& srcRe, const std::vector<ValueType>& srcIm, std::vector<ValueType>& dstRe, std::vector<ValueType>& dstIm, std::size_t rows, std::size_t cols, std::size_t rowBegin, std::size_t rowEnd) {
+        detail::forEachTiled(cols, rowBegin, rowEnd, [&](std::size_t r, std::size_t c) {
+            dstRe[c * rows + r] = srcRe[r * cols + c];
+            dstIm[c * rows + r] = srcIm[r * cols + c];
+        });
+    }
+
+    // in: a = x as N1 x N2 matrix (x[N2 * n1 + n2]) -> out: a = X as N1 x N2 matrix (a[N2 * k1 + k2] = X[k1 + N1 * k2])
+    void sixStep() {
+        constexpr std::size_t kRowGrain = 32UZ;
+
+        parallelFor(_n1, kRowGrain, [this](std::size_t begin, std::size_t end, std::size_t) { transpose(_aRe, _aIm, _bRe, _bIm, _n1, _n2, begin, end); });
+
+        parallelFor(_n2, 1UZ, [this](std::size_t begin, std::size_t end, std::size_t slot) { // N1-point FFTs + twiddles W_n^(n2 * k1)
+            Plan& plan = _workers[slot].rows;
+            for (std::size_t n2 = begin; n2 < end; ++n2) {
+                ValueType* rowRe = &_bRe[n2 * _n1];
+                ValueType* rowIm = &_bIm[n2 * _n1];
+                std::copy_n(rowRe, _n1, plan.inputRe().begin());
+                std::copy_n(rowIm, _n1, plan.inputIm().begin());
+                plan.execute();
+                const std::span<const ValueType> fRe = plan.outputRe();
+                const std::span<const ValueType> fIm = plan.outputIm();
+                for (std::size_t k1 = 0UZ; k1 < _n1; ++k1) {
+                    const std::size_t m = n2 * k1;
+                    const Complex     w = _twiddleHi[m / _n1] * _twiddleLo[m % _n1];
+                    rowRe[k1]           = fRe[k1] * w.real() - fIm[k1] * w.imag();
+                    rowIm[k1]           = fRe[k1] * w.imag() + fIm[k1] * w.real();
+                }
+            }
+        });
+
+        parallelFor(_n2, kRowGrain, [this](std::size_t begin, std::size_t end, std::size_t) { transpose(_bRe, _bIm, _aRe, _aIm, _n2, _n1, begin, end); });
+
+        parallelFor(_n1, 1UZ, [this](std::size_t begin, std::size_t end, std::size_t slot) { // N2-point FFTs
+            Plan& plan = _workers[slot].cols;
+            for (std::size_t k1 = begin; k1 < end; ++k1) {
+                std::copy_n(&_aRe[k1 * _n2], _n2, plan.inputRe().begin());
+                std::copy_n(&_aIm[k1 * _n2], _n2, plan.inputIm().begin());
+                plan.execute();
+                std::ranges::copy(plan.outputRe(), &_aRe[k1 * _n2]);
+                std::ranges::copy(plan.outputIm(), &_aIm[k1 * _n2]);
+            }
+        });
+    }
+
+    void storeTransposed(auto& out) {
+        parallelFor(_n1, 32UZ, [this, &out](std::size_t begin, std::size_t end, std::size_t) {
+            detail::forEachTiled(_n2, begin, end, [&](std::size_t k1, std::size_t k2) { out[k1 + _n1 * k2] = TOutput(_aRe[k1 * _n2 + k2], _aIm[k1 * _n2 + k2]); });
+        });
+    }
+
+    // Z = FFT_{N/2}(z) -> X[k] = Fe[k] + W_N^k Fo[k], X[N - k] = conj(X[k]) (see 'FFT::transformReal')
+    void unpackRealSpectrum(auto& out) {
+        parallelFor(_n1, 32UZ, [this](std::size_t begin, std::size_t end, std::size_t) { transpose(_aRe, _aIm, _bRe, _bIm, _n1, _n2, begin, end); }); // -> natural order
+
+        const std::size_t half = _n;
+        parallelFor(half + 1UZ, 1UZ << 14U, [this, &out, half](std::size_t begin, std::size_t end, std::size_t) {
+            for (std::size_t k = begin; k < end; ++k) {
+                const TOutput zk(_bRe[k % half], _bIm[k % half]);
+                const TOutput zc(_bRe[(half - k) % half], -_bIm[(half - k) % half]);
+                const TOutput even = ValueType(0.5) * (zk + zc);
+                const TOutput odd  = TOutput(ValueType(0), ValueType(-0.5)) * (zk - zc);
+                const TOutput xk   = even + _realTwiddles[k] * odd;
+                out[k]             = xk;
+                if (k > 0UZ && k < half) {
+                    out[fftSize - k] = std::conj(xk);
+                }
+            }
+        });
+    }
+};
+
+} // namespace gr::algorithm
+
+#endif // GNURADIO_ALGORITHM_FFT_PARALLEL_HPP
@@ -5,9 +5,16 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <numbers>
+#include <numeric>
 #include <ranges>
+#include <shared_mutex>
+#include <span>
 #include <string_view>
+#include <tuple>
 #include <vector>
 
 #include <format>
@@ -205,6 +212,126 @@ requires std::is_floating_point_v<T>
 template void create<std::vector<float>>(std::vector<float>& container, Type windowFunction, float beta);
 template void create<std::vector<double>>(std::vector<double>& container, Type windowFunction, double beta);
 
+/// coherent gain CG = Σw[i]/n, i.e. the amplitude of a bin-centred sinusoid relative to the rectangular window (amplitude correction: 1/CG)
+template<std::floating_point T>
+[[nodiscard]] constexpr T coherentGain(std::span<const T> window) noexcept {
+    return window.empty() ? T(0) : std::accumulate(window.begin(), window.end(), T(0)) / static_cast<T>(window.size());
+}
+
+/// energy gain EG = Σw[i]²/n, i.e. the power of white noise relative to the rectangular window (power correction: 1/EG)
+template<std::floating_point T>
+[[nodiscard]] constexpr T energyGain(std::span<const T> window) noexcept {
+    return window.empty() ? T(0) : std::transform_reduce(window.begin(), window.end(), window.begin(), T(0)) / static_cast<T>(window.size());
+}
+
+namespace detail {
+template<std::floating_point T>
+struct WindowData {
+    std::vector<T> values;
+    T              coherentGain;
+    T              energyGain;
+};
+
+template<std::floating_point T>
+struct WindowCache {
+    using Key = std::tuple<Type, std::size_t, T>;
+
+    std::shared_mutex                                  mutex;
+    std::map<Key, std::weak_ptr<const WindowData<T>>> entries; // non-owning: windows live as long as their users
+
+    static WindowCache& instance() {
+        static WindowCache cache; // one per precision
+        return cache;
+    }
+};
+} // namespace detail
+
+/**
+ * @brief immutable window function shared between all users of the same (type, size, beta) via the process-wide cache.
+ *
+ * Copies are cheap (reference counted) and the values remain valid as long as any copy exists, independent of the
+ * cache. The coherent and energy gains are computed once together with the window.
+ */
+template<std::floating_point T>
+class SharedWindow {
+    std::shared_ptr<const detail::WindowData<T>> _data;
+
+public:
+    using value_type = T;
+
+    SharedWindow() = default;
+    explicit SharedWindow(std::shared_ptr<const detail::WindowData<T>> data) noexcept : _data(std::move(data)) {}
+
+    [[nodiscard]] std::span<const T> values() const noexcept { return _data ? std::span<const T>(_data->values) : std::span<const T>(); }
+    [[nodiscard]] std::size_t        size() const noexcept { return _data ? _data->values.size() : 0UZ; }
+    [[nodiscard]] bool               empty() const noexcept { return size() == 0UZ; }
+    [[nodiscard]] const T&           operator[](std::size_t index) const noexcept { return _data->values[index]; }
+    [[nodiscard]] auto               begin() const noexcept { return values().begin(); }
+    [[nodiscard]] auto               end() const noexcept { return values().end(); }
+
+    [[nodiscard]] T coherentGain() const noexcept { return _data ? _data->coherentGain : T(0); }
+    [[nodiscard]] T energyGain() const noexcept { return _data ? _data->energyGain : T(0); }
+    /// equivalent noise bandwidth in bins: ENBW = EG/CG² (rectangular: 1, Hann: 1.5)
+    [[nodiscard]] T equivalentNoiseBandwidth() const noexcept { return coherentGain() > T(0) ? energyGain() / (coherentGain() * coherentGain()) : T(0); }
+
+    [[nodiscard]] bool sharesDataWith(const SharedWindow& other) const noexcept { return _data == other._data; }
+};
+
+/**
+ * @brief returns the window of the given type, size and beta from the process-wide, thread-safe cache (one per precision T).
+ *
+ * The window is computed (cf. create(..)) on first use only, subsequent requests -- e.g. by other block instances of
+ * the same configuration -- share the same read-only data without allocation while any user holds it. The cache does
+ * not own the windows: entries no longer referenced are evicted on the next insertion, so that continuous keys (e.g. a
+ * swept Kaiser 'beta') do not accumulate. 'beta' is only part of the key for the Kaiser window.
+ */
+template<std::floating_point T = float>
+[[nodiscard]] SharedWindow<T> cached(Type windowFunction, std::size_t n, T beta = static_cast<T>(1.6)) {
+    auto& cache = detail::WindowCache<T>::instance();
+
+    const typename detail::WindowCache<T>::Key key{windowFunction, n, windowFunction == Type::Kaiser ? beta : T(0)};
+    {
+        std::shared_lock lock(cache.mutex);
+        if (auto it = cache.entries.find(key); it != cache.entries.end()) {
+            if (auto data = it->second.lock()) {
+                return SharedWindow<T>(std::move(data));
+            }
+        }
+    }
+
+    std::vector<T> values(n); // computed outside the lock, N.B. may throw for invalid parameters
+    create(values, windowFunction, beta);
+    const T cg   = coherentGain<T>(values);
+    const T eg   = energyGain<T>(values);
+    auto    data = std::make_shared<const detail::WindowData<T>>(detail::WindowData<T>{std::move(values), cg, eg});
+
+    std::unique_lock lock(cache.mutex);
+    std::erase_if(cache.entries, [](const auto& entry) { return entry.second.expired(); });
+    if (auto [it, inserted] = cache.entries.try_emplace(key, data); !inserted) {
+        if (auto existing = it->second.lock()) {
+            return SharedWindow<T>(std::move(existing)); // concurrent first users: the first insertion wins
+        }
+        it->second = data; // expired after the eviction above
+    }
+    return SharedWindow<T>(std::move(data));
+}
+
+/// number of entries presently held by the cache of precision T (referenced windows and not yet evicted expired ones)
+template<std::floating_point T = float>
+[[nodiscard]] std::size_t cacheSize() {
+    auto&            cache = detail::WindowCache<T>::instance();
+    std::shared_lock lock(cache.mutex);
+    return cache.entries.size();
+}
+
+/// evicts the entries of windows that are no longer referenced (of precision T), N.B. also done on every insertion
+template<std::floating_point T = float>
+void purgeCache() {
+    auto&            cache = detail::WindowCache<T>::instance();
+    std::unique_lock lock(cache.mutex);
+    std::erase_if(cache.entries, [](const auto& entry) { return entry.second.expired(); });
+}
+
 } // namespace gr::algorithm::window
 
 #endif // GNURADIO_ALGORITHM_WINDOW_HPP
@@ -9,7 +9,9 @@
 #include <vector>
 
 #include <gnuradio-4.0/algorithm/ImChart.hpp>
+#include <gnuradio-4.0/algorithm/filter/BlockParallelFilter.hpp>
 #include <gnuradio-4.0/algorithm/filter/FilterTool.hpp>
+#include <gnuradio-4.0/algorithm/filter/MultiChannelFilter.hpp>
 #include <gnuradio-4.0/meta/UnitTestHelper.hpp>
 #include <gnuradio-4.0/meta/formatter.hpp>
 
@@ -574,6 +576,28 @@ const boost::ut::suite<"FIR FilterTool"> firFilterToolTests = [] {
 
         expect(nothrow([&] { chart.draw(); }));
     };
+
+    "CIC compensation FIR"_test = [] {
+        constexpr std::size_t order     = 4UZ;
+        constexpr std::size_t diffDelay = 1UZ;
+        constexpr std::size_t rate      = 64UZ;
+        constexpr double      fPass     = 0.2;
+
+        const FilterCoefficients<double> compensator = fir::designCicCompensator<double>(order, diffDelay, rate, 31UZ, fPass);
+        expect(eq(compensator.b.size(), 31UZ));
+        expect(std::ranges::equal(compensator.b, std::views::reverse(compensator.b))) << "linear phase requires symmetric taps";
+
+        expect(gt(1.0 - fir::cicMagnitude(fPass, order, diffDelay, rate), 0.2)) << "uncompensated CIC droop at the pass-band edge";
+        for (double f = 0.0; f <= fPass; f += 0.01) {
+            const double combined = fir::cicMagnitude(f, order, diffDelay, rate) * calculateResponse<Normalised, Magnitude>(f, compensator);
+            expect(approx(combined, 1.0, 1e-3)) << std::format("compensated pass-band not flat at f = {}: {}", f, combined);
+        }
+        expect(lt(calculateResponse<Normalised, Magnitude>(0.45, compensator), 0.01)) << "compensator should attenuate the stop-band";
+
+        expect(throws<std::invalid_argument>([] { std::ignore = fir::designCicCompensator<double>(order, diffDelay, rate, 30UZ, fPass); })) << "even number of taps";
+        expect(throws<std::invalid_argument>([] { std::ignore = fir::designCicCompensator<double>(order, diffDelay, rate, 31UZ, 0.5); })) << "pass-band edge at Nyquist";
+        expect(throws<std::invalid_argument>([] { std::ignore = fir::designCicCompensator<double>(0UZ, diffDelay, rate, 31UZ, fPass); })) << "zero order";
+    };
 };
 
 const boost::ut::suite<"2nd-order resonator"> _resonsatorTests = [] {
@@ -723,6 +747,160 @@ const boost::ut::suite<"2nd-order resonator"> _resonsatorTests = [] {
     };
 };
 
+const boost::ut::suite<"multi-channel filter"> _multiChannelFilterTests = [] {
+    using namespace boost::ut;
+    using namespace gr::filter;
+
+    "MultiChannelFilter vs. per-channel Filter"_test = []<typename T>(T) {
+        constexpr double      fs        = 1000.;
+        constexpr std::size_t nChannels = 5UZ; // N.B. not a multiple of the SIMD width -> tests lane padding
+        constexpr std::size_t nSamples  = 2000UZ;
+        const T               tolerance = std::is_same_v<T, float> ? T(1e-4f) : T(1e-10);
+
+        std::vector<std::vector<FilterCoefficients<T>>> channelSections;
+        std::vector<Filter<T>>                          reference;
+        for (std::size_t ch = 0UZ; ch < nChannels; ++ch) { // same structure, individual cut-off frequency per channel
+            channelSections.push_back(iir::designFilter<T>(Type::LOWPASS, FilterParameters{.order = 4UZ, .fLow = 20. + 10. * static_cast<double>(ch), .fs = fs}));
+            reference.emplace_back(channelSections.back());
+        }
+
+        std::vector<std::vector<T>> input(nChannels, std::vector<T>(nSamples));
+        for (std::size_t ch = 0UZ; ch < nChannels; ++ch) {
+            for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                input[ch][i] = static_cast<T>(std::sin(2. * std::numbers::pi * (5. + 7. * static_cast<double>(ch)) * static_cast<double>(i) / fs) + (i % 17UZ == 0UZ ? 1. : 0.));
+            }
+        }
+        std::vector<std::vector<T>> expected = input;
+        for (std::size_t ch = 0UZ; ch < nChannels; ++ch) {
+            std::ranges::transform(input[ch], expected[ch].begin(), [&filter = reference[ch]](T x) { return filter.processOne(x); });
+        }
+
+        const auto compare = [&](const std::vector<std::vector<T>>& actual, std::string_view api) {
+            for (std::size_t ch = 0UZ; ch < nChannels; ++ch) {
+                const T maxDiff = std::transform_reduce(actual[ch].cbegin(), actual[ch].cend(), expected[ch].cbegin(), T(0), [](T a, T b) { return std::max(a, b); }, [](T a, T b) { return std::abs(a - b); });
+                expect(le(maxDiff, tolerance)) << std::format("{}: channel {} max deviation {}", api, ch, maxDiff);
+            }
+        };
+
+        MultiChannelFilter<T> filter(channelSections);
+        expect(eq(filter.nChannels(), nChannels));
+        expect(eq(filter.nLanes() % vir::stdx::native_simd<T>::size(), 0UZ));
+
+        { // processOne(..): one sample per channel
+            std::vector<std::vector<T>> actual = input;
+            std::vector<T>              frame(nChannels);
+            for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                std::ranges::transform(input, frame.begin(), [i](const auto& channel) { return channel[i]; });
+                filter.processOne(frame, frame);
+                for (std::size_t ch = 0UZ; ch < nChannels; ++ch) {
+                    actual[ch][i] = frame[ch];
+                }
+            }
+            compare(actual, "processOne");
+        }
+
+        filter.reset();
+        { // processBlock(..): planar, in-place and split into uneven chunks
+            std::vector<std::vector<T>> actual = input;
+            for (std::size_t offset = 0UZ; offset < nSamples;) {
+                const std::size_t               nChunk = std::min(nSamples - offset, 1UZ + offset % 333UZ);
+                std::vector<std::span<const T>> in;
+                std::vector<std::span<T>>       out;
+                for (auto& channel : actual) {
+                    in.emplace_back(std::span<const T>(channel).subspan(offset, nChunk));
+                    out.emplace_back(std::span<T>(channel).subspan(offset, nChunk));
+                }
+                filter.processBlock(in, out);
+                offset += nChunk;
+            }
+            compare(actual, "processBlock(planar)");
+        }
+
+        filter.reset();
+        { // processBlock(..): interleaved frames
+            std::vector<T> interleaved(nSamples * nChannels);
+            for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                for (std::size_t ch = 0UZ; ch < nChannels; ++ch) {
+                    interleaved[i * nChannels + ch] = input[ch][i];
+                }
+            }
+            filter.processBlock(interleaved, interleaved);
+            std::vector<std::vector<T>> actual = input;
+            for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                for (std::size_t ch = 0UZ; ch < nChannels; ++ch) {
+                    actual[ch][i] = interleaved[i * nChannels + ch];
+                }
+            }
+            compare(actual, "processBlock(interleaved)");
+        }
+    } | std::tuple<double, float>{1.0, 1.0f};
+
+    "MultiChannelFilter - replicated FIR and pass-through"_test = [] {
+        const auto fir = fir::designFilter<double>(Type::LOWPASS, FilterParameters{.order = 4UZ, .fLow = 50., .attenuationDb = 40., .fs = 1000.});
+
+        MultiChannelFilter<double> filter(3UZ, fir);
+        Filter<double>             reference(fir);
+        std::array<double, 3UZ>    frame{};
+        for (std::size_t i = 0UZ; i < 500UZ; ++i) {
+            const double x = std::cos(0.05 * static_cast<double>(i));
+            frame.fill(x);
+            filter.processOne(frame, frame);
+            const double y = reference.processOne(x);
+            expect(approx(frame[0], y, 1e-12) && approx(frame[2], y, 1e-12)) << std::format("sample {}: {} vs. {}", i, frame[0], y);
+        }
+
+        MultiChannelFilter<float> passThrough(1UZ, FilterCoefficients<float>{.b = {1}, .a = {1}});
+        expect(eq(passThrough.processOne(42.f), 42.f));
+    };
+
+    "MultiChannelFilter - structure mismatch"_test = [] {
+        std::vector<std::vector<FilterCoefficients<double>>> channelSections;
+        channelSections.push_back(iir::designFilter<double>(Type::LOWPASS, FilterParameters{.order = 4UZ, .fLow = 20., .fs = 1000.}));
+        channelSections.push_back(iir::designFilter<double>(Type::LOWPASS, FilterParameters{.order = 2UZ, .fLow = 20., .fs = 1000.}));
+        expect(throws<std::invalid_argument>([&] { std::ignore = MultiChannelFilter<double>(channelSections); }));
+    };
+
+    "BlockParallelFilter vs. serial Filter"_test = []<typename T>(T) {
+        constexpr double      fs        = 1000.;
+        constexpr std::size_t nSamples  = 40'000UZ; // N.B. > several 'nSegments() x segmentLength()' super-blocks for all SIMD widths
+        const T               tolerance = std::is_same_v<T, float> ? T(1e-4f) : T(1e-10);
+
+        std::vector<T> input(nSamples);
+        for (std::size_t i = 0UZ; i < nSamples; ++i) {
+            input[i] = static_cast<T>(std::sin(2. * std::numbers::pi * 7. * static_cast<double>(i) / fs) + (i % 61UZ == 0UZ ? 1. : 0.));
+        }
+
+        for (std::size_t order : {2UZ, 4UZ, 8UZ, 12UZ}) {
+            const auto sections = iir::designFilter<T>(Type::LOWPASS, FilterParameters{.order = order, .fLow = 50., .fs = fs});
+
+            Filter<T>      reference(sections);
+            std::vector<T> expected(nSamples);
+            std::ranges::transform(input, expected.begin(), [&reference](T x) { return reference.processOne(x); });
+            const T amplitude = std::ranges::max(expected | std::views::transform([](T y) { return std::abs(y); }));
+
+            BlockParallelFilter<T> filter(sections);
+            filter.setProcessing(Processing::BlockParallel);
+            expect(filter.processing() == Processing::BlockParallel);
+            expect(throws<std::invalid_argument>([&] { filter.setProcessing(Processing::BlockParallel, 0UZ); }));
+            filter.setProcessing(Processing::BlockParallel);
+
+            std::vector<T> actual = input;
+            for (std::size_t offset = 0UZ; offset < nSamples;) { // in-place, uneven chunks incl. partial super-blocks and processOne(..)
+                const std::size_t nChunk = std::min(nSamples - offset, 1UZ + (offset * 7919UZ) % 9000UZ);
+                if (nChunk == 1UZ) {
+                    actual[offset] = filter.processOne(actual[offset]);
+                } else {
+                    filter.processBlock(std::span<const T>(actual).subspan(offset, nChunk), std::span<T>(actual).subspan(offset, nChunk));
+                }
+                offset += nChunk;
+            }
+
+            const T maxDiff = std::transform_reduce(actual.cbegin(), actual.cend(), expected.cbegin(), T(0), [](T a, T b) { return std::max(a, b); }, [](T a, T b) { return std::abs(a - b); });
+            expect(le(maxDiff, tolerance * amplitude)) << std::format("{} order {}: max deviation {} (amplitude {})", gr::meta::type_name<T>(), order, maxDiff, amplitude);
+        }
+    } | std::tuple<double, float>{1.0, 1.0f};
+};
+
 const boost::ut::suite<"IIR & FIR Benchmarks"> filterBenchmarks = [] {
     using namespace boost::ut;
     using namespace gr::filter;
@@ -905,6 +1083,25 @@ const boost::ut::suite<"IIR & FIR Benchmarks"> filterBenchmarks = [] {
             expect(approx(actualGain, static_cast<T>(1), static_cast<T>(0.1))) << std::format("IIR approx settling gain threshold for {}", gr::meta::type_name<T>());
         }
         ::benchmark::results::add_separator();
+        {
+            constexpr std::size_t       nChannels = 8UZ;
+            std::vector<std::vector<T>> channels(nChannels, yValues);
+            std::vector<Filter<T>>      filters(nChannels, Filter<T>(digitalBandPass));
+            ::benchmark::benchmark<10>(std::format("IIR {} x Filter<T>", nChannels), nChannels * nSamples) = [&filters, &channels] {
+                for (std::size_t ch = 0UZ; ch < nChannels; ++ch) {
+                    std::ranges::transform(channels[ch], channels[ch].begin(), [&filter = filters[ch]](T x) { return filter.processOne(x); });
+                }
+            };
+        }
+        {
+            constexpr std::size_t           nChannels = 8UZ;
+            std::vector<std::vector<T>>     channels(nChannels, yValues);
+            std::vector<std::span<const T>> in(channels.begin(), channels.end());
+            std::vector<std::span<T>>       out(channels.begin(), channels.end());
+            MultiChannelFilter<T>           filter(nChannels, digitalBandPass);
+            ::benchmark::benchmark<10>(std::format("IIR MultiChannelFilter<T>({})", nChannels), nChannels * nSamples) = [&filter, &in, &out] { filter.processBlock(in, out); };
+        }
+        ::benchmark::results::add_separator();
     } | std::tuple<double, float>{1.0, 1.0f};
 };
 
@@ -1,6 +1,8 @@
 #include <boost/ut.hpp>
 
 #include <format>
+#include <numbers>
+#include <span>
 #include <vector>
 
 #include <gnuradio-4.0/algorithm/SchmittTrigger.hpp>
@@ -58,6 +60,55 @@ void test_schmitt_trigger_with_signal(Trigger& trigger, const std::vector<T>& si
             << std::format("{}: detected edge ({}): is {} vs. expected {}\n", fullTestName, i, gr::value(detected_index), gr::value(expected_index));
     }
 }
+
+template<typename T, gr::trigger::InterpolationMethod Method>
+void test_pre_scan_equivalence(double scale) {
+    using namespace boost::ut;
+    using enum gr::trigger::EdgeDetection;
+    using value_t = gr::meta::fundamental_base_value_type_t<T>;
+
+    // slow sine with small deterministic noise: long quiet stretches interleaved with noisy threshold crossings
+    std::vector<double> raw(20'000UZ);
+    std::uint32_t       lcg = 42U;
+    for (std::size_t i = 0UZ; i < raw.size(); ++i) {
+        lcg    = lcg * 1664525U + 1013904223U;
+        raw[i] = scale * (0.5 + 0.45 * std::sin(2.0 * std::numbers::pi * static_cast<double>(i) / 997.0) + 0.02 * (static_cast<double>(lcg >> 8U) / double(1U << 24U) - 0.5));
+    }
+    const std::vector<T> signal = convert_signal<T>(raw);
+
+    SchmittTrigger<T, Method> reference(static_cast<value_t>(0.1 * scale) /* threshold */, static_cast<value_t>(0.5 * scale) /* offset */);
+    SchmittTrigger<T, Method> preScan(static_cast<value_t>(0.1 * scale) /* threshold */, static_cast<value_t>(0.5 * scale) /* offset */);
+
+    using Edge = std::tuple<EdgeDetection, std::ptrdiff_t, float, float>;
+    std::vector<Edge> referenceEdges;
+    std::vector<Edge> preScanEdges;
+    for (std::size_t i = 0UZ; i < signal.size(); ++i) {
+        if (reference.processOne(signal[i]) != NONE) {
+            referenceEdges.emplace_back(reference.lastEdge, static_cast<std::ptrdiff_t>(i) + reference.lastEdgeIdx, gr::value(reference.lastEdgeOffset), gr::uncertainty(reference.lastEdgeOffset));
+        }
+    }
+
+    std::size_t chunkSize = 1UZ; // varying chunk sizes to exercise the SIMD/scalar boundaries
+    for (std::size_t chunkStart = 0UZ; chunkStart < signal.size(); chunkStart += chunkSize, chunkSize = (chunkSize * 7UZ) % 251UZ + 1UZ) {
+        const std::size_t chunkEnd = std::min(signal.size(), chunkStart + chunkSize);
+        for (std::size_t i = chunkStart; i < chunkEnd; ++i) {
+            i += preScan.skipQuietSamples(std::span(signal).subspan(i, chunkEnd - i));
+            if (i < chunkEnd && preScan.processOne(signal[i]) != NONE) {
+                preScanEdges.emplace_back(preScan.lastEdge, static_cast<std::ptrdiff_t>(i) + preScan.lastEdgeIdx, gr::value(preScan.lastEdgeOffset), gr::uncertainty(preScan.lastEdgeOffset));
+            }
+        }
+    }
+
+    expect(ge(referenceEdges.size(), 20UZ)) << "test signal should contain edges";
+    expect(eq(preScanEdges.size(), referenceEdges.size()));
+    expect(preScanEdges == referenceEdges) << std::format("pre-scan edges differ for {}", gr::meta::type_name<T>());
+    expect(eq(preScan.lastEdgeIdx, reference.lastEdgeIdx));
+    expect(eq(preScan.accumulatedSamples, reference.accumulatedSamples));
+    expect(eq(preScan._historyBuffer.size(), reference._historyBuffer.size()));
+    for (std::size_t i = 0UZ; i < reference._historyBuffer.size(); ++i) {
+        expect(gr::value(preScan._historyBuffer[i]) == gr::value(reference._historyBuffer[i])) << std::format("history buffer differs at {}", i);
+    }
+}
 } // namespace
 
 const suite<"SchmittTrigger"> SchmittTriggerTests = [] {
@@ -190,6 +241,13 @@ const suite<"SchmittTrigger"> SchmittTriggerTests = [] {
                 {{RISING, 0.5f}, {FALLING, 1.5f}, {RISING, 2.625f}});
         };
     } | std::tuple<uint8_t, int16_t>{};
+
+    "SIMD pre-scan yields identical edges"_test = []<typename T>() {
+        const double scale = std::is_floating_point_v<gr::meta::fundamental_base_value_type_t<T>> ? 1.0 : 1000.0;
+        test_pre_scan_equivalence<T, NO_INTERPOLATION>(scale);
+        test_pre_scan_equivalence<T, BASIC_LINEAR_INTERPOLATION>(scale);
+        test_pre_scan_equivalence<T, LINEAR_INTERPOLATION>(scale);
+    } | std::tuple<float, double, std::int16_t, std::int32_t, gr::UncertainValue<float>>{};
 };
 
 int main() { /* not needed for UT */ }
@@ -1,8 +1,13 @@
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <cmath>
+#include <complex>
 #include <format>
 #include <numbers>
 #include <numeric>
+#include <thread>
+#include <vector>
 
 #include <boost/ut.hpp>
 
@@ -10,6 +15,7 @@
 
 #include <gnuradio-4.0/algorithm/fourier/fft.hpp>
 #include <gnuradio-4.0/algorithm/fourier/fft_common.hpp>
+#include <gnuradio-4.0/algorithm/fourier/fft_parallel.hpp>
 #include <gnuradio-4.0/algorithm/fourier/fftw.hpp>
 
 template<typename T>
@@ -152,6 +158,84 @@ const boost::ut::suite<"FFT algorithms and window functions"> windowTests = [] {
         }
     } | ComplexTypesToTest{};
 
+    "FFT native mixed-radix, real-input and Bluestein paths"_test = []<typename T>() {
+        using InType    = typename T::InType;
+        using OutType   = typename T::OutType;
+        using ValueType = typename OutType::value_type;
+        constexpr double tolerance{std::is_same_v<ValueType, float> ? 1e-4 : 1e-10}; // relative to N
+
+        typename T::AlgoType fftAlgo{};
+        for (std::size_t N : {1UZ, 2UZ, 3UZ, 5UZ, 6UZ, 8UZ, 12UZ, 15UZ, 30UZ, 60UZ, 64UZ, 120UZ, 125UZ, 1000UZ, 1024UZ, 1536UZ /* mixed-radix */, 7UZ, 14UZ, 1009UZ /* Bluestein */}) {
+            std::vector<InType> signal(N);
+            for (std::size_t i = 0UZ; i < N; ++i) {
+                const double re = std::sin(0.37 * static_cast<double>(i)) + 0.25 * static_cast<double>(i % 3UZ);
+                if constexpr (gr::meta::complex_like<InType>) {
+                    signal[i] = InType(static_cast<typename InType::value_type>(re), static_cast<typename InType::value_type>(std::cos(0.11 * static_cast<double>(i))));
+                } else {
+                    signal[i] = static_cast<InType>(re);
+                }
+            }
+
+            const auto fftResult = fftAlgo.compute(signal);
+            expect(eq(fftResult.size(), N)) << std::format("<{}> N={} full spectrum", type_name<T>(), N);
+
+            double maxError = 0.;
+            for (std::size_t k = 0UZ; k < N; ++k) { // naive DFT reference
+                std::complex<double> expected{};
+                for (std::size_t i = 0UZ; i < N; ++i) {
+                    const std::complex<double> x = [&] {
+                        if constexpr (gr::meta::complex_like<InType>) {
+                            return std::complex<double>(static_cast<double>(signal[i].real()), static_cast<double>(signal[i].imag()));
+                        } else {
+                            return std::complex<double>(static_cast<double>(signal[i]), 0.);
+                        }
+                    }();
+                    expected += x * std::polar(1., -2. * std::numbers::pi * static_cast<double>((i * k) % N) / static_cast<double>(N));
+                }
+                maxError = std::max(maxError, std::abs(expected - std::complex<double>(static_cast<double>(fftResult[k].real()), static_cast<double>(fftResult[k].imag()))));
+            }
+            expect(lt(maxError, tolerance * static_cast<double>(std::max(N, 1UZ)))) << std::format("<{}> N={} max deviation from DFT: {}", type_name<T>(), N, maxError);
+        }
+    } | std::tuple<TestTypes<std::complex<float>, std::complex<float>, FFT>, TestTypes<std::complex<double>, std::complex<double>, FFT>, TestTypes<float, std::complex<float>, FFT>, TestTypes<double, std::complex<double>, FFT>>{};
+
+    "FFTParallel six-step vs. single-threaded FFT"_test = []<typename T>() {
+        using InType    = typename T::InType;
+        using OutType   = typename T::OutType;
+        using ValueType = typename OutType::value_type;
+        constexpr double tolerance{std::is_same_v<ValueType, float> ? 1e-5 : 1e-12}; // relative to the spectrum peak
+
+        for (std::size_t nThreads : {1UZ, 3UZ}) {
+            gr::algorithm::FFTParallel<InType, OutType> parallelFft;
+            parallelFft.nThreads = nThreads;
+            gr::algorithm::FFT<InType, OutType> referenceFft;
+
+            for (std::size_t N : {16UZ, 60UZ, 1000UZ, 4096UZ, 6000UZ, 65536UZ /* six-step */, 7UZ, 1009UZ /* fallback */}) {
+                std::vector<InType> signal(N);
+                for (std::size_t i = 0UZ; i < N; ++i) {
+                    const auto re = static_cast<ValueType>(std::sin(0.37 * static_cast<double>(i)) + 0.25 * static_cast<double>(i % 3UZ));
+                    if constexpr (gr::meta::complex_like<InType>) {
+                        signal[i] = InType(re, static_cast<ValueType>(std::cos(0.11 * static_cast<double>(i))));
+                    } else {
+                        signal[i] = re;
+                    }
+                }
+
+                const auto parallelResult  = parallelFft.compute(signal);
+                const auto referenceResult = referenceFft.compute(signal);
+                expect(eq(parallelResult.size(), N)) << fatal;
+
+                double maxError = 0.;
+                double maxValue = 1.;
+                for (std::size_t k = 0UZ; k < N; ++k) {
+                    maxError = std::max(maxError, static_cast<double>(std::abs(parallelResult[k] - referenceResult[k])));
+                    maxValue = std::max(maxValue, static_cast<double>(std::abs(referenceResult[k])));
+                }
+                expect(lt(maxError, tolerance * maxValue)) << std::format("<{}> N={} nThreads={} max deviation: {}", type_name<T>(), N, nThreads, maxError);
+                expect(eq(gr::algorithm::FFTParallel<InType, OutType>::isSupported(N), N != 7UZ && N != 1009UZ));
+            }
+        }
+    } | std::tuple<TestTypes<std::complex<float>, std::complex<float>, FFT>, TestTypes<std::complex<double>, std::complex<double>, FFT>, TestTypes<float, std::complex<float>, FFT>, TestTypes<double, std::complex<double>, FFT>>{};
+
     "Unwrap Phase tests"_test = [] {
         std::vector<double> phase = {0.2, -1., 2.5, -3.1, 0.9, -0.5, 1.2, 0.8, 1.5, -1.2, -2.7, 0.9, -0.8, -1.4, 0.6, 1.1, -1.9, 0.4, 1.3, -0.7};
         // Output generated with python numpy.unwrap(phase)
@@ -244,6 +328,55 @@ const boost::ut::suite<"FFT algorithms and window functions"> windowTests = [] {
         expect(throws<std::invalid_argument>([] { std::ignore = create(gr::algorithm::window::Type::Kaiser, 1); })) << "invalid Kaiser window size";
         expect(throws<std::invalid_argument>([] { std::ignore = create(gr::algorithm::window::Type::Kaiser, 2, -1.f); })) << "invalid Kaiser window beta";
     } | std::tuple<float, double>();
+
+    "window cache"_test = []<typename T>() {
+        using namespace gr::algorithm::window;
+
+        const SharedWindow<T> hann = cached<T>(Type::Hann, 1024UZ);
+        expect(std::ranges::equal(hann.values(), create<T>(Type::Hann, 1024UZ))) << "cached window equals created window";
+        expect(hann.sharesDataWith(cached<T>(Type::Hann, 1024UZ))) << "same key shares the same data";
+        expect(hann.sharesDataWith(cached<T>(Type::Hann, 1024UZ, T(8)))) << "beta is not part of the key for non-Kaiser windows";
+        expect(not hann.sharesDataWith(cached<T>(Type::Hann, 512UZ))) << "different size";
+        expect(not hann.sharesDataWith(cached<T>(Type::Hamming, 1024UZ))) << "different type";
+        expect(not cached<T>(Type::Kaiser, 64UZ, T(2)).sharesDataWith(cached<T>(Type::Kaiser, 64UZ, T(6)))) << "beta is part of the Kaiser key";
+
+        // gains: rectangular 1, 1 and symmetric Hann ~ 1/2, 3/8 (ENBW = 1.5 bins) for large n
+        const SharedWindow<T> rectangular = cached<T>(Type::Rectangular, 1024UZ);
+        expect(approx(rectangular.coherentGain(), T(1), T(1e-6)));
+        expect(approx(rectangular.energyGain(), T(1), T(1e-6)));
+        expect(approx(hann.coherentGain(), T(0.5), T(1e-3)));
+        expect(approx(hann.energyGain(), T(0.375), T(1e-3)));
+        expect(approx(hann.equivalentNoiseBandwidth(), T(1.5), T(1e-2)));
+        expect(approx(hann.coherentGain(), coherentGain(hann.values()), T(1e-6)));
+
+        // concurrent first use of a new key yields one shared instance
+        std::vector<SharedWindow<T>> results(8UZ);
+        std::vector<std::thread>     threads;
+        for (auto& result : results) {
+            threads.emplace_back([&result] { result = cached<T>(Type::Kaiser, 4096UZ, T(7)); });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        expect(std::ranges::all_of(results, [&](const auto& window) { return window.sharesDataWith(results.front()); }));
+
+        // the cache does not own the windows: unreferenced entries are evicted, e.g. for a continuously swept Kaiser beta
+        purgeCache<T>();
+        const std::size_t nReferenced = cacheSize<T>();
+        expect(ge(nReferenced, 3UZ)) << "hann, rectangular and the concurrent Kaiser window are referenced";
+        for (std::size_t i = 0UZ; i < 100UZ; ++i) {
+            std::ignore = cached<T>(Type::Kaiser, 64UZ, T(1) + static_cast<T>(i) / T(100));
+            expect(le(cacheSize<T>(), nReferenced + 1UZ)) << "at most the last unreferenced window is retained";
+        }
+        const SharedWindow<T> kaiser = cached<T>(Type::Kaiser, 64UZ, T(2));
+        expect(std::ranges::equal(kaiser.values(), create<T>(Type::Kaiser, 64UZ, T(2)))) << "evicted windows are recomputed on demand";
+        purgeCache<T>();
+        expect(eq(cacheSize<T>(), nReferenced + 1UZ));
+        expect(hann.sharesDataWith(cached<T>(Type::Hann, 1024UZ))) << "referenced windows stay shared";
+        expect(eq(hann.size(), 1024UZ));
+
+        expect(throws<std::invalid_argument>([] { std::ignore = cached<T>(Type::Kaiser, 1UZ); })) << "invalid parameters are not cached";
+    } | std::tuple<float, double>();
 };
 
 int main() { /* not needed for UT */ }
@@ -6,7 +6,9 @@
 #include <chrono>
 #include <cmath>
 #include <cstring>
+#include <ctime>
 #include <format>
+#include <fstream>
 #include <iostream>
 #include <map>
 #include <mutex>
@@ -15,6 +17,7 @@
 #include <ranges>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <variant>
 
@@ -28,6 +31,11 @@
 #include <unistd.h>
 #endif
 
+#if __has_include(<sys/resource.h>)
+#include <sys/resource.h>
+#define HAS_POSIX_RESOURCE_HEADER
+#endif
+
 namespace benchmark {
 #if defined(__GNUC__) || defined(__clang__)
 #define BENCHMARK_ALWAYS_INLINE [[gnu::always_inline]] inline
@@ -521,6 +529,17 @@ public:
 
 namespace utils {
 
+/// @return voluntary + involuntary context switches of the calling process (0 if not supported), fallback if perf counters are not accessible
+[[nodiscard]] inline uint64_t process_context_switches() noexcept {
+#ifdef HAS_POSIX_RESOURCE_HEADER
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return static_cast<uint64_t>(usage.ru_nvcsw) + static_cast<uint64_t>(usage.ru_nivcsw);
+    }
+#endif
+    return 0U;
+}
+
 template<std::size_t N, typename T>
 requires(N > 0)
 constexpr std::vector<T> diff(const std::vector<time_point>& stop, time_point start) {
@@ -732,7 +751,9 @@ public:
             auto                    marker_iter = get_marker_array<TestFunction, N_ITERATIONS>();
 
             PerformanceCounter execMetrics;
-            const auto         start = time_point().now();
+            const uint64_t     ctxSwitchStart = utils::process_context_switches();
+            const std::clock_t cpuStart       = std::clock();
+            const auto         start          = time_point().now();
 
             if constexpr (N_ITERATIONS == 1) {
                 if constexpr (std::invocable<TestFunction>) {
@@ -755,6 +776,7 @@ public:
             }
             // N.B. need to retrieve CPU performance count here no to spoil the result by further
             // post-processing
+            const std::clock_t cpuStop = std::clock();
 
             if (PerformanceCounter::available()) {
                 const perf_metric perf_data = execMetrics.results();
@@ -762,6 +784,11 @@ public:
                 result_map.try_emplace("CPU branch misses", perf_data.branch, "", 0);
                 result_map.try_emplace("<CPU-I>", static_cast<double>(perf_data.instructions) / static_cast<double>(N_ITERATIONS * _n_scale_results), "", std::max(1, _precision));
                 result_map.try_emplace("CTX-SW", perf_data.ctx_switches, "", 0);
+            } else if (const uint64_t ctxSwitchStop = utils::process_context_switches(); ctxSwitchStop > 0U) {
+                result_map.try_emplace("CTX-SW", ctxSwitchStop - ctxSwitchStart, "", 0);
+            }
+            if (cpuStart != static_cast<std::clock_t>(-1) && cpuStop != static_cast<std::clock_t>(-1)) { // process CPU time summed over all threads
+                result_map.try_emplace("CPU time", static_cast<long double>(cpuStop - cpuStart) / static_cast<long double>(CLOCKS_PER_SEC), "s", _precision);
             }
             // not time-critical post-processing starts here
             const auto        time_differences_ns = utils::diff<N_ITERATIONS, long double>(stop_iter, start);
@@ -904,10 +931,81 @@ public:
             std::cout << _printer.colors().pass << "all micro-benchmarks passed:\n" << _printer.colors().none;
         }
         print();
+        if (const char* jsonPath = std::getenv("BM_JSON"); jsonPath != nullptr) { // machine-readable output, e.g. for tracking regressions between releases
+            if (std::string_view(jsonPath) == "-") {
+                print_json(std::cout);
+            } else if (std::ofstream file(jsonPath); file) {
+                print_json(file);
+            } else {
+                std::cerr << std::format("BM_JSON: could not open '{}' for writing", jsonPath) << std::endl;
+            }
+        }
         std::cerr.flush();
         std::cout.flush();
     }
 
+    /**
+     * writes all results as JSON: {"context": {...}, "benchmarks": [{"name": "...", "status": "PASS|FAIL|SKIP", "metrics": {"<key>": {"value": .., "unit": ".."}}}]}
+     * N.B. values are in SI base units (e.g. seconds), perf sub-metrics are written as {"misses": .., "total": .., "ratio": ..}
+     */
+    static void print_json(std::ostream& os) {
+        const auto escape = [](std::string_view str) {
+            std::string ret;
+            ret.reserve(str.size());
+            for (const char c : str) {
+                switch (c) {
+                case '"': ret += "\\\""; break;
+                case '\\': ret += "\\\\"; break;
+                case '\n': ret += "\\n"; break;
+                case '\t': ret += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        ret += std::format("\\u{:04x}", static_cast<unsigned>(c));
+                    } else {
+                        ret += c;
+                    }
+                }
+            }
+            return ret;
+        };
+        const auto value_to_json = [](const auto& value) -> std::string {
+            if (std::holds_alternative<long double>(value)) {
+                const long double v = std::get<long double>(value);
+                return std::isfinite(v) ? std::format("{}", static_cast<double>(v)) : "null";
+            } else if (std::holds_alternative<uint64_t>(value)) {
+                return std::format("{}", std::get<uint64_t>(value));
+            } else if (std::holds_alternative<benchmark::perf_sub_metric>(value)) {
+                const auto stat = std::get<benchmark::perf_sub_metric>(value);
+                return std::format(R"({{"misses": {}, "total": {}, "ratio": {}}})", stat.misses, stat.total, std::isfinite(stat.ratio) ? stat.ratio : 0.0);
+            }
+            return "null";
+        };
+
+        const auto timestamp = std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now());
+        os << std::format(R"({{"context": {{"date": "{:%FT%TZ}", "hardware_concurrency": {}, "perf_counter": {}}}, "benchmarks": [)", timestamp, std::thread::hardware_concurrency(), PerformanceCounter::available());
+        bool first = true;
+        for (const auto& [test_name, result_map] : benchmark::results::data()) {
+            if (test_name.empty() && result_map.empty()) {
+                continue; // separator
+            }
+            const std::string_view status = result_map.empty() ? "SKIP" : (result_map.size() == 1 ? "FAIL" : "PASS");
+            os << std::format(R"({}{{"name": "{}", "status": "{}", "metrics": {{)", first ? "\n  " : ",\n  ", escape(test_name), status);
+            bool firstMetric = true;
+            for (const auto& [metric_key, metric] : result_map) {
+                const auto& [value, unit, digits] = metric;
+                if (std::holds_alternative<std::monostate>(value)) {
+                    continue;
+                }
+                os << std::format(R"({}"{}": {{"value": {}, "unit": "{}"}})", firstMetric ? "" : ", ", escape(metric_key), value_to_json(value), escape(unit));
+                firstMetric = false;
+            }
+            os << "}}";
+            first = false;
+        }
+        os << "\n]}\n";
+        os.flush();
+    }
+
     template<std::size_t SIGNIFICANT_DIGITS = 3>
     static void print() {
         const auto& data = benchmark::results::data();
@@ -5,6 +5,7 @@
 #include <gnuradio-4.0/BlockRegistry.hpp>
 #include <gnuradio-4.0/CircularBuffer.hpp>
 #include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/DataSetPool.hpp>
 #include <gnuradio-4.0/HistoryBuffer.hpp>
 #include <gnuradio-4.0/Tag.hpp>
 #include <gnuradio-4.0/TriggerMatcher.hpp>
@@ -393,7 +394,7 @@ inline std::optional<property_map> tagAndMetadata(const std::optional<property_m
 
 template<typename T>
 [[nodiscard]] inline DataSet<T> createDataset(const Metadata& metadata) {
-    DataSet<T> ds;
+    DataSet<T> ds        = gr::globalDataSetPool<T>().acquire({0}); // extents, axis_values, timing_events and meta_information are sized
     ds.signal_names      = {metadata.signalName};
     ds.signal_quantities = {metadata.signalQuantity};
     ds.signal_units      = {metadata.signalUnit};
@@ -404,14 +405,8 @@ template<typename T>
     ds.axis_names = {"Time"};
     ds.axis_units = {"a.u."};
 
-    ds.extents.resize(1UZ);
     ds.layout = gr::LayoutRight{};
 
-    ds.timing_events.resize(1UZ);
-    ds.axis_values.resize(1UZ);
-
-    ds.meta_information.resize(1UZ);
-
     return ds;
 }
 } // namespace detail
@@ -689,7 +684,7 @@ private:
 
                 if (isBlocking || pollerPtr->writer.available() > 0) {
                     auto writeData = pollerPtr->writer.reserve(1UZ);
-                    writeData[0UZ] = std::move(data);
+                    gr::publishRecycled(writeData[0UZ], std::move(data)); // the previously polled DataSet is returned to the pool
                     writeData.publish(1UZ);
                 } else {
                     pollerPtr->dropCount++;
@@ -1151,7 +1146,7 @@ private:
 
                 if (block || poller->writer.available() > 0) {
                     auto writeData = poller->writer.reserve(1UZ);
-                    writeData[0UZ] = std::move(data);
+                    writeData[0UZ] = data; // copy-assignment re-uses the storage of the previously polled DataSet
                     writeData.publish(1UZ);
                 } else {
                     poller->dropCount++;
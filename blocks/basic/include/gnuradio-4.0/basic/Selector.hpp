@@ -99,6 +99,9 @@ you can set the `backPressure` property to false.
 
     std::size_t _selectedSrc = 0UZ;
 
+    std::vector<std::size_t> _outOffsets{};        // processBulk(..) scratch, kept to avoid per-call allocations
+    std::vector<std::size_t> _nSamplesToConsume{}; // processBulk(..) scratch, kept to avoid per-call allocations
+
     void settingsChanged(const gr::property_map& oldSettings, const gr::property_map& newSettings) {
         if (newSettings.contains("n_inputs") || newSettings.contains("n_outputs")) {
             std::print("{}: configuration changed: n_inputs {} -> {}, n_outputs {} -> {}\n", this->name, oldSettings.at("n_inputs"), newSettings.contains("n_inputs") ? newSettings.at("n_inputs") : "same", oldSettings.at("n_outputs"), newSettings.contains("n_outputs") ? newSettings.at("n_outputs") : "same");
@@ -150,8 +153,9 @@ you can set the `backPressure` property to false.
             _selectedSrc = std::numeric_limits<std::size_t>::max();
         }
 
-        std::vector<std::size_t> outOffsets(outs.size(), 0UZ);
-        auto                     copyToOutput = [&outOffsets](std::size_t nSamplesToCopy, auto& inputSpan, auto& outputSpan, std::size_t outIndex) {
+        _outOffsets.assign(outs.size(), 0UZ);
+        auto& outOffsets   = _outOffsets;
+        auto  copyToOutput = [&outOffsets](std::size_t nSamplesToCopy, auto& inputSpan, auto& outputSpan, std::size_t outIndex) {
             const auto diffCount  = static_cast<std::ptrdiff_t>(nSamplesToCopy);
             const auto diffOffset = static_cast<std::ptrdiff_t>((outIndex == std::numeric_limits<std::size_t>::max()) ? 0U : outOffsets[outIndex]);
 
@@ -170,7 +174,8 @@ you can set the `backPressure` property to false.
             outputSpan.publish(nSamplesToCopy);
         };
 
-        std::vector<std::size_t> nSamplesToConsume(ins.size(), std::numeric_limits<std::size_t>::max());
+        _nSamplesToConsume.assign(ins.size(), std::numeric_limits<std::size_t>::max());
+        auto& nSamplesToConsume = _nSamplesToConsume;
         if (sync_combined_ports && std::ranges::any_of(_internalMappingOutIn, [](const auto& pair) { return pair.second.size() > 1; })) {
             for (const auto& [outIndex, inIndices] : _internalMappingOutIn) {
                 std::size_t nInSamplesAvailable = std::ranges::min(inIndices | std::views::transform([&ins](std::size_t i) { return ins[i].size(); }));
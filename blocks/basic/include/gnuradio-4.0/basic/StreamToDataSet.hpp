@@ -5,6 +5,7 @@
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/BlockRegistry.hpp>
 #include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/DataSetPool.hpp>
 #include <gnuradio-4.0/HistoryBuffer.hpp>
 #include <gnuradio-4.0/algorithm/dataset/DataSetUtils.hpp>
 #include <gnuradio-4.0/meta/utils.hpp>
@@ -58,6 +59,12 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
     HistoryBuffer<T> _history{MIN_BUFFER_SIZE + n_pre};
     TMatcher         _matcher{};
 
+    // the default matcher is compiled once per 'filter' change instead of being re-validated for each tag
+    constexpr static bool kCompiledMatcher = std::is_same_v<TMatcher, trigger::BasicTriggerNameCtxMatcher::Filter>;
+    using FilterState                      = std::conditional_t<kCompiledMatcher, trigger::BasicTriggerNameCtxMatcher::State, property_map>;
+
+    trigger::BasicTriggerNameCtxMatcher::Compiled _compiledMatcher{};
+
     struct AccumulationState {
         bool        isActive           = false;
         bool        isPreActive        = false;
@@ -107,19 +114,31 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
 
     std::conditional_t<streamOut, AccumulationState, std::deque<AccumulationState>> _accState{};
     std::deque<DataSet<T>>                                                          _tempDataSets;
-    std::conditional_t<streamOut, property_map, std::deque<property_map>>           _filterState;
+    std::conditional_t<streamOut, FilterState, std::deque<FilterState>>             _filterState;
 
     void reset() {
-        _filterState.clear();
         if constexpr (streamOut) {
+            _filterState = FilterState{};
             _accState.reset();
         } else {
+            _filterState.clear();
             _tempDataSets.clear();
             _accState.clear();
         }
     }
 
     void settingsChanged(const gr::property_map& /*oldSettings*/, const gr::property_map& newSettings) {
+        if constexpr (kCompiledMatcher) {
+            if (newSettings.contains("filter")) {
+                _compiledMatcher = trigger::BasicTriggerNameCtxMatcher::Compiled(filter.value); // throws gr::exception on ill-formed criteria
+                if constexpr (streamOut) {
+                    _filterState.reset();
+                } else {
+                    std::ranges::for_each(_filterState, [](FilterState& state) { state.reset(); });
+                }
+            }
+        }
+
         if (newSettings.contains("n_pre")) {
             if constexpr (streamOut) {
                 if (n_pre.value > out.buffer().streamBuffer.size()) {
@@ -200,10 +219,10 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
     gr::work::Status processBulkDataSet(InputSpanLike auto& inSamples, OutputSpanLike auto& outSamples) {
         //    This is a workaround to support cases of overlapping datasets, for example, Start1-Start2-Stop1-Stop2 case.
         //    always add new DataSet when Start trigger is present
-        property_map tmpFilterState;
+        FilterState tmpFilterState{};
         const auto [startTrigger, endTrigger, isSingleTrigger] = detectTrigger(tmpFilterState);
         if (startTrigger) {
-            _tempDataSets.emplace_back();
+            _tempDataSets.push_back(gr::globalDataSetPool<T>().acquire({0})); // re-uses storage of previously consumed DataSets
             initNewDataSet(_tempDataSets.back());
 
             _accState.emplace_back();
@@ -288,7 +307,7 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
                 if (!ds.signal_values.empty()) { // TODO: do we need to publish empty  DataSet at all, empty DataSet can occur when n_max is set.
                     gr::dataset::updateMinMax(ds);
                 }
-                outSamples[publishedCounter] = std::move(ds);
+                gr::publishRecycled(outSamples[publishedCounter], std::move(ds)); // the consumed slot's storage is returned to the pool
                 _tempDataSets.pop_front();
                 _accState.pop_front();
                 _filterState.pop_front();
@@ -303,19 +322,28 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
     }
 
 private:
-    auto detectTrigger(property_map& filterState) {
+    auto detectTrigger(FilterState& filterState) {
         struct {
             bool startTrigger    = false;
             bool endTrigger      = false;
             bool isSingleTrigger = false;
         } result;
 
-        const trigger::MatchResult matchResult = _matcher(filter.value, this->mergedInputTag(), filterState);
-        if (matchResult != trigger::MatchResult::Ignore) {
-            assert(filterState.contains("isSingleTrigger"));
-            result.startTrigger    = matchResult == trigger::MatchResult::Matching;
-            result.endTrigger      = matchResult == trigger::MatchResult::NotMatching;
-            result.isSingleTrigger = std::get<bool>(filterState.at("isSingleTrigger"));
+        if constexpr (kCompiledMatcher) {
+            const trigger::MatchResult matchResult = _compiledMatcher(this->mergedInputTag(), filterState);
+            if (matchResult != trigger::MatchResult::Ignore) {
+                result.startTrigger    = matchResult == trigger::MatchResult::Matching;
+                result.endTrigger      = matchResult == trigger::MatchResult::NotMatching;
+                result.isSingleTrigger = _compiledMatcher.isSingleTrigger();
+            }
+        } else {
+            const trigger::MatchResult matchResult = _matcher(filter.value, this->mergedInputTag(), filterState);
+            if (matchResult != trigger::MatchResult::Ignore) {
+                assert(filterState.contains("isSingleTrigger"));
+                result.startTrigger    = matchResult == trigger::MatchResult::Matching;
+                result.endTrigger      = matchResult == trigger::MatchResult::NotMatching;
+                result.isSingleTrigger = std::get<bool>(filterState.at("isSingleTrigger"));
+            }
         }
         return result;
     }
@@ -338,7 +366,7 @@ private:
         dataSet.axis_names.emplace_back("time");
         dataSet.axis_units.emplace_back("s");
         dataSet.axis_values.resize(1UZ);
-        dataSet.extents.emplace_back(0); // size of 1-dim data
+        dataSet.extents.resize(1UZ); // size of 1-dim data
 
         dataSet.signal_names.emplace_back(signal_name);
         dataSet.signal_quantities.emplace_back(signal_quantity);
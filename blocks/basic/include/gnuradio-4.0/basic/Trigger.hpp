@@ -135,6 +135,13 @@ The information is stored (info only) in `trigger_name`, `trigger_time`, `trigge
         };
 
         for (std::size_t i = 0; i < nProcess; ++i) {
+            if (const std::size_t nSkip = _trigger.skipQuietSamples(std::span<const T>(inputSpan.data() + i, nProcess - i)); nSkip > 0UZ) { // SIMD pre-scan: skip samples far from the threshold
+                _now += nSkip * _period;
+                i += nSkip;
+                if (i == nProcess) {
+                    break;
+                }
+            }
             const T sample = inputSpan[i];
             _now += _period;
 
@@ -10,6 +10,7 @@
 #include <gnuradio-4.0/BlockRegistry.hpp>
 
 #include <gnuradio-4.0/algorithm/filter/FilterTool.hpp>
+#include <gnuradio-4.0/algorithm/filter/MultiChannelFilter.hpp>
 #include <gnuradio-4.0/basic/StreamToDataSet.hpp>
 #include <gnuradio-4.0/meta/UncertainValue.hpp>
 
@@ -51,8 +52,18 @@ applies low-pass filters to calculate average values, and outputs decimated resu
     GR_MAKE_REFLECTABLE(PowerMetrics, U, I, P, Q, S, U_rms, I_rms, sample_rate, decimate);
 
     // private state for exponential moving average (EMA)
-    using FilterImpl = std::conditional_t<UncertainValueLike<T>, filter::ErrorPropagatingFilter<T>, filter::Filter<meta::fundamental_base_value_type_t<T>>>;
+    using ValueType  = meta::fundamental_base_value_type_t<T>;
+    using FilterImpl = std::conditional_t<UncertainValueLike<T>, filter::ErrorPropagatingFilter<T>, filter::Filter<ValueType>>;
 
+    // arithmetic types: all phases and filter paths are advanced in lock-step, one SIMD lane per filter
+    static constexpr bool        kLaneParallel = std::floating_point<T>;
+    static constexpr std::size_t kTileSize     = 256UZ;
+
+    filter::MultiChannelFilter<ValueType> _hpBank; // lanes: [U_0..U_{n-1}, I_0..I_{n-1}]
+    filter::MultiChannelFilter<ValueType> _lpBank; // lanes: [P_0..P_{n-1}, U²_0..U²_{n-1}, I²_0..I²_{n-1}]
+    std::vector<ValueType>                _tile;   // [5·nPhases][kTileSize] scratch: HP-filtered u, i followed by the LP-filtered p, u², i²
+
+    // UncertainValue types: per-phase error-propagating filters
     std::array<FilterImpl, nPhases> _hpVoltage;
     std::array<FilterImpl, nPhases> _hpCurrent;
 
@@ -62,34 +73,38 @@ applies low-pass filters to calculate average values, and outputs decimated resu
 
     void initFilters() {
         using namespace gr::filter;
-        using ValueType = meta::fundamental_base_value_type_t<T>;
-
-        const auto hp_filter_init = [&](auto) { //
-            if (high_pass > 0.f) {
-                return FilterImpl(iir::designFilter<ValueType>(Type::HIGHPASS,                                                       //
-                    FilterParameters{.order = 2UZ, .fHigh = static_cast<double>(high_pass), .fs = static_cast<double>(sample_rate)}, //
-                    iir::Design::BUTTERWORTH));
-            }
-            return FilterImpl();
-        };
-        constexpr auto indices = std::views::iota(0UZ, nPhases);
-        std::ranges::transform(indices, _hpVoltage.begin(), hp_filter_init);
-        std::ranges::transform(indices, _hpCurrent.begin(), hp_filter_init);
 
         if constexpr (not TParent::ResamplingControl::kIsConst) {
             this->input_chunk_size = decimate;
         }
 
+        std::vector<FilterCoefficients<ValueType>> hpSections{FilterCoefficients<ValueType>{.b = {1}, .a = {1}}}; // pass-through
+        if (high_pass > 0.f) {
+            hpSections = iir::designFilter<ValueType>(Type::HIGHPASS,                                                            //
+                FilterParameters{.order = 2UZ, .fHigh = static_cast<double>(high_pass), .fs = static_cast<double>(sample_rate)}, //
+                iir::Design::BUTTERWORTH);
+        }
+
         const double cutoff_frequency = std::min(0.5 * (static_cast<double>(sample_rate) / static_cast<double>(decimate)), static_cast<double>(low_pass.value));
-        const auto   lp_filter_init   = [&, cutoff_frequency](auto) {                                                 //
-            return FilterImpl(iir::designFilter<ValueType>(Type::LOWPASS,                                         //
+        const auto   lpSections       = iir::designFilter<ValueType>(Type::LOWPASS,                                   //
                     FilterParameters{.order = 2UZ, .fLow = cutoff_frequency, .fs = static_cast<double>(sample_rate)}, //
-                    iir::Design::BUTTERWORTH));
-        };
-
-        std::ranges::transform(indices, _lpVoltageSquared.begin(), lp_filter_init);
-        std::ranges::transform(indices, _lpCurrentSquared.begin(), lp_filter_init);
-        std::ranges::transform(indices, _lpActivePower.begin(), lp_filter_init);
+                    iir::Design::BUTTERWORTH);
+
+        if constexpr (kLaneParallel) {
+            _hpBank = MultiChannelFilter<ValueType>(2UZ * nPhases, hpSections);
+            _lpBank = MultiChannelFilter<ValueType>(3UZ * nPhases, lpSections);
+            _tile.assign(5UZ * nPhases * kTileSize, ValueType(0));
+        } else {
+            const auto hp_filter_init = [&hpSections](auto) { return FilterImpl(hpSections); };
+            const auto lp_filter_init = [&lpSections](auto) { return FilterImpl(lpSections); };
+
+            constexpr auto indices = std::views::iota(0UZ, nPhases);
+            std::ranges::transform(indices, _hpVoltage.begin(), hp_filter_init);
+            std::ranges::transform(indices, _hpCurrent.begin(), hp_filter_init);
+            std::ranges::transform(indices, _lpVoltageSquared.begin(), lp_filter_init);
+            std::ranges::transform(indices, _lpCurrentSquared.begin(), lp_filter_init);
+            std::ranges::transform(indices, _lpActivePower.begin(), lp_filter_init);
+        }
     }
 
     void settingsChanged(const property_map& /*oldSettings*/, const property_map& /*newSettings*/) { initFilters(); }
@@ -98,36 +113,94 @@ applies low-pass filters to calculate average values, and outputs decimated resu
     constexpr work::Status processBulk(std::span<TInputSpanType>& voltage, std::span<TInputSpanType>& current,                         // inputs
         std::span<TOutputSpanType>& activePower, std::span<TOutputSpanType>& reactivePower, std::span<TOutputSpanType>& apparentPower, // power outputs
         std::span<TOutputSpanType>& rmsVoltage, std::span<TOutputSpanType>& rmsCurrent) {
-        for (std::size_t phaseIdx = 0UZ; phaseIdx < nPhases; ++phaseIdx) {                      // process each phase
-            for (std::size_t i = 0UZ; i < voltage[phaseIdx].size(); ++i) {                      // iterate over samples
-                const T u_i = _hpVoltage[phaseIdx].processOne(gr::value(voltage[phaseIdx][i])); // removes DC-offset TODO: check uncertainty propagation
-                const T i_i = _hpCurrent[phaseIdx].processOne(gr::value(current[phaseIdx][i])); // removes DC-offset TODO: check uncertainty propagation
-
-                const T p_i    = u_i * i_i;                                         // instantaneous power
-                const T ema_p  = _lpActivePower[phaseIdx].processOne(p_i);          // update exponential moving average for power
-                const T ema_u2 = _lpVoltageSquared[phaseIdx].processOne(u_i * u_i); // update exponential moving average for voltage squared
-                const T ema_i2 = _lpCurrentSquared[phaseIdx].processOne(i_i * i_i); // update exponential moving average for current squared
-
-                if (i % static_cast<std::size_t>(decimate) == 0UZ) {
-                    const std::size_t outIdx = i / static_cast<std::size_t>(decimate);
-                    const T           u_rms  = math::sqrt(ema_u2);
-                    const T           i_rms  = math::sqrt(ema_i2);
-
-                    const T S_i = u_rms * i_rms;                                         // apparent power
-                    T       Q_i = math::sqrt(std::max(S_i * S_i - ema_p * ema_p, T(0))); // reactive power
-
-                    activePower[phaseIdx][outIdx]   = ema_p;
-                    reactivePower[phaseIdx][outIdx] = Q_i;
-                    apparentPower[phaseIdx][outIdx] = S_i;
-
-                    rmsVoltage[phaseIdx][outIdx] = u_rms;
-                    rmsCurrent[phaseIdx][outIdx] = i_rms;
+        if constexpr (kLaneParallel) {
+            return processBulkLaneParallel(voltage, current, activePower, reactivePower, apparentPower, rmsVoltage, rmsCurrent);
+        } else {
+            for (std::size_t phaseIdx = 0UZ; phaseIdx < nPhases; ++phaseIdx) {                      // process each phase
+                for (std::size_t i = 0UZ; i < voltage[phaseIdx].size(); ++i) {                      // iterate over samples
+                    const T u_i = _hpVoltage[phaseIdx].processOne(gr::value(voltage[phaseIdx][i])); // removes DC-offset TODO: check uncertainty propagation
+                    const T i_i = _hpCurrent[phaseIdx].processOne(gr::value(current[phaseIdx][i])); // removes DC-offset TODO: check uncertainty propagation
+
+                    const T p_i    = u_i * i_i;                                         // instantaneous power
+                    const T ema_p  = _lpActivePower[phaseIdx].processOne(p_i);          // update exponential moving average for power
+                    const T ema_u2 = _lpVoltageSquared[phaseIdx].processOne(u_i * u_i); // update exponential moving average for voltage squared
+                    const T ema_i2 = _lpCurrentSquared[phaseIdx].processOne(i_i * i_i); // update exponential moving average for current squared
+
+                    if (i % static_cast<std::size_t>(decimate) == 0UZ) {
+                        writeMetrics(phaseIdx, i / static_cast<std::size_t>(decimate), ema_p, ema_u2, ema_i2, activePower, reactivePower, apparentPower, rmsVoltage, rmsCurrent);
+                    }
+                }
+            }
+            return work::Status::OK;
+        }
+    }
+
+    template<typename TInputSpanType, typename TOutputSpanType>
+    constexpr work::Status processBulkLaneParallel(std::span<TInputSpanType>& voltage, std::span<TInputSpanType>& current, //
+        std::span<TOutputSpanType>& activePower, std::span<TOutputSpanType>& reactivePower, std::span<TOutputSpanType>& apparentPower, std::span<TOutputSpanType>& rmsVoltage, std::span<TOutputSpanType>& rmsCurrent) {
+        if (_tile.empty()) { // settings not yet applied
+            initFilters();
+        }
+        const std::size_t nSamples = voltage[0].size();
+        const std::size_t decim    = static_cast<std::size_t>(decimate);
+
+        std::array<std::span<const T>, 2UZ * nPhases> hpIn;
+        std::array<std::span<T>, 2UZ * nPhases>       hpOut; // AC-coupled [u, i]
+        std::array<std::span<T>, 3UZ * nPhases>       lp;    // [p, u², i²] -> filtered in-place
+        for (std::size_t offset = 0UZ; offset < nSamples; offset += kTileSize) {
+            const std::size_t nTile = std::min(kTileSize, nSamples - offset);
+            for (std::size_t phaseIdx = 0UZ; phaseIdx < nPhases; ++phaseIdx) {
+                hpIn[phaseIdx]           = std::span<const T>(voltage[phaseIdx].data() + offset, nTile);
+                hpIn[nPhases + phaseIdx] = std::span<const T>(current[phaseIdx].data() + offset, nTile);
+            }
+            for (std::size_t lane = 0UZ; lane < 2UZ * nPhases; ++lane) {
+                hpOut[lane] = std::span<T>(_tile.data() + lane * kTileSize, nTile);
+            }
+            for (std::size_t lane = 0UZ; lane < 3UZ * nPhases; ++lane) {
+                lp[lane] = std::span<T>(_tile.data() + (2UZ * nPhases + lane) * kTileSize, nTile);
+            }
+            _hpBank.processBlock(hpIn, hpOut); // removes DC-offset
+
+            for (std::size_t phaseIdx = 0UZ; phaseIdx < nPhases; ++phaseIdx) {
+                const std::span<const T> u = hpOut[phaseIdx];
+                const std::span<const T> i = hpOut[nPhases + phaseIdx];
+                for (std::size_t n = 0UZ; n < nTile; ++n) {
+                    lp[phaseIdx][n]                 = u[n] * i[n]; // instantaneous power
+                    lp[nPhases + phaseIdx][n]       = u[n] * u[n];
+                    lp[2UZ * nPhases + phaseIdx][n] = i[n] * i[n];
+                }
+            }
+            std::array<std::span<const T>, 3UZ * nPhases> lpIn;
+            std::ranges::copy(lp, lpIn.begin());
+            _lpBank.processBlock(lpIn, lp); // exponential moving averages of p, u², and i²
+
+            for (std::size_t n = (decim - offset % decim) % decim; n < nTile; n += decim) {
+                const std::size_t outIdx = (offset + n) / decim;
+                for (std::size_t phaseIdx = 0UZ; phaseIdx < nPhases; ++phaseIdx) {
+                    writeMetrics(phaseIdx, outIdx, lp[phaseIdx][n], lp[nPhases + phaseIdx][n], lp[2UZ * nPhases + phaseIdx][n], activePower, reactivePower, apparentPower, rmsVoltage, rmsCurrent);
                 }
             }
         }
 
         return work::Status::OK;
     }
+
+    template<typename TOutputSpanType>
+    constexpr void writeMetrics(std::size_t phaseIdx, std::size_t outIdx, T ema_p, T ema_u2, T ema_i2, //
+        std::span<TOutputSpanType>& activePower, std::span<TOutputSpanType>& reactivePower, std::span<TOutputSpanType>& apparentPower, std::span<TOutputSpanType>& rmsVoltage, std::span<TOutputSpanType>& rmsCurrent) {
+        const T u_rms = math::sqrt(ema_u2);
+        const T i_rms = math::sqrt(ema_i2);
+
+        const T S_i = u_rms * i_rms;                                         // apparent power
+        T       Q_i = math::sqrt(std::max(S_i * S_i - ema_p * ema_p, T(0))); // reactive power
+
+        activePower[phaseIdx][outIdx]   = ema_p;
+        reactivePower[phaseIdx][outIdx] = Q_i;
+        apparentPower[phaseIdx][outIdx] = S_i;
+
+        rmsVoltage[phaseIdx][outIdx] = u_rms;
+        rmsCurrent[phaseIdx][outIdx] = i_rms;
+    }
 };
 
 template<typename T>
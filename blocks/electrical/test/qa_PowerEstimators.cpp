@@ -180,6 +180,70 @@ const boost::ut::suite<"Power Metrics Estimators"> powerEstimatorTests = [] {
             std::pair<gr::UncertainValue<float>, std::integral_constant<std::size_t, 3>>{}  //
         };
 
+    "PowerMetrics without AC-coupling (high_pass = 0) matches the scalar reference"_test = []<typename TNPhases>() {
+        using T                        = float;
+        constexpr std::size_t kNPhases = TNPhases::value;
+        constexpr std::size_t decim    = 100UZ;
+        constexpr std::size_t nSamples = 10'000UZ; // N.B. not a multiple of the internal tile size
+
+        std::vector<std::vector<T>> voltageIn(kNPhases, std::vector<T>(nSamples));
+        std::vector<std::vector<T>> currentIn(kNPhases, std::vector<T>(nSamples));
+        for (std::size_t phase = 0UZ; phase < kNPhases; ++phase) {
+            for (std::size_t n = 0UZ; n < nSamples; ++n) {
+                const float t       = static_cast<float>(n) / sample_rate;
+                voltageIn[phase][n] = V_offset + V_peak * std::sin(2.0f * std::numbers::pi_v<float> * freq * t + phaseShift[phase]);
+                currentIn[phase][n] = I_offset + I_peak * std::sin(2.0f * std::numbers::pi_v<float> * freq * t + phaseShift[phase] + phaseOffset[phase]);
+            }
+        }
+
+        PowerMetrics<T, kNPhases> block;
+        block.high_pass = 0.f; // pass-through, i.e. zero-length filter sections
+        block.decimate  = static_cast<gr::Size_t>(decim);
+        block.initFilters();
+
+        std::vector<std::span<const T>> voltageSpans(voltageIn.begin(), voltageIn.end());
+        std::vector<std::span<const T>> currentSpans(currentIn.begin(), currentIn.end());
+        std::span<std::span<const T>>   spanInVoltage(voltageSpans);
+        std::span<std::span<const T>>   spanInCurrent(currentSpans);
+
+        std::array<std::vector<std::vector<T>>, 5UZ> outVecs;
+        std::array<std::vector<std::span<T>>, 5UZ>   outSpans;
+        for (std::size_t k = 0UZ; k < outVecs.size(); ++k) {
+            outVecs[k].assign(kNPhases, std::vector<T>(nSamples / decim));
+            outSpans[k].assign(outVecs[k].begin(), outVecs[k].end());
+        }
+        std::span<std::span<T>> activePower(outSpans[0]);
+        std::span<std::span<T>> reactivePower(outSpans[1]);
+        std::span<std::span<T>> apparentPower(outSpans[2]);
+        std::span<std::span<T>> rmsVoltage(outSpans[3]);
+        std::span<std::span<T>> rmsCurrent(outSpans[4]);
+        expect(block.processBulk(spanInVoltage, spanInCurrent, activePower, reactivePower, apparentPower, rmsVoltage, rmsCurrent) == gr::work::Status::OK);
+
+        // scalar reference: un-filtered inputs, per-path low-pass filters (cf. the UncertainValue code path)
+        using namespace gr::filter;
+        const double cutoff     = std::min(0.5 * static_cast<double>(sample_rate) / static_cast<double>(decim), static_cast<double>(block.low_pass.value));
+        const auto   lpSections = iir::designFilter<T>(Type::LOWPASS, FilterParameters{.order = 2UZ, .fLow = cutoff, .fs = static_cast<double>(sample_rate)}, iir::Design::BUTTERWORTH);
+        const auto   matches    = [](T actual, T expected) { return std::abs(actual - expected) <= 1e-3f * std::max(1.f, std::abs(expected)); };
+        for (std::size_t phase = 0UZ; phase < kNPhases; ++phase) {
+            Filter<T>   lpActivePower(lpSections);
+            Filter<T>   lpVoltageSquared(lpSections);
+            Filter<T>   lpCurrentSquared(lpSections);
+            std::size_t nMismatches = 0UZ;
+            for (std::size_t n = 0UZ; n < nSamples; ++n) {
+                const T u      = voltageIn[phase][n];
+                const T i      = currentIn[phase][n];
+                const T ema_p  = lpActivePower.processOne(u * i);
+                const T ema_u2 = lpVoltageSquared.processOne(u * u);
+                const T ema_i2 = lpCurrentSquared.processOne(i * i);
+                if (n % decim == 0UZ) {
+                    const std::size_t idx = n / decim;
+                    nMismatches += !matches(activePower[phase][idx], ema_p) + !matches(rmsVoltage[phase][idx], std::sqrt(ema_u2)) + !matches(rmsCurrent[phase][idx], std::sqrt(ema_i2));
+                }
+            }
+            expect(eq(nMismatches, 0UZ)) << std::format("phase {}: deviations from the scalar reference", phase);
+        }
+    } | std::tuple<std::integral_constant<std::size_t, 1UZ>, std::integral_constant<std::size_t, 3UZ>>{};
+
     "PowerFactor"_test = []<typename TestParam>() {
         using T                        = typename TestParam::first_type;
         constexpr std::size_t kNPhases = TestParam::second_type::value;
@@ -0,0 +1,80 @@
+#include <benchmark.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <numbers>
+#include <vector>
+
+#include <gnuradio-4.0/filter/time_domain_filter.hpp>
+
+/**
+ * High-ratio decimation (R = 64 … 4096): FIR-based decimating filter (low-pass at 0.4·fs/R, every input sample filtered)
+ * vs. the multiplier-free CIC decimator (order 4, with and without pass-band compensation FIR at the decimated rate).
+ */
+
+inline constexpr std::size_t N_ITER    = 3UZ;
+inline constexpr std::size_t N_SAMPLES = 1UZ << 17UZ;
+
+template<typename T>
+std::vector<T> testSignal() {
+    std::vector<T> input(N_SAMPLES);
+    for (std::size_t i = 0UZ; i < N_SAMPLES; ++i) {
+        const double value = 0.5 * std::sin(2. * std::numbers::pi * 1e-4 * static_cast<double>(i));
+        if constexpr (std::is_integral_v<T>) {
+            input[i] = static_cast<T>(value * static_cast<double>(std::numeric_limits<T>::max()));
+        } else {
+            input[i] = static_cast<T>(value);
+        }
+    }
+    return input;
+}
+
+void benchmarkFirDecimator(std::size_t rate) {
+    using namespace boost::ut;
+    using namespace gr::filter;
+    using T = float;
+
+    BasicDecimatingFilter<T> filter;
+    filter.filter_type       = FilterType::FIR;
+    filter.filter_response   = gr::filter::Type::LOWPASS;
+    filter.f_low             = 0.4 / static_cast<double>(rate);
+    filter.sample_rate       = 1.0;
+    filter.decimate          = static_cast<gr::Size_t>(rate);
+    filter.fir_design_method = gr::algorithm::window::Type::Kaiser;
+    filter.designFilter();
+    const std::size_t nTaps = fir::designFilter<T>(gr::filter::Type::LOWPASS, FilterParameters{.order = filter.filter_order, .fLow = filter.f_low, .fs = filter.sample_rate}).b.size();
+
+    const std::vector<T> input = testSignal<T>();
+    std::vector<T>       output(N_SAMPLES / rate);
+    ::benchmark::benchmark<N_ITER>(std::format("R = {:4} FIR decimator ({:5} taps)  {:6}", rate, nTaps, gr::meta::type_name<T>()), N_SAMPLES) = [&] { expect(filter.processBulk(input, output) == gr::work::Status::OK); };
+}
+
+template<typename T>
+void benchmarkCicDecimator(std::size_t rate, bool compensation) {
+    using namespace boost::ut;
+    using namespace gr::filter;
+
+    CicDecimator<T> cic;
+    cic.decim        = static_cast<gr::Size_t>(rate);
+    cic.order        = 4U;
+    cic.compensation = compensation;
+    cic.settingsChanged({}, {});
+
+    const std::vector<T> input = testSignal<T>();
+    std::vector<T>       output(N_SAMPLES / rate);
+    ::benchmark::benchmark<N_ITER>(std::format("R = {:4} CIC decimator{}  {:6}", rate, compensation ? " + 31-tap FIR" : "              ", gr::meta::type_name<T>()), N_SAMPLES) = [&] { expect(cic.processBulk(input, output) == gr::work::Status::OK); };
+}
+
+inline const boost::ut::suite _cic_decimator_bm_tests = [] {
+    for (std::size_t rate : {64UZ, 512UZ, 4096UZ}) {
+        benchmarkFirDecimator(rate);
+        benchmarkCicDecimator<float>(rate, false);
+        benchmarkCicDecimator<float>(rate, true);
+        benchmarkCicDecimator<std::int16_t>(rate, false);
+        ::benchmark::results::add_separator();
+    }
+};
+
+int main() { /* not needed by the UT framework */ }
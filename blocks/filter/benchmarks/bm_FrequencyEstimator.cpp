@@ -0,0 +1,57 @@
+#include <benchmark.hpp>
+
+#include <cmath>
+#include <format>
+#include <numbers>
+#include <vector>
+
+#include <gnuradio-4.0/filter/FrequencyEstimator.hpp>
+
+template<typename T>
+std::vector<T> generateSinSample(std::size_t N, double sampleRate, double frequency, double amplitude) {
+    std::vector<T> signal(N);
+    for (std::size_t i = 0; i < N; i++) {
+        signal[i] = static_cast<T>(amplitude * std::sin(2. * std::numbers::pi * frequency * static_cast<double>(i) / sampleRate));
+    }
+    return signal;
+}
+
+template<typename T>
+void testFrequencyEstimator(gr::Size_t fftSize, gr::Size_t nSamples) {
+    using namespace benchmark;
+    using namespace boost::ut;
+    using namespace boost::ut::reflection;
+
+    constexpr double sampleRate{1000.};
+    constexpr int    nRepetitions{5};
+
+    const std::vector<T> signal = generateSinSample<T>(nSamples, sampleRate, 50.3, 1.);
+    for (bool slidingDFT : {false, true}) {
+        gr::filter::FrequencyEstimatorFrequencyDomain<T> estimator;
+        estimator.sample_rate  = static_cast<float>(sampleRate);
+        estimator.f_min        = 45.f;
+        estimator.f_expected   = 50.f;
+        estimator.f_max        = 55.f;
+        estimator.min_fft_size = fftSize;
+        estimator.sliding_dft  = slidingDFT;
+        estimator.reset();
+
+        T result{};
+        ::benchmark::benchmark<nRepetitions>(std::format("{:6} N={:5} - {}", type_name<T>(), fftSize, slidingDFT ? "sliding DFT" : "FFT per sample"), nSamples) = [&estimator, &signal, &result] {
+            for (const T sample : signal) {
+                result = estimator.processOne(sample);
+            }
+        };
+        expect(approx(result, T(50.3), T(1))) << std::format("final estimate {} Hz", result);
+    }
+    ::benchmark::results::add_separator();
+}
+
+inline const boost::ut::suite _frequency_estimator_bm_tests = [] {
+    for (gr::Size_t fftSize : {gr::Size_t(1024U), gr::Size_t(4096U)}) {
+        testFrequencyEstimator<float>(fftSize, 4U * fftSize);
+        testFrequencyEstimator<double>(fftSize, 4U * fftSize);
+    }
+};
+
+int main() { /* not needed by the UT framework */ }
@@ -0,0 +1,59 @@
+#include <benchmark.hpp>
+
+#include <cmath>
+#include <format>
+#include <numbers>
+#include <vector>
+
+#include <gnuradio-4.0/algorithm/filter/BlockParallelFilter.hpp>
+#include <gnuradio-4.0/algorithm/filter/FilterTool.hpp>
+
+/**
+ * IIR throughput: serial (sample-by-sample recurrence) vs. block-parallel (independent, state-stitched SIMD segments)
+ * processing of a single-channel Butterworth low-pass cascade for filter orders 2 to 12, with the scalar 'Filter<T>'
+ * (default engine of 'BasicFilter') as reference.
+ */
+
+inline constexpr std::size_t N_ITER    = 10UZ;
+inline constexpr std::size_t N_SAMPLES = 1UZ << 18UZ;
+
+template<typename T>
+void testBlockParallelFilter(std::size_t order) {
+    using namespace boost::ut;
+    using namespace gr::filter;
+
+    constexpr double fs = 1000.;
+    std::vector<T>   input(N_SAMPLES);
+    for (std::size_t i = 0UZ; i < N_SAMPLES; ++i) {
+        input[i] = static_cast<T>(std::sin(2. * std::numbers::pi * 7. * static_cast<double>(i) / fs));
+    }
+    std::vector<T> output(N_SAMPLES);
+
+    const auto sections = iir::designFilter<T>(Type::LOWPASS, FilterParameters{.order = order, .fLow = 50., .fs = fs});
+    {
+        Filter<T> filter(sections);
+        ::benchmark::benchmark<N_ITER>(std::format("{:6} IIR order {:2} - Filter<T>", gr::meta::type_name<T>(), order), N_SAMPLES) = [&filter, &input, &output] {
+            for (std::size_t i = 0UZ; i < input.size(); ++i) {
+                output[i] = filter.processOne(input[i]);
+            }
+        };
+        expect(std::isfinite(output.back())) << std::format("order {}: non-finite output", order);
+    }
+    for (Processing processing : {Processing::Serial, Processing::BlockParallel}) {
+        BlockParallelFilter<T> filter(sections);
+        filter.setProcessing(processing);
+
+        ::benchmark::benchmark<N_ITER>(std::format("{:6} IIR order {:2} - {}", gr::meta::type_name<T>(), order, processing == Processing::Serial ? "serial" : "block-parallel"), N_SAMPLES) = [&filter, &input, &output] { filter.processBlock(input, output); };
+        expect(std::isfinite(output.back())) << std::format("order {}: non-finite output", order);
+    }
+}
+
+inline const boost::ut::suite _block_parallel_filter_bm_tests = [] {
+    for (std::size_t order : {2UZ, 4UZ, 6UZ, 8UZ, 10UZ, 12UZ}) {
+        testBlockParallelFilter<float>(order);
+        testBlockParallelFilter<double>(order);
+        ::benchmark::results::add_separator();
+    }
+};
+
+int main() { /* not needed by the UT framework */ }
@@ -2,7 +2,9 @@
 #define FREQUENCY_ESTIMATOR_HPP
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <complex>
 #include <numbers>
 #include <stdexcept>
 #include <vector>
@@ -189,6 +191,12 @@ This block estimates the frequency of a signal using the frequency-domain algori
       "Improving FFT frequency measurement resolution by parabolic and gaussian spectrum interpolation",
       AIP Conf. Proc. 732 (2004) 276,
       https://doi.org/10.1063/1.1831158.
+
+The non-decimating variant by default updates only the spectral bins within [f_min, f_max] incrementally for every new
+sample using a recursive sliding DFT, i.e. O(bins) rather than O(N log N) per sample. The Hann window is applied exactly
+in the frequency domain: w(n) = 0.5 - 0.25 e^{+i beta n} - 0.25 e^{-i beta n} with beta = 2 pi / (N - 1), hence each
+windowed bin is the combination of three (unwindowed) sliding-DFT terms at omega_k and omega_k -/+ beta. Rounding errors
+of the recursion are reset every 'resync_period' samples by recomputing these terms with three FFTs of the history.
 )"">;
     using TParent     = Block<FrequencyEstimatorFrequencyDomain<T, Args...>, Args...>;
 
@@ -196,14 +204,16 @@ This block estimates the frequency of a signal using the frequency-domain algori
     PortOut<T> out;
 
     // settings
-    Annotated<float, "sample rate", Doc<"signal sample rate">, Unit<"Hz">>       sample_rate{1.f};
-    Annotated<float, "f_min", Doc<"exp. min frequency range">, Unit<"Hz">>       f_min{40.f};
-    Annotated<float, "f_expected", Doc<"expected likely frequency">, Unit<"Hz">> f_expected{50.f};
-    Annotated<float, "f_max", Doc<"exp. max frequency">, Unit<"Hz">>             f_max{60.f};
-    Annotated<gr::Size_t, "min FFT size", Doc<"minimum FFT size">>               min_fft_size{256U};
-    Annotated<T, "epsilon", Doc<"numerical error threshold">>                    epsilon{T(1e-8)};
+    Annotated<float, "sample rate", Doc<"signal sample rate">, Unit<"Hz">>                                           sample_rate{1.f};
+    Annotated<float, "f_min", Doc<"exp. min frequency range">, Unit<"Hz">>                                           f_min{40.f};
+    Annotated<float, "f_expected", Doc<"expected likely frequency">, Unit<"Hz">>                                     f_expected{50.f};
+    Annotated<float, "f_max", Doc<"exp. max frequency">, Unit<"Hz">>                                                 f_max{60.f};
+    Annotated<gr::Size_t, "min FFT size", Doc<"minimum FFT size">>                                                   min_fft_size{256U};
+    Annotated<T, "epsilon", Doc<"numerical error threshold">>                                                        epsilon{T(1e-8)};
+    Annotated<bool, "sliding DFT", Doc<"incremental O(bins) spectrum update per sample (false: FFT per sample)">>    sliding_dft{true};
+    Annotated<gr::Size_t, "resync period", Doc<"sliding DFT: samples between FFT-based re-anchoring (0: FFT size)">> resync_period{0U};
 
-    GR_MAKE_REFLECTABLE(FrequencyEstimatorFrequencyDomain, in, out, sample_rate, f_expected, f_min, f_max, min_fft_size, epsilon);
+    GR_MAKE_REFLECTABLE(FrequencyEstimatorFrequencyDomain, in, out, sample_rate, f_expected, f_min, f_max, min_fft_size, epsilon, sliding_dft, resync_period);
 
     // private internal state
     T           _prevFrequency{50.0}; // previous frequency value for continuity
@@ -213,12 +223,25 @@ This block estimates the frequency of a signal using the frequency-domain algori
 
     gr::algorithm::FFT<T, std::complex<T>> _fftImpl{};
     std::vector<T>                         _inData;
-    std::vector<T>                         _window;
+    gr::algorithm::window::SharedWindow<T> _window;
     std::vector<std::complex<T>>           _outData;
     std::vector<T>                         _magnitudeSpectrum;
 
+    // sliding DFT state: three terms (omega_k, omega_k - beta, omega_k + beta) per tracked bin k in [_binLow, _binLow + _nBins)
+    static constexpr std::size_t                         kNTerms = 3UZ;
+    std::size_t                                          _binLow{0UZ};
+    std::size_t                                          _nBins{0UZ};
+    std::size_t                                          _resyncCounter{0UZ};
+    std::array<std::vector<std::complex<T>>, kNTerms>    _sdft;       // S_t(omega) = sum_n x[t - N + 1 + n] e^{-i omega n}
+    std::array<std::vector<std::complex<T>>, kNTerms>    _sdftRotate; // e^{+i omega}
+    std::array<std::vector<std::complex<T>>, kNTerms>    _sdftNewest; // e^{-i omega N}
+    std::array<std::vector<std::complex<T>>, kNTerms>    _modulation; // resync: e^{-i (omega - omega_k) n}, n = 0 ... N-1
+    gr::algorithm::FFT<std::complex<T>, std::complex<T>> _resyncFFT{};
+    std::vector<std::complex<T>>                         _resyncIn;
+    std::vector<std::complex<T>>                         _resyncOut;
+
     void settingsChanged(const property_map& /*oldSettings*/, const property_map& newSettings) {
-        if (newSettings.contains("n_periods") || newSettings.contains("sample_rate") || newSettings.contains("f_expected") || newSettings.contains("f_min") || newSettings.contains("f_max") || newSettings.contains("min_fft_size")) {
+        if (newSettings.contains("n_periods") || newSettings.contains("sample_rate") || newSettings.contains("f_expected") || newSettings.contains("f_min") || newSettings.contains("f_max") || newSettings.contains("min_fft_size") || newSettings.contains("sliding_dft") || newSettings.contains("resync_period")) {
             if (f_min < 0 || f_max >= sample_rate || f_expected < 0 || f_expected >= sample_rate) {
                 throw gr::exception(std::format("Ill-formed block parameters: f_min: {} < f_expected: {} < f_max: {} < sample_rate: {}", f_min, f_expected, f_max, sample_rate));
             }
@@ -234,9 +257,39 @@ This block estimates the frequency of a signal using the frequency-domain algori
             this->input_chunk_size = static_cast<gr::Size_t>(_minFFT);
         }
         _inData.resize(_minFFT, T(0));
-        _window = gr::algorithm::window::create<T>(gr::algorithm::window::Type::Hann, _minFFT);
+        _window = gr::algorithm::window::cached<T>(gr::algorithm::window::Type::Hann, _minFFT);
         _outData.resize(_minFFT, std::complex<T>(T(0)));
-        _magnitudeSpectrum.resize(_minFFT / 2UZ, T(0));
+        _magnitudeSpectrum.assign(_minFFT / 2UZ, T(0));
+        if constexpr (TParent::ResamplingControl::kIsConst) {
+            initialiseSlidingDFT();
+        }
+    }
+
+    void initialiseSlidingDFT() {
+        const auto [iMin, iMax] = peakSearchRange();
+        _binLow                 = iMin - 1UZ; // + neighbours needed for the interpolation
+        _nBins                  = std::min(iMax + 1UZ, _magnitudeSpectrum.size() - 1UZ) - _binLow + 1UZ;
+        _resyncCounter          = 0UZ;
+
+        const double N    = static_cast<double>(_minFFT);
+        const double beta = 2. * std::numbers::pi / (N - 1.); // symmetric Hann, @see window::create(..)
+        for (std::size_t term = 0UZ; term < kNTerms; ++term) {
+            const double shift = term == 0UZ ? 0. : (term == 1UZ ? -beta : +beta);
+            _sdft[term].assign(_nBins, std::complex<T>(T(0)));
+            _sdftRotate[term].resize(_nBins);
+            _sdftNewest[term].resize(_nBins);
+            for (std::size_t i = 0UZ; i < _nBins; ++i) {
+                const double omega   = 2. * std::numbers::pi * static_cast<double>(_binLow + i) / N + shift;
+                _sdftRotate[term][i] = std::complex<T>(std::polar(1., omega));
+                _sdftNewest[term][i] = std::complex<T>(std::polar(1., -omega * N));
+            }
+            _modulation[term].resize(_minFFT);
+            for (std::size_t n = 0UZ; n < _minFFT; ++n) {
+                _modulation[term][n] = std::complex<T>(std::polar(1., -shift * static_cast<double>(n)));
+            }
+        }
+        _resyncIn.resize(_minFFT);
+        _resyncOut.resize(_minFFT);
     }
 
     void reset() {
@@ -247,8 +300,13 @@ This block estimates the frequency of a signal using the frequency-domain algori
     [[nodiscard]] T processOne(T input) noexcept
     requires(TParent::ResamplingControl::kIsConst)
     {
-        _inputHistory.push_front(input);
-        _prevFrequency = estimateFrequencyFFT();
+        if (!sliding_dft) {
+            _inputHistory.push_front(input);
+            _prevFrequency = estimateFrequencyFFT();
+            return _prevFrequency;
+        }
+        updateSlidingDFT(input);
+        _prevFrequency = estimateFrequencySlidingDFT();
         return _prevFrequency;
     }
 
@@ -265,9 +323,7 @@ This block estimates the frequency of a signal using the frequency-domain algori
             const std::size_t  offset = chunk_idx * this->input_chunk_size;
             std::span<const T> chunk  = input.subspan(offset, this->input_chunk_size);
 
-            for (const T& sample : chunk) {
-                _inputHistory.push_front(sample);
-            }
+            _inputHistory.push_front(chunk);
 
             _prevFrequency = estimateFrequencyFFT();
             *output_it++   = _prevFrequency;
@@ -277,6 +333,64 @@ This block estimates the frequency of a signal using the frequency-domain algori
     }
 
 private:
+    /// @return [i_min, i_max) bin range of the peak search
+    [[nodiscard]] std::pair<std::size_t, std::size_t> peakSearchRange() const noexcept {
+        const float scaled_size = static_cast<float>(_magnitudeSpectrum.size()) * 2.f;
+        std::size_t i_min       = static_cast<std::size_t>(std::floor((f_min / sample_rate) * scaled_size));
+        std::size_t i_max       = static_cast<std::size_t>(std::ceil((f_max / sample_rate) * scaled_size));
+
+        // ensure indices are within bounds
+        i_min = std::clamp(i_min, std::size_t(1), _magnitudeSpectrum.size() - 1UZ);
+        i_max = std::clamp(i_max, std::size_t(1), _magnitudeSpectrum.size() - 1UZ);
+        return {i_min, i_max};
+    }
+
+    void updateSlidingDFT(T input) noexcept {
+        const T oldest = _inputHistory.size() == _minFFT ? _inputHistory.back() : T(0); // sample leaving the window (zero while settling)
+        _inputHistory.push_front(input);
+
+        // S_{t+1}(omega) = e^{+i omega} (S_t(omega) - x[t - N + 1] + x[t + 1] e^{-i omega N})
+        for (std::size_t term = 0UZ; term < kNTerms; ++term) {
+            std::complex<T>*       state  = _sdft[term].data();
+            const std::complex<T>* rotate = _sdftRotate[term].data();
+            const std::complex<T>* newest = _sdftNewest[term].data();
+            for (std::size_t i = 0UZ; i < _nBins; ++i) {
+                state[i] = rotate[i] * (state[i] - oldest + input * newest[i]);
+            }
+        }
+
+        const std::size_t period = resync_period > 0U ? std::size_t(resync_period.value) : _minFFT;
+        if (_inputHistory.size() == _minFFT && ++_resyncCounter >= period) {
+            resyncSlidingDFT();
+        }
+    }
+
+    /// re-anchors the recursion: S(omega_k + shift) = FFT{x[n] e^{-i shift n}}[k], x[0] being the oldest sample
+    void resyncSlidingDFT() {
+        _resyncCounter = 0UZ;
+        for (std::size_t term = 0UZ; term < kNTerms; ++term) {
+            for (std::size_t n = 0UZ; n < _minFFT; ++n) {
+                _resyncIn[n] = _inputHistory[_minFFT - 1UZ - n] * _modulation[term][n];
+            }
+            _resyncOut = _resyncFFT.compute(_resyncIn, _resyncOut);
+            std::copy_n(std::next(_resyncOut.begin(), static_cast<std::ptrdiff_t>(_binLow)), _nBins, _sdft[term].begin());
+        }
+    }
+
+    T estimateFrequencySlidingDFT() {
+        if (_inputHistory.size() < _minFFT) {
+            return _prevFrequency; // Return previous frequency during settling time
+        }
+
+        // Hann window in the frequency domain + magnitude scaling as in computeMagnitudeSpectrum(..)
+        const T scale = T(2) / static_cast<T>(_minFFT);
+        for (std::size_t i = 0UZ; i < _nBins; ++i) {
+            const std::complex<T> windowed = T(0.5) * _sdft[0][i] - T(0.25) * (_sdft[1][i] + _sdft[2][i]);
+            _magnitudeSpectrum[_binLow + i] = std::hypot(windowed.real(), windowed.imag()) * scale;
+        }
+        return estimateFromMagnitudeSpectrum();
+    }
+
     T estimateFrequencyFFT() {
         // implement reference algorithm from [1]
         using namespace gr::algorithm::fft;
@@ -286,23 +400,19 @@ private:
         }
 
         // apply window function
-        auto bufferStart      = _inputHistory.begin();
-        using difference_type = typename decltype(bufferStart)::difference_type;
-        std::span<T> data(bufferStart, std::next(bufferStart, static_cast<difference_type>(_minFFT)));
+        const std::span<const T> data = _inputHistory.first(_minFFT);
         for (std::size_t i = 0UZ; i < data.size(); i++) {
             _inData[i] = data[i] * _window[i];
         }
 
         // compute FFT and magnitude spectrum
         _magnitudeSpectrum = computeMagnitudeSpectrum(_fftImpl.compute(_inData, _outData), _magnitudeSpectrum, ConfigMagnitude{.computeHalfSpectrum = true, .outputInDb = false});
+        return estimateFromMagnitudeSpectrum();
+    }
 
-        const float scaled_size = static_cast<float>(_magnitudeSpectrum.size()) * 2.f;
-        std::size_t i_min       = static_cast<std::size_t>(std::floor((f_min / sample_rate) * scaled_size));
-        std::size_t i_max       = static_cast<std::size_t>(std::ceil((f_max / sample_rate) * scaled_size));
-
-        // ensure indices are within bounds
-        i_min = std::clamp(i_min, std::size_t(1), _magnitudeSpectrum.size() - 1UZ);
-        i_max = std::clamp(i_max, std::size_t(1), _magnitudeSpectrum.size() - 1UZ);
+    T estimateFromMagnitudeSpectrum() const noexcept {
+        using difference_type = std::ptrdiff_t;
+        const auto [i_min, i_max] = peakSearchRange();
 
         // find the index of the maximum peak in the magnitude spectrum within the [i_min, i_max] range
         const auto        it_max = std::max_element(_magnitudeSpectrum.begin() + static_cast<difference_type>(i_min), _magnitudeSpectrum.begin() + static_cast<difference_type>(i_max));
@@ -344,7 +454,7 @@ private:
         // calculate the interpolated frequency
         T interpolated_freq_bin = static_cast<T>(k_max) + delta_k;
 
-        return interpolated_freq_bin * static_cast<T>(sample_rate) / static_cast<T>(_inData.size());
+        return interpolated_freq_bin * static_cast<T>(sample_rate) / static_cast<T>(_minFFT);
     }
 };
 
@@ -4,11 +4,14 @@
 #include <execution>
 #include <functional>
 #include <numeric>
+#include <variant>
 #include <vector>
 
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/BlockRegistry.hpp>
 #include <gnuradio-4.0/HistoryBuffer.hpp>
+#include <gnuradio-4.0/algorithm/filter/BlockParallelFilter.hpp>
+#include <gnuradio-4.0/algorithm/filter/CicFilter.hpp>
 #include <gnuradio-4.0/algorithm/filter/FilterTool.hpp>
 #include <gnuradio-4.0/meta/UncertainValue.hpp>
 
@@ -42,6 +45,8 @@ H(z) = b[0] + b[1]*z^-1 + b[2]*z^-2 + ... + b[N]*z^-N
         }
     }
 
+    std::size_t prefault() noexcept { return inputHistory.prefault(); } // @see Block<>::prefaultBuffers()
+
     constexpr T processOne(T input) noexcept {
         inputHistory.push_front(input);
         return std::transform_reduce(std::execution::unseq, b.cbegin(), b.cend(), inputHistory.cbegin(), T{0}, std::plus<>{}, std::multiplies<>{});
@@ -87,6 +92,8 @@ a are the feedback coefficients
         }
     }
 
+    std::size_t prefault() noexcept { return inputHistory.prefault() + outputHistory.prefault(); } // @see Block<>::prefaultBuffers()
+
     [[nodiscard]] T processOne(T input) noexcept {
         if constexpr (form == IIRForm::DF_I) {
             // y[n] = b[0] * x[n]   + b[1] * x[n-1] + ... + b[N] * x[n-N]
@@ -142,8 +149,13 @@ with selectable filter type (low-pass, high-pass, band-pass, band-stop), and sup
     PortOut<T> out;
 
     using FilterImpl = std::conditional_t<UncertainValueLike<T>, filter::ErrorPropagatingFilter<T>, filter::Filter<T>>;
+    // floating-point IIR filters may optionally be advanced tile-wise in block-parallel SIMD segments, @see 'block_parallel'
+    using BlockFilterImpl = std::conditional_t<std::is_floating_point_v<T>, filter::BlockParallelFilter<T>, std::monostate>;
 
-    FilterImpl _filter;
+    FilterImpl      _filter;
+    BlockFilterImpl _blockFilter{};
+    bool            _useBlockFilter = false;
+    std::vector<T>  _tile; // block-parallel scratch
 
     // Public settings
     Annotated<FilterType, "filter_type", Doc<"Filter type ('FIR' or 'IIR')">, Visible>                                                         filter_type     = FilterType::IIR;
@@ -156,8 +168,9 @@ with selectable filter type (low-pass, high-pass, band-pass, band-stop), and sup
     Annotated<filter::iir::Design, "iir_design_method", Doc<"IIR Filter design method ('BUTTERWORTH', 'BESSEL', 'CHEBYSHEV1', 'CHEBYSHEV2')">> iir_design_method = filter::iir::Design::BUTTERWORTH;
     Annotated<algorithm::window::Type, "fir_design_method", Doc<"FIR Filter design method ('None', 'Rectangular', 'Hamming', 'Hann', 'HannExp', 'Blackman', 'Nuttall', 'BlackmanHarris', 'BlackmanNuttall', 'FlatTop', 'Exponential', 'Kaiser')">> //
         fir_design_method = algorithm::window::Type::Kaiser;
+    Annotated<bool, "block_parallel", Doc<"IIR: filter long chunks as independent, state-stitched SIMD segments (float/double only)">> block_parallel{false};
 
-    GR_MAKE_REFLECTABLE(BasicFilterProto, in, out, filter_type, filter_response, filter_order, f_low, f_high, sample_rate, decimate, iir_design_method, fir_design_method);
+    GR_MAKE_REFLECTABLE(BasicFilterProto, in, out, filter_type, filter_response, filter_order, f_low, f_high, sample_rate, decimate, iir_design_method, fir_design_method, block_parallel);
 
     void settingsChanged(const property_map& /*oldSettings*/, const property_map& /*newSettings*/) { designFilter(); }
 
@@ -175,29 +188,58 @@ with selectable filter type (low-pass, high-pass, band-pass, band-stop), and sup
         params.fHigh = f_high;
         params.fs    = sample_rate;
 
+        _useBlockFilter = false;
+        if (block_parallel) {
+            if constexpr (not std::is_floating_point_v<T>) {
+                throw gr::exception(std::format("Ill-formed block parameters: block_parallel requires a float or double sample type, got {}", meta::type_name<T>()));
+            }
+            if (filter_type != FilterType::IIR) {
+                throw gr::exception(std::format("Ill-formed block parameters: block_parallel applies to IIR filters only, got filter_type: {}", magic_enum::enum_name(filter_type.value)));
+            }
+        }
+
         if (filter_type == FilterType::FIR) { // design FIR filter
             _filter = FilterImpl(fir::designFilter<ValueType>(filter_response, params, fir_design_method));
         } else if (filter_type == FilterType::IIR) { // design IIR filter
+            if constexpr (std::is_floating_point_v<T>) {
+                if (block_parallel) {
+                    _blockFilter = BlockFilterImpl(iir::designFilter<ValueType>(filter_response, params, iir_design_method));
+                    _blockFilter.setProcessing(Processing::BlockParallel);
+                    _tile.resize(BlockFilterImpl::nSegments() * _blockFilter.segmentLength());
+                    _useBlockFilter = true;
+                    return;
+                }
+            }
             _filter = FilterImpl(iir::designFilter<ValueType>(filter_response, params, iir_design_method));
         }
     }
 
-    [[nodiscard]] T processOne(T input) noexcept
-    requires(TParent::ResamplingControl::kIsConst)
-    {
-        return _filter.processOne(input);
-    }
-
-    [[nodiscard]] work::Status processBulk(std::span<const T> input, std::span<T> output) noexcept
-    requires(not TParent::ResamplingControl::kIsConst)
-    {
-        assert(output.size() >= input.size() / decimate);
+    [[nodiscard]] work::Status processBulk(std::span<const T> input, std::span<T> output) noexcept {
+        const std::size_t decim = TParent::ResamplingControl::kIsConst ? 1UZ : static_cast<std::size_t>(decimate.value);
+        assert(output.size() >= input.size() / decim);
 
         std::size_t out_sample_idx = 0;
+        if constexpr (std::is_floating_point_v<T>) {
+            if (_useBlockFilter) { // advance whole tiles, then pick every 'decim'-th sample
+                if (decim == 1UZ) {
+                    _blockFilter.processBlock(input, output.first(input.size()));
+                    return work::Status::OK;
+                }
+                for (std::size_t offset = 0UZ; offset < input.size(); offset += _tile.size()) {
+                    const std::size_t nTile = std::min(_tile.size(), input.size() - offset);
+                    _blockFilter.processBlock(input.subspan(offset, nTile), std::span<T>(_tile).first(nTile));
+                    for (std::size_t i = (decim - offset % decim) % decim; i < nTile; i += decim) {
+                        output[out_sample_idx++] = _tile[i];
+                    }
+                }
+                return work::Status::OK;
+            }
+        }
+
         for (std::size_t i = 0; i < input.size(); ++i) {
             T output_sample = _filter.processOne(input[i]);
 
-            if (i % decimate == 0) {
+            if (i % decim == 0) {
                 output[out_sample_idx++] = output_sample;
             }
         }
@@ -245,6 +287,91 @@ aliasing and sub-sampling related effects.
     }
 };
 
+GR_REGISTER_BLOCK(gr::filter::CicDecimator, [T], [ uint8_t, int8_t, uint16_t, int16_t, int32_t, float, double, std::complex<float>, std::complex<double> ])
+
+template<cic::CicSample T>
+struct CicDecimator : Block<CicDecimator<T>, Resampling<1UZ, 1UZ, false>> {
+    using TParent     = Block<CicDecimator<T>, Resampling<1UZ, 1UZ, false>>;
+    using Description = Doc<R""(@brief Cascaded Integrator-Comb (CIC) Decimator
+
+Multiplier-free decimation by large factors R (e.g. 64 to 4096) for ADC front-ends:
+H(z) = [(1 - z^{-R·M}) / (1 - z^{-1})]^N with N the order and M the differential delay.
+The cost per input sample is independent of R. Integer samples are processed bit-exactly (modular 64-bit
+registers) and normalised by the DC gain (R·M)^N. An optional FIR compensating the sinc^N pass-band droop
+can be appended at the decimated rate.
+)"">;
+
+    PortIn<T>  in;
+    PortOut<T> out;
+
+    Annotated<gr::Size_t, "decimation factor", Doc<"rate-change factor R, i.e. N_out = N_in/R">, Visible>                 decim{64U};
+    Annotated<gr::Size_t, "order", Doc<"number N of integrator-comb stages">, Visible>                                      order{4U};
+    Annotated<gr::Size_t, "differential delay", Doc<"comb differential delay M (usually 1 or 2)">>                          differential_delay{1U};
+    Annotated<bool, "compensation", Doc<"append a FIR compensating the CIC pass-band droop">, Visible>                      compensation{false};
+    Annotated<gr::Size_t, "compensation taps", Doc<"number of compensation FIR taps (odd)">>                                compensation_taps{31U};
+    Annotated<double, "compensation pass-band", Doc<"compensated pass-band edge, normalised to the decimated rate (0, 0.5)">> compensation_cutoff{0.2};
+
+    GR_MAKE_REFLECTABLE(CicDecimator, in, out, decim, order, differential_delay, compensation, compensation_taps, compensation_cutoff);
+
+    cic::Decimator<T> _cic;
+
+    void settingsChanged(const property_map& /*oldSettings*/, const property_map& /*newSettings*/) {
+        std::vector<cic::CompensatorValue<T>> compensator;
+        if (compensation) {
+            compensator = fir::designCicCompensator<cic::CompensatorValue<T>>(order, differential_delay, decim, compensation_taps, compensation_cutoff).b;
+        }
+        _cic                   = cic::Decimator<T>(order, differential_delay, decim, std::move(compensator));
+        this->input_chunk_size = decim;
+    }
+
+    [[nodiscard]] work::Status processBulk(std::span<const T> input, std::span<T> output) noexcept {
+        _cic.process(input, output);
+        return work::Status::OK;
+    }
+};
+
+GR_REGISTER_BLOCK(gr::filter::CicInterpolator, [T], [ uint8_t, int8_t, uint16_t, int16_t, int32_t, float, double, std::complex<float>, std::complex<double> ])
+
+template<cic::CicSample T>
+struct CicInterpolator : Block<CicInterpolator<T>, Resampling<1UZ, 1UZ, false>> {
+    using TParent     = Block<CicInterpolator<T>, Resampling<1UZ, 1UZ, false>>;
+    using Description = Doc<R""(@brief Cascaded Integrator-Comb (CIC) Interpolator
+
+Multiplier-free interpolation by large factors R: zero-stuffing followed by
+H(z) = [(1 - z^{-R·M}) / (1 - z^{-1})]^N with N the order and M the differential delay.
+Integer samples are processed bit-exactly and normalised by the DC gain (R·M)^N/R. An optional FIR
+pre-compensating the sinc^N pass-band droop can be applied at the input rate.
+)"">;
+
+    PortIn<T>  in;
+    PortOut<T> out;
+
+    Annotated<gr::Size_t, "interpolation factor", Doc<"rate-change factor R, i.e. N_out = R·N_in">, Visible>             interp{64U};
+    Annotated<gr::Size_t, "order", Doc<"number N of integrator-comb stages">, Visible>                                     order{4U};
+    Annotated<gr::Size_t, "differential delay", Doc<"comb differential delay M (usually 1 or 2)">>                         differential_delay{1U};
+    Annotated<bool, "compensation", Doc<"prepend a FIR compensating the CIC pass-band droop">, Visible>                    compensation{false};
+    Annotated<gr::Size_t, "compensation taps", Doc<"number of compensation FIR taps (odd)">>                               compensation_taps{31U};
+    Annotated<double, "compensation pass-band", Doc<"compensated pass-band edge, normalised to the input rate (0, 0.5)">> compensation_cutoff{0.2};
+
+    GR_MAKE_REFLECTABLE(CicInterpolator, in, out, interp, order, differential_delay, compensation, compensation_taps, compensation_cutoff);
+
+    cic::Interpolator<T> _cic;
+
+    void settingsChanged(const property_map& /*oldSettings*/, const property_map& /*newSettings*/) {
+        std::vector<cic::CompensatorValue<T>> compensator;
+        if (compensation) {
+            compensator = fir::designCicCompensator<cic::CompensatorValue<T>>(order, differential_delay, interp, compensation_taps, compensation_cutoff).b;
+        }
+        _cic                    = cic::Interpolator<T>(order, differential_delay, interp, std::move(compensator));
+        this->output_chunk_size = interp;
+    }
+
+    [[nodiscard]] work::Status processBulk(std::span<const T> input, std::span<T> output) noexcept {
+        _cic.process(input, output);
+        return work::Status::OK;
+    }
+};
+
 } // namespace gr::filter
 
 #endif // GNURADIO_TIME_DOMAIN_FILTER_HPP
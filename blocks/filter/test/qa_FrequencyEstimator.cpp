@@ -156,6 +156,37 @@ const boost::ut::suite<"FrequencyEstimatorTests"> FrequencyEstimatorTests = [] {
         testFrequencyEstimator(estimator, processFunc, std::vector<float>(testFrequencies.begin(), testFrequencies.end()), sample_rate, numSamples, noiseAmp, tolerance);
     };
 
+    "Frequency Estimator - Frequency Domain: sliding DFT vs. FFT"_test = []<typename T>(const T&) {
+        constexpr float       sample_rate = 1000.0f;
+        constexpr std::size_t numSamples  = 3500UZ; // > 3 x FFT size -> covers several re-anchoring periods
+        const T               tolerance   = std::is_same_v<T, double> ? T(1e-6) : T(2e-2);
+
+        auto configure = [](FrequencyEstimatorFrequencyDomain<T>& estimator, bool slidingDFT) {
+            estimator.sample_rate   = sample_rate;
+            estimator.f_min         = 45.f;
+            estimator.f_expected    = 50.f;
+            estimator.f_max         = 55.f;
+            estimator.min_fft_size  = 1024U;
+            estimator.sliding_dft   = slidingDFT;
+            estimator.resync_period = 1000U;
+            estimator.reset();
+        };
+        FrequencyEstimatorFrequencyDomain<T> sliding;
+        FrequencyEstimatorFrequencyDomain<T> reference;
+        configure(sliding, true);
+        configure(reference, false);
+
+        const auto samples  = generateTestSignal(50.3f, sample_rate, 0.01f, numSamples);
+        T          maxError = T(0);
+        for (std::size_t i = 0UZ; i < samples.size(); ++i) {
+            const T fSliding   = sliding.processOne(static_cast<T>(samples[i]));
+            const T fReference = reference.processOne(static_cast<T>(samples[i]));
+            maxError           = std::max(maxError, std::abs(fSliding - fReference));
+        }
+        expect(le(maxError, tolerance)) << std::format("{}: max deviation sliding DFT vs. FFT: {} Hz", gr::meta::type_name<T>(), maxError);
+        expect(approx(sliding._prevFrequency, T(50.3), T(1))) << "estimate itself within the tolerance of the FFT-based test";
+    } | std::tuple<float, double>{};
+
     skip / "Frequency Estimator - Frequency Domain Decimating"_test = [] {
         constexpr float       sample_rate = 1000.0f; // sampling frequency 1 kHz
         constexpr std::size_t numSamples  = 40960UZ; // number of samples (multiple of chunk size)
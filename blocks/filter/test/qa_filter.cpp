@@ -1,6 +1,8 @@
 #include <boost/ut.hpp>
 
+#include <cstdint>
 #include <format>
+#include <random>
 
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/Graph.hpp>
@@ -9,6 +11,7 @@
 
 #include <gnuradio-4.0/filter/time_domain_filter.hpp>
 #include <gnuradio-4.0/testing/NullSources.hpp>
+#include <gnuradio-4.0/testing/TagMonitors.hpp>
 
 template<typename T, typename Range>
 requires std::floating_point<T>
@@ -138,6 +141,12 @@ const boost::ut::suite<"Basic[Decimating]Filter"> BasicFilterTests = [] {
 
     constexpr static auto maxOp = []<typename T>(const T a, const T b) -> bool { return std::abs(gr::value(a)) < std::abs(gr::value(b)); };
 
+    constexpr static auto processOne = []<typename TFilter, typename T>(TFilter& filter, T input) -> T { // single-sample bulk call
+        T output{};
+        std::ignore = filter.processBulk(std::span<const T>(&input, 1UZ), std::span<T>(&output, 1UZ));
+        return output;
+    };
+
     constexpr static float       sampleRate     = 1000.0;
     constexpr static float       f_low          = 100.0;
     constexpr static std::size_t filterOrder    = 4;
@@ -168,9 +177,9 @@ const boost::ut::suite<"Basic[Decimating]Filter"> BasicFilterTests = [] {
                     // generate a sine wave signal with a frequency below the cutoff
                     phase += T{2} * std::numbers::pi_v<ValueType> * static_cast<ValueType>(50) / static_cast<ValueType>(sampleRate);
                     if (i < numSamples) { // ignore initial transient
-                        std::ignore = filter.processOne(gr::math::sin(phase));
+                        std::ignore = processOne(filter, gr::math::sin(phase));
                     } else {
-                        outputSignal.push_back(filter.processOne(gr::math::sin(phase)));
+                        outputSignal.push_back(processOne(filter, gr::math::sin(phase)));
                     }
                 }
 
@@ -186,9 +195,9 @@ const boost::ut::suite<"Basic[Decimating]Filter"> BasicFilterTests = [] {
                     // generate a sine wave signal with a frequency below the cutoff
                     phase += T{2} * std::numbers::pi_v<ValueType> * static_cast<ValueType>(300) / static_cast<ValueType>(sampleRate);
                     if (i < numSamples) { // ignore initial transient
-                        std::ignore = filter.processOne(gr::math::sin(phase));
+                        std::ignore = processOne(filter, gr::math::sin(phase));
                     } else {
-                        outputSignal.push_back(filter.processOne(gr::math::sin(phase)));
+                        outputSignal.push_back(processOne(filter, gr::math::sin(phase)));
                     }
                 }
 
@@ -261,6 +270,53 @@ const boost::ut::suite<"Basic[Decimating]Filter"> BasicFilterTests = [] {
         };
     } | std::vector<FilterType>({FilterType::FIR, FilterType::IIR});
 
+    "BasicFilter - block-parallel IIR matches serial"_test = []<typename T>() {
+        auto configure = [](BasicFilter<T>& filter, bool blockParallel) {
+            filter.filter_type     = FilterType::IIR;
+            filter.filter_response = filter::Type::LOWPASS;
+            filter.filter_order    = 8U;
+            filter.f_low           = 20.;
+            filter.sample_rate     = sampleRate;
+            filter.block_parallel  = blockParallel;
+            filter.designFilter();
+        };
+        BasicFilter<T> serial;
+        BasicFilter<T> parallel;
+        configure(serial, false);
+        configure(parallel, true);
+
+        std::mt19937                rng(42U);
+        std::normal_distribution<T> noise(T(0), T(1));
+        std::vector<T>              input(20'000UZ);
+        std::ranges::generate(input, [&] { return noise(rng); });
+        std::vector<T> expected(input.size());
+        std::vector<T> actual(input.size());
+        expect(serial.processBulk(input, expected) == work::Status::OK);
+        for (std::size_t offset = 0UZ, chunk = 1UZ; offset < input.size(); offset += chunk, chunk = chunk * 3UZ + 7UZ) { // ragged chunks: full tiles + serial remainders
+            chunk = std::min(chunk, input.size() - offset);
+            expect(parallel.processBulk(std::span<const T>(input).subspan(offset, chunk), std::span<T>(actual).subspan(offset, chunk)) == work::Status::OK);
+        }
+
+        // documented tolerance (cf. BlockParallelFilter): 1e-4 (float), 1e-10 (double) relative to the output amplitude
+        const T tolerance = std::is_same_v<T, float> ? T(1e-4) : T(1e-10);
+        const T amplitude = std::abs(*std::ranges::max_element(expected, maxOp));
+        T       maxError  = T(0);
+        for (std::size_t i = 0UZ; i < input.size(); ++i) {
+            maxError = std::max(maxError, std::abs(actual[i] - expected[i]));
+        }
+        expect(le(maxError, tolerance * amplitude)) << std::format("max deviation {} vs. amplitude {}", maxError, amplitude);
+
+        BasicFilter<T> fir;
+        configure(fir, false);
+        fir.filter_type    = FilterType::FIR;
+        fir.block_parallel = true;
+        expect(throws<gr::exception>([&fir] { fir.designFilter(); })) << "block_parallel is IIR-only";
+
+        BasicFilter<UncertainValue<T>> uncertain;
+        uncertain.block_parallel = true;
+        expect(throws<gr::exception>([&uncertain] { uncertain.designFilter(); })) << "block_parallel requires a float or double sample type";
+    } | std::tuple<float, double>();
+
     "Decimator - Low-pass Filter Test"_test = [] {
         using namespace gr::testing;
         using T = int;
@@ -289,4 +345,122 @@ const boost::ut::suite<"Basic[Decimating]Filter"> BasicFilterTests = [] {
     };
 };
 
+/// integer reference: direct convolution with the CIC impulse response (N cascaded boxcars of length R·M), normalised to unity DC gain and rounded to nearest (ties away from zero)
+template<std::integral T>
+std::vector<T> referenceCic(std::span<const T> input, std::size_t order, std::size_t length, std::size_t rate, std::size_t outputOffset, std::int64_t dcGain) {
+    std::vector<std::int64_t> h{1};
+    for (std::size_t stage = 0UZ; stage < order; ++stage) {
+        std::vector<std::int64_t> convolved(h.size() + length - 1UZ, 0);
+        for (std::size_t i = 0UZ; i < h.size(); ++i) {
+            for (std::size_t j = 0UZ; j < length; ++j) {
+                convolved[i + j] += h[i];
+            }
+        }
+        h = std::move(convolved);
+    }
+
+    std::vector<T> output;
+    for (std::size_t n = outputOffset; n < input.size(); n += rate) {
+        std::int64_t sum = 0;
+        for (std::size_t k = 0UZ; k < h.size() && k <= n; ++k) {
+            sum += h[k] * static_cast<std::int64_t>(input[n - k]);
+        }
+        output.push_back(static_cast<T>(sum >= 0 ? (sum + dcGain / 2) / dcGain : -((-sum + dcGain / 2) / dcGain)));
+    }
+    return output;
+}
+
+template<typename TCic, typename T>
+std::vector<T> runCic(const std::vector<T>& input, const gr::property_map& settings) {
+    using namespace boost::ut;
+    using namespace gr::testing;
+
+    gr::Graph flow;
+    auto&     source = flow.emplaceBlock<TagSource<T>>({{"values", input}, {"n_samples_max", static_cast<gr::Size_t>(input.size())}, {"mark_tag", false}});
+    auto&     cic    = flow.emplaceBlock<TCic>(settings);
+    auto&     sink   = flow.emplaceBlock<TagSink<T, ProcessFunction::USE_PROCESS_BULK>>();
+    expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(source).template to<"in">(cic)));
+    expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(cic).template to<"in">(sink)));
+
+    gr::scheduler::Simple<> sched;
+    if (auto ret = sched.exchange(std::move(flow)); !ret) {
+        throw std::runtime_error(std::format("failed to initialize scheduler: {}", ret.error()));
+    }
+    expect(sched.runAndWait().has_value());
+    return sink._samples;
+}
+
+const boost::ut::suite<"CIC decimator/interpolator"> CicTests = [] {
+    using namespace boost::ut;
+    using namespace gr::filter;
+
+    "CicDecimator - integer-exact"_test = [] {
+        using T = std::int16_t;
+        constexpr std::size_t order     = 3UZ;
+        constexpr std::size_t diffDelay = 2UZ;
+        constexpr std::size_t rate      = 16UZ;
+
+        std::mt19937                       rng(42);
+        std::uniform_int_distribution<int> dist(std::numeric_limits<T>::lowest(), std::numeric_limits<T>::max());
+        std::vector<T>                     input(rate * 64UZ);
+        std::ranges::generate(input, [&] { return static_cast<T>(dist(rng)); });
+
+        const auto output   = runCic<CicDecimator<T>>(input, {{"decim", static_cast<gr::Size_t>(rate)}, {"order", static_cast<gr::Size_t>(order)}, {"differential_delay", static_cast<gr::Size_t>(diffDelay)}});
+        const auto expected = referenceCic<T>(input, order, rate * diffDelay, rate, rate - 1UZ, static_cast<std::int64_t>(std::pow(rate * diffDelay, order)));
+        expect(eq(output.size(), input.size() / rate));
+        expect(std::ranges::equal(output, expected)) << "CIC decimator output differs from the exact integer reference";
+    };
+
+    "CicDecimator - full-scale DC at the register limit"_test = [] {
+        using T = std::int16_t;
+        cic::Decimator<T> decimator(4UZ, 1UZ, 4096UZ); // 16 + 48 = 64 bits
+        std::vector<T>    input(4096UZ * 8UZ, std::numeric_limits<T>::lowest());
+        std::vector<T>    output(8UZ);
+        decimator.process(input, output);
+        expect(eq(output.back(), std::numeric_limits<T>::lowest()));
+
+        expect(throws<std::invalid_argument>([] { std::ignore = cic::Decimator<T>(5UZ, 1UZ, 4096UZ); })) << "76-bit register should be rejected";
+    };
+
+    "CicDecimator - floating-point DC gain and compensation"_test = [](bool compensation) {
+        using T                   = float;
+        constexpr gr::Size_t rate = 64U;
+        const std::vector<T> input(rate * 64UZ, T{1});
+
+        const auto output = runCic<CicDecimator<T>>(input, {{"decim", rate}, {"order", gr::Size_t{4U}}, {"compensation", compensation}});
+        expect(eq(output.size(), input.size() / rate));
+        expect(approx(output.back(), T{1}, T{1e-5f})) << std::format("compensation: {}", compensation);
+    } | std::vector{false, true};
+
+    "CicInterpolator - integer-exact"_test = [] {
+        using T = std::int16_t;
+        constexpr std::size_t order = 4UZ;
+        constexpr std::size_t rate  = 8UZ;
+
+        std::mt19937                       rng(7);
+        std::uniform_int_distribution<int> dist(-1000, 1000);
+        std::vector<T>                     input(64UZ);
+        std::ranges::generate(input, [&] { return static_cast<T>(dist(rng)); });
+        std::vector<T> stuffed(input.size() * rate, T{0});
+        for (std::size_t i = 0UZ; i < input.size(); ++i) {
+            stuffed[i * rate] = input[i];
+        }
+
+        const auto output   = runCic<CicInterpolator<T>>(input, {{"interp", static_cast<gr::Size_t>(rate)}, {"order", static_cast<gr::Size_t>(order)}});
+        const auto expected = referenceCic<T>(stuffed, order, rate, 1UZ, 0UZ, static_cast<std::int64_t>(std::pow(rate, order - 1UZ)));
+        expect(eq(output.size(), input.size() * rate));
+        expect(std::ranges::equal(output, expected)) << "CIC interpolator output differs from the exact integer reference";
+    };
+
+    "CicInterpolator - floating-point DC gain"_test = [] {
+        using T                   = double;
+        constexpr gr::Size_t rate = 5U;
+        const std::vector<T> input(64UZ, T{-2});
+
+        const auto output = runCic<CicInterpolator<T>>(input, {{"interp", rate}, {"order", gr::Size_t{3U}}, {"differential_delay", gr::Size_t{2U}}, {"compensation", true}});
+        expect(eq(output.size(), input.size() * rate));
+        expect(approx(output.back(), T{-2}, T{1e-9}));
+    };
+};
+
 int main() { /* not needed for UT */ }
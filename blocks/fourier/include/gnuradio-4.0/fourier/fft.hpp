@@ -6,10 +6,12 @@
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/BlockRegistry.hpp>
 #include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/DataSetPool.hpp>
 #include <gnuradio-4.0/HistoryBuffer.hpp>
 
 #include <gnuradio-4.0/algorithm/fourier/fft.hpp>
 #include <gnuradio-4.0/algorithm/fourier/fft_common.hpp>
+#include <gnuradio-4.0/algorithm/fourier/fft_parallel.hpp>
 #include <gnuradio-4.0/algorithm/fourier/fftw.hpp>
 #include <gnuradio-4.0/algorithm/fourier/window.hpp>
 
@@ -90,6 +92,9 @@ On the choice of window (mathematically aka. apodisation) functions
 @tparam T type of the input signal.
 @tparam U type of the output data (presently limited to DataSet<float> and DataSet<double>)
 @tparam FourierAlgorithm the specific algorithm used to perform the Fourier Transform (can be DFT, FFT, FFTW).
+
+Transforms with 'fftSize >= parallelThreshold' use the multi-threaded six-step algorithm ('FFTParallel') on the
+default CPU thread pool instead of 'FourierAlgorithm' (0: always single-threaded).
 )"">;
     using value_type  = U::value_type;
     using InDataType  = std::conditional_t<gr::meta::complex_like<T>, std::complex<value_type>, value_type>;
@@ -98,9 +103,10 @@ On the choice of window (mathematically aka. apodisation) functions
     PortIn<T>                         in{};
     PortOut<U, RequiredSamples<1, 1>> out{};
 
-    FourierAlgorithm<T, std::complex<typename U::value_type>> _fftImpl{};
-    gr::algorithm::window::Type                               _windowType = gr::algorithm::window::Type::Hann;
-    std::vector<value_type>                                   _window     = gr::algorithm::window::create<value_type>(_windowType, 1024U);
+    FourierAlgorithm<T, std::complex<typename U::value_type>>           _fftImpl{};
+    gr::algorithm::FFTParallel<T, std::complex<typename U::value_type>> _fftParallelImpl{};
+    gr::algorithm::window::Type                                         _windowType = gr::algorithm::window::Type::Hann;
+    gr::algorithm::window::SharedWindow<value_type>                     _window     = gr::algorithm::window::cached<value_type>(_windowType, 1024U);
 
     // settings
     const std::string                                                                algorithm = gr::meta::type_name<decltype(_fftImpl)>();
@@ -109,13 +115,14 @@ On the choice of window (mathematically aka. apodisation) functions
     Annotated<bool, "output in dB", Doc<"calculate output in decibels">>             outputInDb{false};
     Annotated<bool, "output in deg", Doc<"calculate phase in degrees">>              outputInDeg{false};
     Annotated<bool, "unwrap phase", Doc<"calculate unwrapped phase">>                unwrapPhase{false};
+    Annotated<gr::Size_t, "parallel threshold", Doc<"min. size for six-step FFT">>   parallelThreshold{1U << 20U};
     Annotated<float, "sample rate", Doc<"signal sample rate">, Unit<"Hz">>           sample_rate = 1.f;
     Annotated<std::string, "signal name", Visible>                                   signal_name = "unknown signal";
     Annotated<std::string, "signal unit", Visible, Doc<"signal's physical SI unit">> signal_unit = "a.u.";
     Annotated<float, "signal min", Doc<"signal physical min. (e.g. DAQ) limit">>     signal_min  = -std::numeric_limits<float>::max();
     Annotated<float, "signal max", Doc<"signal physical max. (e.g. DAQ) limit">>     signal_max  = +std::numeric_limits<float>::max();
 
-    GR_MAKE_REFLECTABLE(FFT, in, out, algorithm, fftSize, window, outputInDb, outputInDeg, unwrapPhase, sample_rate, signal_name, signal_unit, signal_min, signal_max);
+    GR_MAKE_REFLECTABLE(FFT, in, out, algorithm, fftSize, window, outputInDb, outputInDeg, unwrapPhase, parallelThreshold, sample_rate, signal_name, signal_unit, signal_min, signal_max);
 
     // semi-private caching vectors (need to be public for unit-test) -> TODO: move to FFT implementations, casting from T -> U::value_type should be done there
     std::vector<InDataType>  _inData             = std::vector<InDataType>(fftSize, 0);
@@ -134,10 +141,9 @@ On the choice of window (mathematically aka. apodisation) functions
         in.max_samples            = newSize;
         in.min_samples            = newSize;
         this->input_chunk_size    = newSize;
-        _window.resize(newSize, 0);
 
         _windowType = magic_enum::enum_cast<gr::algorithm::window::Type>(window, magic_enum::case_insensitive).value_or(_windowType);
-        gr::algorithm::window::create(_window, _windowType);
+        _window     = gr::algorithm::window::cached<value_type>(_windowType, newSize); // shared with all other FFT blocks of the same configuration
 
         // N.B. this should become part of the Fourier transform implementation
         _inData.resize(fftSize, 0);
@@ -163,22 +169,25 @@ On the choice of window (mathematically aka. apodisation) functions
             }
         }
 
-        _outData           = _fftImpl.compute(_inData);
+        if (parallelThreshold > 0U && fftSize >= parallelThreshold) {
+            _outData = _fftParallelImpl.compute(_inData);
+        } else {
+            _outData = _fftImpl.compute(_inData);
+        }
         _magnitudeSpectrum = gr::algorithm::fft::computeMagnitudeSpectrum(_outData, _magnitudeSpectrum, algorithm::fft::ConfigMagnitude{.computeHalfSpectrum = !computeFullSpectrum, .outputInDb = outputInDb, .shiftSpectrum = true});
         _phaseSpectrum     = gr::algorithm::fft::computePhaseSpectrum(_outData, _phaseSpectrum, algorithm::fft::ConfigPhase{.computeHalfSpectrum = !computeFullSpectrum, .outputInDeg = outputInDeg, .unwrapPhase = unwrapPhase, .shiftSpectrum = true});
 
-        output[0] = createDataset();
+        gr::publishRecycled(output[0], createDataset()); // previous (consumed) slot storage is returned to the pool
 
         return work::Status::OK;
     }
 
-    constexpr U createDataset() {
-        U ds{};
-        ds.timestamp = 0;
+    U createDataset() {
         const std::size_t     N{_magnitudeSpectrum.size()};
         constexpr std::size_t nSignals = 4;
+        U                     ds       = gr::globalDataSetPool<typename U::value_type>().acquire({static_cast<int32_t>(N)}, nSignals);
+        ds.timestamp                   = 0;
 
-        ds.extents = {static_cast<int32_t>(N)};
         ds.layout  = gr::LayoutRight{}; // row-major
 
         // define x-axis (N.B. only one dependent axis <-> nSignals x 1D DataSets)
@@ -1,9 +1,16 @@
 #ifndef GNURADIO_MATH_HPP
 #define GNURADIO_MATH_HPP
 
+#include <array>
+#include <functional>
+#include <span>
+
+#include <vir/simd.h>
+
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/BlockRegistry.hpp>
 #include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/meta/UncertainSpan.hpp>
 #include <gnuradio-4.0/meta/UncertainValue.hpp>
 
 namespace gr::blocks::math {
@@ -19,6 +26,144 @@ T defaultValue() noexcept {
         return T{};
     }
 }
+
+template<typename T, typename Op, typename V>
+[[nodiscard]] constexpr V applyOp(const V& a, const V& b) noexcept {
+    if constexpr (std::same_as<Op, std::plus<T>>) {
+        return static_cast<V>(a + b); // N.B. integral promotion for small integer types
+    } else if constexpr (std::same_as<Op, std::minus<T>>) {
+        return static_cast<V>(a - b);
+    } else if constexpr (std::same_as<Op, std::multiplies<T>>) {
+        return static_cast<V>(a * b);
+    } else if constexpr (std::same_as<Op, std::divides<T>>) {
+        return static_cast<V>(a / b);
+    } else {
+        static_assert(gr::meta::always_false<T>, "unknown op");
+        return V{};
+    }
+}
+
+/**
+ * @brief single-pass fused N-ary kernel: out[i] = op(...op(op(w_0 * in_0[i], w_1 * in_1[i]), w_2 * in_2[i])..., w_{N-1} * in_{N-1}[i])
+ *
+ * Each input is read once and the output is written once, rather than one read-modify-write pass over the output per input.
+ * The output is processed in tiles of 'kUnroll' SIMD registers that act as accumulators while all inputs are folded in,
+ * i.e. the memory traffic is (N + 1) x nSamples independent of the number of inputs. Non-arithmetic types (e.g. std::complex)
+ * use the same tiling with scalar accumulators. Missing weights default to 1 (empty: unweighted, no multiplication).
+ */
+template<typename T, typename Op, typename TInputs>
+void foldInputs(const TInputs& ins, std::span<T> out, std::span<const T> weights = {}) noexcept {
+    const std::size_t nInputs  = std::ranges::size(ins);
+    const std::size_t nSamples = out.size();
+    if (nInputs == 0UZ) {
+        return;
+    }
+    const bool weighted = !weights.empty();
+    const auto weight   = [&weights](std::size_t n) { return n < weights.size() ? weights[n] : T(1); };
+    const auto input    = [&ins](std::size_t n) -> const T* { return std::ranges::data(ins[n]); };
+
+    std::size_t i = 0UZ;
+    if constexpr (std::is_arithmetic_v<T>) {
+        using V                       = vir::stdx::native_simd<T>;
+        constexpr std::size_t kUnroll = 4UZ; // independent accumulators -> hides the op latency, 4 x in + 4 x acc fit into 16 registers
+        constexpr std::size_t kTile   = kUnroll * V::size();
+
+        const auto tile = [&]<bool kWeighted>(std::size_t offset) {
+            std::array<V, kUnroll> acc;
+            for (std::size_t u = 0UZ; u < kUnroll; ++u) {
+                acc[u] = V(input(0UZ) + offset + u * V::size(), vir::stdx::element_aligned);
+                if constexpr (kWeighted) {
+                    acc[u] *= V(weight(0UZ));
+                }
+            }
+            for (std::size_t n = 1UZ; n < nInputs; ++n) {
+                const T* x = input(n) + offset;
+                const V  w(weight(n));
+                for (std::size_t u = 0UZ; u < kUnroll; ++u) {
+                    V value(x + u * V::size(), vir::stdx::element_aligned);
+                    if constexpr (kWeighted) {
+                        value *= w;
+                    }
+                    acc[u] = applyOp<T, Op>(acc[u], value);
+                }
+            }
+            for (std::size_t u = 0UZ; u < kUnroll; ++u) {
+                acc[u].copy_to(out.data() + offset + u * V::size(), vir::stdx::element_aligned);
+            }
+        };
+
+        if (weighted) {
+            for (; i + kTile <= nSamples; i += kTile) {
+                tile.template operator()<true>(i);
+            }
+        } else {
+            for (; i + kTile <= nSamples; i += kTile) {
+                tile.template operator()<false>(i);
+            }
+        }
+    }
+
+    constexpr std::size_t kScalarTile = 8UZ;
+    for (; i < nSamples; i += kScalarTile) { // tail, or all samples for non-arithmetic types
+        const std::size_t          nTile = std::min(kScalarTile, nSamples - i);
+        const T*                   x0    = input(0UZ) + i;
+        std::array<T, kScalarTile> acc;
+        for (std::size_t k = 0UZ; k < nTile; ++k) {
+            acc[k] = weighted ? static_cast<T>(weight(0UZ) * x0[k]) : x0[k];
+        }
+        for (std::size_t n = 1UZ; n < nInputs; ++n) {
+            const T* x = input(n) + i;
+            const T  w = weight(n);
+            for (std::size_t k = 0UZ; k < nTile; ++k) {
+                acc[k] = applyOp<T, Op>(acc[k], weighted ? static_cast<T>(w * x[k]) : x[k]);
+            }
+        }
+        std::copy_n(acc.begin(), nTile, out.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+}
+
+/**
+ * @brief UncertainValue<T> version of 'foldInputs': the inputs are converted tile-wise into the structure-of-arrays layout and
+ * folded with the batched SIMD kernels of 'UncertainSpan.hpp' (same propagation rules as the scalar UncertainValue operators).
+ */
+template<UncertainValueLike T, typename Op, typename TInputs>
+void foldUncertainInputs(const TInputs& ins, std::span<T> out) noexcept {
+    using R = typename T::value_type;
+
+    constexpr std::size_t kTile    = 256UZ;
+    const std::size_t     nInputs  = std::ranges::size(ins);
+    const std::size_t     nSamples = out.size();
+    if (nInputs == 0UZ) {
+        return;
+    }
+    const auto input = [&ins](std::size_t n, std::size_t offset, std::size_t count) { return std::span<const T>(std::ranges::data(ins[n]) + offset, count); };
+
+    std::array<R, kTile> accValue;
+    std::array<R, kTile> accUncertainty;
+    std::array<R, kTile> xValue;
+    std::array<R, kTile> xUncertainty;
+    for (std::size_t offset = 0UZ; offset < nSamples; offset += kTile) {
+        const std::size_t      nTile = std::min(kTile, nSamples - offset);
+        const UncertainSpan<R> acc{std::span(accValue).first(nTile), std::span(accUncertainty).first(nTile)};
+        const UncertainSpan<R> x{std::span(xValue).first(nTile), std::span(xUncertainty).first(nTile)};
+        toSoA<R>(input(0UZ, offset, nTile), acc);
+        for (std::size_t n = 1UZ; n < nInputs; ++n) {
+            toSoA<R>(input(n, offset, nTile), x);
+            if constexpr (std::same_as<Op, std::plus<T>>) {
+                gr::math::add<R>(acc, x, acc);
+            } else if constexpr (std::same_as<Op, std::minus<T>>) {
+                gr::math::subtract<R>(acc, x, acc);
+            } else if constexpr (std::same_as<Op, std::multiplies<T>>) {
+                gr::math::multiply<R>(acc, x, acc);
+            } else if constexpr (std::same_as<Op, std::divides<T>>) {
+                gr::math::divide<R>(acc, x, acc);
+            } else {
+                static_assert(gr::meta::always_false<T>, "unknown op");
+            }
+        }
+        toAoS<R>(acc, out.subspan(offset, nTile));
+    }
+}
 } // namespace detail
 
 GR_REGISTER_BLOCK("gr::blocks::math::AddConst", gr::blocks::math::MathOpImpl, ([T], std::plus<[T]>), [ uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double> ])
@@ -70,7 +215,7 @@ GR_REGISTER_BLOCK("gr::blocks::math::Multiply", gr::blocks::math::MathOpImpl, ([
 GR_REGISTER_BLOCK("gr::blocks::math::Divide", gr::blocks::math::MathOpImpl, ([T], std::divides<[T]>), [ uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double> ])
 
 template<typename T, typename op>
-requires(std::is_arithmetic_v<T>)
+requires(std::is_arithmetic_v<T> || (UncertainValueLike<T> && std::floating_point<typename T::value_type>))
 struct MathOpMultiPortImpl : Block<MathOpMultiPortImpl<T, op>> {
     using Description = Doc<R""(@brief Math block combining multiple inputs into a single output with a given operation
 
@@ -98,9 +243,10 @@ struct MathOpMultiPortImpl : Block<MathOpMultiPortImpl<T, op>> {
 
     template<gr::InputSpanLike TInSpan>
     gr::work::Status processBulk(const std::span<TInSpan>& ins, gr::OutputSpanLike auto& sout) const {
-        std::copy(ins[0].begin(), ins[0].end(), sout.begin());
-        for (std::size_t n = 1; n < ins.size(); n++) {
-            std::transform(sout.begin(), sout.end(), ins[n].begin(), sout.begin(), op{});
+        if constexpr (UncertainValueLike<T>) {
+            detail::foldUncertainInputs<T, op>(ins, std::span<T>(std::ranges::data(sout), std::ranges::size(sout)));
+        } else {
+            detail::foldInputs<T, op>(ins, std::span<T>(std::ranges::data(sout), std::ranges::size(sout)));
         }
         return gr::work::Status::OK;
     }
@@ -115,6 +261,44 @@ using Multiply = MathOpMultiPortImpl<T, std::multiplies<T>>;
 template<typename T>
 using Divide = MathOpMultiPortImpl<T, std::divides<T>>;
 
+GR_REGISTER_BLOCK(gr::blocks::math::WeightedSum, [T], [ float, double, std::complex<float>, std::complex<double> ])
+
+template<typename T>
+requires(std::is_floating_point_v<T> || gr::meta::complex_like<T>)
+struct WeightedSum : Block<WeightedSum<T>> {
+    using Description = Doc<R""(@brief Weighted sum of multiple inputs: out = w_0 * in_0 + w_1 * in_1 + ... + w_{N-1} * in_{N-1}
+
+    Typical use: channel combining and (narrow-band) beamforming with per-channel (complex) steering weights.
+    Missing weights default to 1. Each input is read and the output is written only once per sample.
+    )"">;
+
+    // ports
+    std::vector<PortIn<T>> in;
+    PortOut<T>             out;
+
+    // settings
+    Annotated<gr::Size_t, "n_inputs", Visible, Doc<"Number of inputs">, Limits<1U, 1024U>> n_inputs = 0U;
+    Annotated<std::vector<T>, "weights", Doc<"per-input weights (missing entries: 1)">>    weights{};
+
+    GR_MAKE_REFLECTABLE(WeightedSum, in, out, n_inputs, weights);
+
+    std::vector<T> _weights; // 'weights' padded to 'n_inputs'
+
+    void settingsChanged(const gr::property_map& old_settings, const gr::property_map& new_settings) {
+        if (new_settings.contains("n_inputs") && old_settings.at("n_inputs") != new_settings.at("n_inputs")) {
+            in.resize(n_inputs);
+        }
+        _weights = weights.value;
+        _weights.resize(n_inputs, T(1));
+    }
+
+    template<gr::InputSpanLike TInSpan>
+    gr::work::Status processBulk(const std::span<TInSpan>& ins, gr::OutputSpanLike auto& sout) const {
+        detail::foldInputs<T, std::plus<T>>(ins, std::span<T>(std::ranges::data(sout), std::ranges::size(sout)), _weights);
+        return gr::work::Status::OK;
+    }
+};
+
 } // namespace gr::blocks::math
 
 #endif // GNURADIO_MATH_HPP
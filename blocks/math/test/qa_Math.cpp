@@ -1,5 +1,7 @@
 #include <boost/ut.hpp>
 
+#include <numeric>
+
 #include <gnuradio-4.0/math/Math.hpp>
 
 #include <gnuradio-4.0/Block.hpp>
@@ -14,7 +16,7 @@ struct TestParameters {
 };
 
 template<typename T, typename BlockUnderTest>
-void test_block(const TestParameters<T> p) {
+void test_block(const TestParameters<T> p, gr::property_map settings = {}) {
     using namespace boost::ut;
     using namespace gr;
     using namespace gr::testing;
@@ -23,7 +25,8 @@ void test_block(const TestParameters<T> p) {
 
     // build test graph
     Graph graph;
-    auto& block = graph.emplaceBlock<BlockUnderTest>({{"n_inputs", n_inputs}});
+    settings.insert_or_assign("n_inputs", n_inputs);
+    auto& block = graph.emplaceBlock<BlockUnderTest>(std::move(settings));
     for (Size_t i = 0; i < n_inputs; ++i) {
         auto& src = graph.emplaceBlock<TagSource<T>>({{"values", p.inputs[i]}, {"n_samples_max", static_cast<Size_t>(p.inputs[i].size())}});
         expect(eq(graph.connect(src, "out"s, block, "in#"s + std::to_string(i)), ConnectionResult::SUCCESS)) << std::format("Failed to connect output port of src {} to input port 'in#{}' of block", i, i);
@@ -116,8 +119,76 @@ std::complex<float>, std::complex<double>*/>();
             .output = { 0,  1,  2,  2}});
     } | kArithmeticTypes;
 
+    "WeightedSum"_test = []<typename T>(const T&) {
+        test_block<T, WeightedSum<T>>({
+            .inputs = {{1, 2,  3,  4},
+                       {5, 6,  7,  8},
+                       {1, 1,  1,  1}},
+            .output = { 9, 12, 15, 18}}, {{"weights", std::vector<T>{T(2), T(1)}}}); // missing weight -> 1
+    } | std::tuple<float, double>();
+
     // clang-format on
 
+    "fused multi-input kernel"_test = []<typename T>(const T&) {
+        constexpr std::size_t       kInputs  = 7UZ;
+        constexpr std::size_t       kSamples = 203UZ; // SIMD tiles + scalar tail
+        std::vector<std::vector<T>> inputs(kInputs, std::vector<T>(kSamples));
+        for (std::size_t n = 0UZ; n < kInputs; ++n) {
+            for (std::size_t i = 0UZ; i < kSamples; ++i) {
+                inputs[n][i] = static_cast<T>((i + 3UZ * n) % 11UZ + 1UZ);
+            }
+        }
+        std::vector<T> weights(kInputs - 2UZ); // last two weights default to 1
+        std::iota(weights.begin(), weights.end(), T(1));
+
+        std::vector<T> sum(kSamples);
+        std::vector<T> weightedSum(kSamples);
+        std::vector<T> product(kSamples);
+        detail::foldInputs<T, std::plus<T>>(inputs, std::span(sum));
+        detail::foldInputs<T, std::plus<T>>(inputs, std::span(weightedSum), std::span<const T>(weights));
+        detail::foldInputs<T, std::multiplies<T>>(std::span(inputs).first(3UZ), std::span(product));
+        for (std::size_t i = 0UZ; i < kSamples; ++i) {
+            T expectedSum{};
+            T expectedWeighted{};
+            for (std::size_t n = 0UZ; n < kInputs; ++n) {
+                expectedSum += inputs[n][i];
+                expectedWeighted += (n < weights.size() ? weights[n] : T(1)) * inputs[n][i];
+            }
+            expect(eq(sum[i], expectedSum)) << std::format("sum[{}] for type {}", i, meta::type_name<T>());
+            expect(eq(weightedSum[i], expectedWeighted)) << std::format("weighted sum[{}] for type {}", i, meta::type_name<T>());
+            expect(eq(product[i], static_cast<T>(inputs[0][i] * inputs[1][i] * inputs[2][i]))) << std::format("product[{}] for type {}", i, meta::type_name<T>());
+        }
+    } | std::tuple<int32_t, float, double>();
+
+    "fused multi-input kernel - UncertainValue<T>"_test = []<typename T>(const T&) {
+        using U = UncertainValue<T>;
+
+        constexpr std::size_t       kInputs  = 3UZ;
+        constexpr std::size_t       kSamples = 301UZ; // > one SoA tile + scalar tail
+        std::vector<std::vector<U>> inputs(kInputs, std::vector<U>(kSamples));
+        for (std::size_t n = 0UZ; n < kInputs; ++n) {
+            for (std::size_t i = 0UZ; i < kSamples; ++i) {
+                inputs[n][i] = U{static_cast<T>((i + 3UZ * n) % 11UZ + 1UZ), static_cast<T>(0.1) * static_cast<T>(n + 1UZ)};
+            }
+        }
+
+        std::vector<U> sum(kSamples);
+        std::vector<U> product(kSamples);
+        std::vector<U> quotient(kSamples);
+        detail::foldUncertainInputs<U, std::plus<U>>(inputs, std::span(sum));
+        detail::foldUncertainInputs<U, std::multiplies<U>>(inputs, std::span(product));
+        detail::foldUncertainInputs<U, std::divides<U>>(inputs, std::span(quotient));
+        const T tolerance = std::is_same_v<T, float> ? T(1e-4f) : T(1e-10);
+        for (std::size_t i = 0UZ; i < kSamples; ++i) {
+            const U expectedSum      = inputs[0][i] + inputs[1][i] + inputs[2][i];
+            const U expectedProduct  = inputs[0][i] * inputs[1][i] * inputs[2][i];
+            const U expectedQuotient = inputs[0][i] / inputs[1][i] / inputs[2][i];
+            expect(approx(sum[i].value, expectedSum.value, tolerance) && approx(sum[i].uncertainty, expectedSum.uncertainty, tolerance)) << std::format("sum[{}] for type {}", i, meta::type_name<T>());
+            expect(approx(product[i].value, expectedProduct.value, tolerance * expectedProduct.value) && approx(product[i].uncertainty, expectedProduct.uncertainty, tolerance * expectedProduct.value)) << std::format("product[{}] for type {}", i, meta::type_name<T>());
+            expect(approx(quotient[i].value, expectedQuotient.value, tolerance) && approx(quotient[i].uncertainty, expectedQuotient.uncertainty, tolerance)) << std::format("quotient[{}] for type {}", i, meta::type_name<T>());
+        }
+    } | std::tuple<float, double>();
+
     "AddConst"_test = []<typename T>(const T&) {
         expect(eq(AddConst<T>().processOne(T(4)), T(4) + T(1))) << std::format("AddConst test for type {}\n", meta::type_name<T>());
         auto block = AddConst<T>(property_map{{"value", T(2)}});
@@ -0,0 +1,211 @@
+#ifndef GNURADIO_NETWORK_SOCKET_HPP
+#define GNURADIO_NETWORK_SOCKET_HPP
+
+#include <gnuradio-4.0/Message.hpp> // for gr::exception
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#ifndef SO_ZEROCOPY
+#define SO_ZEROCOPY 60 // older kernel headers (Linux >= 4.14 implements it)
+#endif
+#ifndef MSG_ZEROCOPY
+#define MSG_ZEROCOPY 0x4000000
+#endif
+
+namespace gr::blocks::network {
+
+enum class PayloadFormat {
+    raw,      /// datagram contains only the samples
+    sequenced /// datagram is prefixed by a 16-byte 'PacketHeader' (VITA-49-like packet count and sample index)
+};
+
+namespace detail {
+
+/**
+ * @brief minimal RAII owner of a POSIX socket file-descriptor (move-only)
+ */
+class Socket {
+    int _fd = -1;
+
+public:
+    Socket() = default;
+    explicit Socket(int fd) noexcept : _fd(fd) {}
+    Socket(int domain, int type, int protocol = 0) : _fd(::socket(domain, type, protocol)) {
+        if (_fd < 0) {
+            throw gr::exception(std::format("socket({}, {}, {}) failed: {}", domain, type, protocol, std::strerror(errno)));
+        }
+    }
+    Socket(const Socket&)            = delete;
+    Socket& operator=(const Socket&) = delete;
+    Socket(Socket&& other) noexcept : _fd(std::exchange(other._fd, -1)) {}
+    Socket& operator=(Socket&& other) noexcept {
+        if (this != &other) {
+            close();
+            _fd = std::exchange(other._fd, -1);
+        }
+        return *this;
+    }
+    ~Socket() { close(); }
+
+    void close() noexcept {
+        if (_fd >= 0) {
+            ::close(_fd);
+            _fd = -1;
+        }
+    }
+
+    [[nodiscard]] int  fd() const noexcept { return _fd; }
+    [[nodiscard]] bool isOpen() const noexcept { return _fd >= 0; }
+    explicit           operator bool() const noexcept { return isOpen(); }
+
+    template<typename T>
+    bool setOption(int level, int option, T value) noexcept {
+        return ::setsockopt(_fd, level, option, &value, static_cast<socklen_t>(sizeof(T))) == 0;
+    }
+
+    template<typename T>
+    [[nodiscard]] T getOption(int level, int option, T defaultValue = T{}) const noexcept {
+        T         value  = defaultValue;
+        socklen_t length = sizeof(T);
+        if (::getsockopt(_fd, level, option, &value, &length) != 0) {
+            return defaultValue;
+        }
+        return value;
+    }
+};
+
+[[nodiscard]] inline bool isTransientError(int error) noexcept { return error == EAGAIN || error == EWOULDBLOCK || error == EINTR || error == ENOBUFS; }
+
+[[nodiscard]] inline sockaddr_in toSocketAddress(const std::string& address, std::uint32_t port) {
+    if (port > 0xFFFFU) {
+        throw gr::exception(std::format("invalid port number {}", port));
+    }
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port   = htons(static_cast<std::uint16_t>(port));
+    if (address.empty()) {
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    } else if (::inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1) {
+        throw gr::exception(std::format("invalid IPv4 address '{}'", address));
+    }
+    return addr;
+}
+
+[[nodiscard]] inline std::uint16_t localPort(const Socket& socket) noexcept {
+    sockaddr_in addr{};
+    socklen_t   length = sizeof(addr);
+    if (::getsockname(socket.fd(), reinterpret_cast<sockaddr*>(&addr), &length) != 0) {
+        return 0U;
+    }
+    return ntohs(addr.sin_port);
+}
+
+/// waits until 'fd' becomes readable/writable or the time-out expires (0: non-blocking test)
+[[nodiscard]] inline bool waitFor(int fd, short events, std::chrono::microseconds timeout) noexcept {
+    pollfd pfd{.fd = fd, .events = events, .revents = 0};
+    const int timeoutMs = static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(timeout).count());
+    return ::poll(&pfd, 1, timeoutMs) > 0 && (pfd.revents & (events | POLLERR | POLLHUP)) != 0;
+}
+
+/// requests socket buffer size (N.B. the kernel doubles the value and caps it at net.core.[rw]mem_max) and returns the effective size
+inline int setBufferSize(Socket& socket, int option, std::size_t nBytes) noexcept {
+    if (nBytes > 0UZ) {
+        std::ignore = socket.setOption(SOL_SOCKET, option, static_cast<int>(std::min<std::size_t>(nBytes, static_cast<std::size_t>(std::numeric_limits<int>::max()))));
+    }
+    return socket.getOption<int>(SOL_SOCKET, option);
+}
+
+template<std::unsigned_integral T>
+[[nodiscard]] constexpr T toNetworkOrder(T value) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+        return std::byteswap(value);
+    } else {
+        return value;
+    }
+}
+
+template<std::unsigned_integral T>
+[[nodiscard]] constexpr T fromNetworkOrder(T value) noexcept {
+    return toNetworkOrder(value);
+}
+
+/**
+ * @brief 16-byte datagram prefix used by 'PayloadFormat::sequenced', stored in network (big-endian) byte order.
+ *
+ * Loosely modelled after the VITA-49 packet count and fractional time-stamp: 'packetCount' is a free-running modulo-2^32
+ * counter and 'sampleIndex' is the stream index of the first sample in the payload. The latter allows the receiver to
+ * compute the exact number of lost samples independent of the (possibly varying) payload size.
+ */
+struct PacketHeader {
+    static constexpr std::uint32_t kMagic = 0x47523453U; // 'GR4S'
+
+    std::uint32_t magic       = kMagic;
+    std::uint32_t packetCount = 0U;
+    std::uint64_t sampleIndex = 0U;
+
+    [[nodiscard]] constexpr PacketHeader toNetwork() const noexcept { return {toNetworkOrder(magic), toNetworkOrder(packetCount), toNetworkOrder(sampleIndex)}; }
+    [[nodiscard]] constexpr PacketHeader fromNetwork() const noexcept { return {fromNetworkOrder(magic), fromNetworkOrder(packetCount), fromNetworkOrder(sampleIndex)}; }
+    [[nodiscard]] constexpr bool         isValid() const noexcept { return magic == kMagic; }
+};
+static_assert(sizeof(PacketHeader) == 16UZ && std::is_trivially_copyable_v<PacketHeader>);
+
+/**
+ * @brief tracks the 'sampleIndex' of consecutive 'PacketHeader's and reports the number of samples lost in-between.
+ *
+ * Late/duplicated packets (index behind the expected one) are counted as 'nReordered' and not reported as a gap.
+ * A jump backwards larger than 'kResyncThreshold' is interpreted as a sender restart and re-synchronises silently.
+ */
+struct SequenceTracker {
+    static constexpr std::uint64_t kResyncThreshold = 1ULL << 32;
+
+    std::uint64_t expectedIndex   = 0U;
+    std::uint32_t expectedPacket  = 0U;
+    std::uint64_t nDroppedSamples = 0U;
+    std::uint64_t nDroppedPackets = 0U;
+    std::uint64_t nReordered      = 0U;
+    bool          synchronised    = false;
+
+    void reset() noexcept { *this = SequenceTracker{}; }
+
+    /// @return number of samples missing before this packet (0: in-sequence, reordered or first packet)
+    [[nodiscard]] constexpr std::uint64_t update(const PacketHeader& header, std::size_t nSamples) noexcept {
+        std::uint64_t gap = 0U;
+        if (synchronised) {
+            if (header.sampleIndex > expectedIndex) {
+                gap = header.sampleIndex - expectedIndex;
+                nDroppedSamples += gap;
+                nDroppedPackets += static_cast<std::uint32_t>(header.packetCount - expectedPacket);
+            } else if (header.sampleIndex < expectedIndex && expectedIndex - header.sampleIndex < kResyncThreshold) {
+                ++nReordered;
+                return 0U; // stale packet -> keep expectation
+            }
+        }
+        synchronised   = true;
+        expectedIndex  = header.sampleIndex + nSamples;
+        expectedPacket = header.packetCount + 1U;
+        return gap;
+    }
+};
+
+} // namespace detail
+} // namespace gr::blocks::network
+
+#endif // GNURADIO_NETWORK_SOCKET_HPP
@@ -0,0 +1,341 @@
+#ifndef GNURADIO_NETWORK_UDPBLOCKS_HPP
+#define GNURADIO_NETWORK_UDPBLOCKS_HPP
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/BlockRegistry.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+#include <gnuradio-4.0/network/Socket.hpp>
+
+#include <sys/uio.h>
+
+#include <atomic>
+#include <complex>
+#include <vector>
+
+namespace gr::blocks::network {
+
+GR_REGISTER_BLOCK(gr::blocks::network::UdpSource, [T], [ uint8_t, int16_t, int32_t, float, double, std::complex<float>, std::complex<double> ])
+
+template<typename T>
+struct UdpSource : Block<UdpSource<T>> {
+    using Description = Doc<R""(@brief receives a sample stream from UDP datagrams (counterpart of 'UdpSink').
+
+Up to 'batch_size' datagrams are fetched per work call using a single 'recvmmsg(..)' system-call, with the payloads
+being scattered directly into the output buffer (no intermediate copy). For 'payload_format == sequenced' each datagram
+is prefixed with a 16-byte header carrying a packet counter and the stream index of its first sample. Missing samples
+are reported as 'n_dropped_samples' tags on the first sample following the gap; late/duplicated datagrams are discarded.
+'receive_buffer_size' sets 'SO_RCVBUF' -- the effective size is capped by the system's 'net.core.rmem_max'.
+Important: samples are transported in host byte order!)"">;
+
+    template<typename U, gr::meta::fixed_string description = "", typename... Arguments>
+    using A = gr::Annotated<U, description, Arguments...>; // optional shortening
+
+    PortOut<T> out;
+
+    A<std::string, "bind address", Doc<"local IPv4 address to listen on (empty: any)">, Visible>              bind_address;
+    A<gr::Size_t, "port", Doc<"local UDP port (0: ephemeral, see 'boundPort()')">, Visible>                   port                = 0U;
+    A<PayloadFormat, "payload format", Doc<"\"raw\" or \"sequenced\" (with 'PacketHeader' prefix)">, Visible> payload_format      = PayloadFormat::sequenced;
+    A<gr::Size_t, "max packet size", Unit<"B">, Doc<"max payload size per datagram (excluding header)">>      max_packet_size     = 8192U;
+    A<gr::Size_t, "batch size", Doc<"max number of datagrams per 'recvmmsg(..)' call">, Limits<1U, 1024U>>    batch_size          = 64U;
+    A<gr::Size_t, "receive buffer size", Unit<"B">, Doc<"requested SO_RCVBUF size (0: system default)">>      receive_buffer_size = 8U << 20U;
+    A<gr::Size_t, "time-out", Unit<"us">, Doc<"max time to wait for data per work call">>                     timeout_us          = 1'000U;
+    A<gr::Size_t, "n samples max", Doc<"number of samples after which the block finishes (0: infinite)">>     n_samples_max       = 0U;
+
+    GR_MAKE_REFLECTABLE(UdpSource, out, bind_address, port, payload_format, max_packet_size, batch_size, receive_buffer_size, timeout_us, n_samples_max);
+
+    detail::Socket                    _socket;
+    detail::SequenceTracker           _tracker;
+    std::vector<mmsghdr>              _messages;
+    std::vector<iovec>                _iovecs;
+    std::vector<detail::PacketHeader> _headers;
+    std::vector<std::byte>            _scratch;                // landing zone if the output buffer cannot hold a full datagram
+    std::vector<T>                    _pending;                // samples that did not fit into the previous output buffer
+    std::uint64_t                     _pendingGap        = 0U; // samples lost before the next published sample
+    std::size_t                       _nSamplesPublished = 0UZ;
+    std::size_t                       _nPacketsReceived  = 0UZ;
+    std::size_t                       _nInvalidPackets   = 0UZ;
+    std::size_t                       _nTruncatedPackets = 0UZ;
+    int                               _receiveBufferSize = 0; // effective SO_RCVBUF size as reported by the kernel
+    std::atomic<std::uint16_t>        _boundPort{0U};
+
+    [[nodiscard]] std::uint16_t boundPort() const noexcept { return _boundPort.load(std::memory_order_acquire); }
+
+    void settingsChanged(const property_map& /*oldSettings*/, const property_map& newSettings) {
+        if (lifecycle::isActive(this->state()) && (newSettings.contains("bind_address") || newSettings.contains("port") || newSettings.contains("receive_buffer_size") || newSettings.contains("max_packet_size") || newSettings.contains("batch_size"))) {
+            openSocket();
+        }
+    }
+
+    void start() {
+        _nSamplesPublished = 0UZ;
+        openSocket();
+    }
+
+    void stop() {
+        _socket.close();
+        _boundPort.store(0U, std::memory_order_release);
+    }
+
+    [[nodiscard]] work::Status processBulk(OutputSpanLike auto& outSpan) {
+        std::size_t nMax = outSpan.size();
+        if (n_samples_max.value > 0U) {
+            nMax = std::min(nMax, static_cast<std::size_t>(n_samples_max.value) - _nSamplesPublished);
+        }
+
+        if (!_pending.empty()) { // drain left-over of a datagram that was received into the scratch buffer
+            const std::size_t nSamples = std::min(nMax, _pending.size());
+            std::copy_n(_pending.begin(), nSamples, outSpan.begin());
+            _pending.erase(_pending.begin(), _pending.begin() + static_cast<std::ptrdiff_t>(nSamples));
+            return publish(outSpan, nSamples);
+        }
+
+        if (nMax == 0UZ) {
+            outSpan.publish(0UZ);
+            return work::Status::INSUFFICIENT_OUTPUT_ITEMS;
+        }
+
+        if (!detail::waitFor(_socket.fd(), POLLIN, std::chrono::microseconds(timeout_us.value))) {
+            outSpan.publish(0UZ);
+            return work::Status::OK;
+        }
+
+        const std::size_t stride   = payloadCapacity();
+        const std::size_t nPackets = std::min(static_cast<std::size_t>(batch_size.value), (nMax * sizeof(T)) / stride);
+        std::byte*        dst      = nPackets > 0UZ ? reinterpret_cast<std::byte*>(outSpan.data()) : _scratch.data();
+
+        const int nReceived = receiveBatch(dst, stride, std::max(nPackets, 1UZ));
+        if (nReceived < 0) {
+            if (detail::isTransientError(errno)) {
+                outSpan.publish(0UZ);
+                return work::Status::OK;
+            }
+            throw gr::exception(std::format("recvmmsg(..) on UDP port {} failed: {}", boundPort(), std::strerror(errno)));
+        }
+        _nPacketsReceived += static_cast<std::size_t>(nReceived);
+
+        const std::size_t nSamplesReceived = compact(dst, stride, static_cast<std::size_t>(nReceived), outSpan) / sizeof(T);
+        if (nPackets > 0UZ) {
+            return publish(outSpan, nSamplesReceived);
+        }
+
+        // less than one datagram fits into the output buffer -> copy what fits, keep the rest for the next call
+        const std::size_t nSamples = std::min(nMax, nSamplesReceived);
+        std::memcpy(static_cast<void*>(outSpan.data()), _scratch.data(), nSamples * sizeof(T));
+        _pending.resize(nSamplesReceived - nSamples);
+        std::memcpy(static_cast<void*>(_pending.data()), _scratch.data() + nSamples * sizeof(T), _pending.size() * sizeof(T));
+        return publish(outSpan, nSamples);
+    }
+
+private:
+    [[nodiscard]] std::size_t payloadCapacity() const noexcept { return std::max(sizeof(T), (static_cast<std::size_t>(max_packet_size.value) / sizeof(T)) * sizeof(T)); }
+
+    void openSocket() {
+        _socket = detail::Socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC);
+        std::ignore        = _socket.setOption(SOL_SOCKET, SO_REUSEADDR, 1);
+        _receiveBufferSize = detail::setBufferSize(_socket, SO_RCVBUF, receive_buffer_size.value);
+
+        const sockaddr_in addr = detail::toSocketAddress(bind_address.value, port.value);
+        if (::bind(_socket.fd(), reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+            throw gr::exception(std::format("could not bind UDP socket to '{}:{}': {}", bind_address.value, port.value, std::strerror(errno)));
+        }
+        _boundPort.store(detail::localPort(_socket), std::memory_order_release);
+
+        _messages.resize(batch_size.value);
+        _iovecs.resize(2UZ * batch_size.value);
+        _headers.resize(batch_size.value);
+        _scratch.resize(payloadCapacity());
+        _pending.clear();
+        _pendingGap = 0U;
+        _tracker.reset();
+    }
+
+    /// scatters up to 'nPackets' datagrams with the i-th payload landing at 'dst + i * stride'
+    int receiveBatch(std::byte* dst, std::size_t stride, std::size_t nPackets) noexcept {
+        const bool sequenced = payload_format == PayloadFormat::sequenced;
+        for (std::size_t i = 0UZ; i < nPackets; ++i) {
+            iovec*      iov  = &_iovecs[2UZ * i];
+            std::size_t nIov = 0UZ;
+            if (sequenced) {
+                iov[nIov++] = iovec{.iov_base = &_headers[i], .iov_len = sizeof(detail::PacketHeader)};
+            }
+            iov[nIov++] = iovec{.iov_base = dst + i * stride, .iov_len = stride};
+
+            _messages[i]                    = mmsghdr{};
+            _messages[i].msg_hdr.msg_iov    = iov;
+            _messages[i].msg_hdr.msg_iovlen = nIov;
+        }
+        return ::recvmmsg(_socket.fd(), _messages.data(), static_cast<unsigned int>(nPackets), MSG_DONTWAIT, nullptr);
+    }
+
+    /// moves valid payloads back-to-back to the front of 'dst', publishes gap tags and returns the number of valid bytes
+    std::size_t compact(std::byte* dst, std::size_t stride, std::size_t nReceived, OutputSpanLike auto& outSpan) {
+        const bool        sequenced  = payload_format == PayloadFormat::sequenced;
+        const std::size_t headerSize = sequenced ? sizeof(detail::PacketHeader) : 0UZ;
+
+        std::size_t nBytes = 0UZ;
+        for (std::size_t i = 0UZ; i < nReceived; ++i) {
+            const mmsghdr& msg = _messages[i];
+            if ((msg.msg_hdr.msg_flags & MSG_TRUNC) != 0) {
+                ++_nTruncatedPackets; // sender's payload exceeds 'max_packet_size' -> excess samples show up as a gap
+            }
+            if (msg.msg_len < headerSize) {
+                ++_nInvalidPackets;
+                continue;
+            }
+            std::size_t payloadBytes = msg.msg_len - headerSize;
+            payloadBytes -= payloadBytes % sizeof(T);
+
+            if (sequenced) {
+                const detail::PacketHeader header = _headers[i].fromNetwork();
+                if (!header.isValid()) {
+                    ++_nInvalidPackets;
+                    continue;
+                }
+                const std::uint64_t nReordered = _tracker.nReordered;
+                _pendingGap += _tracker.update(header, payloadBytes / sizeof(T));
+                if (_tracker.nReordered != nReordered) {
+                    continue; // late or duplicated datagram, the gap has already been reported
+                }
+            }
+            if (payloadBytes == 0UZ) {
+                continue;
+            }
+
+            if (_pendingGap > 0U) {
+                const auto nDropped = static_cast<gr::Size_t>(std::min<std::uint64_t>(_pendingGap, std::numeric_limits<gr::Size_t>::max()));
+                outSpan.publishTag(property_map{{std::string(tag::N_DROPPED_SAMPLES.shortKey()), nDropped}}, nBytes / sizeof(T));
+                _pendingGap = 0U;
+            }
+            if (const std::byte* src = dst + i * stride; src != dst + nBytes) {
+                std::memmove(dst + nBytes, src, payloadBytes);
+            }
+            nBytes += payloadBytes;
+        }
+        return nBytes;
+    }
+
+    work::Status publish(OutputSpanLike auto& outSpan, std::size_t nSamples) {
+        outSpan.publish(nSamples);
+        _nSamplesPublished += nSamples;
+        if (n_samples_max.value > 0U && _nSamplesPublished >= n_samples_max.value) {
+            return work::Status::DONE;
+        }
+        return work::Status::OK;
+    }
+};
+
+GR_REGISTER_BLOCK(gr::blocks::network::UdpSink, [T], [ uint8_t, int16_t, int32_t, float, double, std::complex<float>, std::complex<double> ])
+
+template<typename T>
+struct UdpSink : Block<UdpSink<T>> {
+    using Description = Doc<R""(@brief sends a sample stream as UDP datagrams (counterpart of 'UdpSource').
+
+The input is split into datagrams of at most 'max_packet_size' payload bytes of which up to 'batch_size' are handed to
+the kernel with a single 'sendmmsg(..)' system-call. Headers and payloads are gathered directly from the input buffer
+(no intermediate copy). Input samples are only consumed once the kernel accepted them, i.e. a full socket send buffer
+propagates back-pressure upstream rather than silently dropping samples. Stream tags are not transmitted.
+N.B. keep header + payload below the path MTU to avoid IP fragmentation when sending to other hosts.
+Important: samples are transported in host byte order!)"">;
+
+    template<typename U, gr::meta::fixed_string description = "", typename... Arguments>
+    using A = gr::Annotated<U, description, Arguments...>; // optional shortening
+
+    PortIn<T> in;
+
+    A<std::string, "address", Doc<"destination IPv4 address">, Visible>                                       address          = "127.0.0.1";
+    A<gr::Size_t, "port", Doc<"destination UDP port">, Visible>                                               port             = 0U;
+    A<PayloadFormat, "payload format", Doc<"\"raw\" or \"sequenced\" (with 'PacketHeader' prefix)">, Visible> payload_format   = PayloadFormat::sequenced;
+    A<gr::Size_t, "max packet size", Unit<"B">, Doc<"max payload size per datagram (excluding header)">>      max_packet_size  = 8192U;
+    A<gr::Size_t, "batch size", Doc<"max number of datagrams per 'sendmmsg(..)' call">, Limits<1U, 1024U>>    batch_size       = 64U;
+    A<gr::Size_t, "send buffer size", Unit<"B">, Doc<"requested SO_SNDBUF size (0: system default)">>         send_buffer_size = 4U << 20U;
+    A<gr::Size_t, "time-out", Unit<"us">, Doc<"max time to wait for send buffer space per work call">>        timeout_us       = 1'000U;
+
+    GR_MAKE_REFLECTABLE(UdpSink, in, address, port, payload_format, max_packet_size, batch_size, send_buffer_size, timeout_us);
+
+    detail::Socket                    _socket;
+    sockaddr_in                       _destination{};
+    std::vector<mmsghdr>              _messages;
+    std::vector<iovec>                _iovecs;
+    std::vector<detail::PacketHeader> _headers;
+    std::uint32_t                     _packetCount    = 0U;
+    std::uint64_t                     _sampleIndex    = 0U;
+    std::size_t                       _nPacketsSent   = 0UZ;
+    int                               _sendBufferSize = 0; // effective SO_SNDBUF size as reported by the kernel
+
+    void settingsChanged(const property_map& /*oldSettings*/, const property_map& /*newSettings*/) {
+        if (lifecycle::isActive(this->state())) {
+            openSocket();
+        }
+    }
+
+    void start() {
+        _packetCount = 0U;
+        _sampleIndex = 0U;
+        openSocket();
+    }
+
+    void stop() { _socket.close(); }
+
+    [[nodiscard]] work::Status processBulk(InputSpanLike auto& inSpan) {
+        const std::size_t samplesPerPacket = std::max(1UZ, static_cast<std::size_t>(max_packet_size.value) / sizeof(T));
+        const std::size_t nPackets         = std::min(static_cast<std::size_t>(batch_size.value), (inSpan.size() + samplesPerPacket - 1UZ) / samplesPerPacket);
+        if (nPackets == 0UZ) {
+            std::ignore = inSpan.consume(0UZ);
+            return work::Status::INSUFFICIENT_INPUT_ITEMS;
+        }
+
+        const bool sequenced = payload_format == PayloadFormat::sequenced;
+        for (std::size_t i = 0UZ; i < nPackets; ++i) {
+            const std::size_t offset   = i * samplesPerPacket;
+            const std::size_t nSamples = std::min(samplesPerPacket, inSpan.size() - offset);
+
+            iovec*      iov  = &_iovecs[2UZ * i];
+            std::size_t nIov = 0UZ;
+            if (sequenced) {
+                _headers[i] = detail::PacketHeader{.packetCount = _packetCount + static_cast<std::uint32_t>(i), .sampleIndex = _sampleIndex + offset}.toNetwork();
+                iov[nIov++] = iovec{.iov_base = &_headers[i], .iov_len = sizeof(detail::PacketHeader)};
+            }
+            iov[nIov++] = iovec{.iov_base = const_cast<T*>(inSpan.data() + offset), .iov_len = nSamples * sizeof(T)};
+
+            _messages[i]                     = mmsghdr{};
+            _messages[i].msg_hdr.msg_name    = &_destination;
+            _messages[i].msg_hdr.msg_namelen = sizeof(_destination);
+            _messages[i].msg_hdr.msg_iov     = iov;
+            _messages[i].msg_hdr.msg_iovlen  = nIov;
+        }
+
+        const int nSent = ::sendmmsg(_socket.fd(), _messages.data(), static_cast<unsigned int>(nPackets), MSG_DONTWAIT);
+        if (nSent < 0) {
+            if (detail::isTransientError(errno)) { // socket send buffer full -> retry later
+                std::ignore = detail::waitFor(_socket.fd(), POLLOUT, std::chrono::microseconds(timeout_us.value));
+                std::ignore = inSpan.consume(0UZ);
+                return work::Status::OK;
+            }
+            throw gr::exception(std::format("sendmmsg(..) to '{}:{}' failed: {}", address.value, port.value, std::strerror(errno)));
+        }
+
+        const std::size_t nSamplesSent = std::min(inSpan.size(), static_cast<std::size_t>(nSent) * samplesPerPacket);
+        _packetCount += static_cast<std::uint32_t>(nSent);
+        _sampleIndex += nSamplesSent;
+        _nPacketsSent += static_cast<std::size_t>(nSent);
+        if (!inSpan.consume(nSamplesSent)) {
+            throw gr::exception("could not consume input samples");
+        }
+        return work::Status::OK;
+    }
+
+private:
+    void openSocket() {
+        _destination    = detail::toSocketAddress(address.value, port.value);
+        _socket         = detail::Socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC);
+        _sendBufferSize = detail::setBufferSize(_socket, SO_SNDBUF, send_buffer_size.value);
+
+        _messages.resize(batch_size.value);
+        _iovecs.resize(2UZ * batch_size.value);
+        _headers.resize(batch_size.value);
+    }
+};
+
+} // namespace gr::blocks::network
+
+#endif // GNURADIO_NETWORK_UDPBLOCKS_HPP
@@ -0,0 +1,63 @@
+#ifndef GNURADIO_TESTING_BOTTLENECK_CHART_HPP
+#define GNURADIO_TESTING_BOTTLENECK_CHART_HPP
+
+#include <format>
+#include <print>
+#include <string>
+#include <vector>
+
+#include <gnuradio-4.0/BottleneckAnalyser.hpp>
+#include <gnuradio-4.0/algorithm/ImChart.hpp>
+#include <gnuradio-4.0/meta/utils.hpp>
+
+namespace gr::testing {
+
+/**
+ * @brief textual summary of a bottleneck analysis, one line per block (most likely bottleneck first)
+ */
+[[nodiscard]] inline std::string formatBottleneckTable(const std::vector<gr::metrics::BlockLoad>& loads) {
+    std::string result = std::format("{:>3} {:>6} {:>6} {:>6} {:>6} {:>10} {:>10}  {}\n", "#", "score", "in[%]", "out[%]", "cpu[%]", "in-starved", "out-full", "block");
+    for (std::size_t i = 0UZ; i < loads.size(); ++i) {
+        const auto& load = loads[i];
+        result += std::format("{:>3} {:6.2f} {:6.1f} {:6.1f} {:6.1f} {:>10} {:>10}  {}{}\n", i, load.score, 100. * load.inputFill, 100. * load.outputFill, 100. * load.processingShare, //
+            load.nInsufficientInput, load.nInsufficientOutput, gr::meta::shorten_type_name(load.name), i == 0UZ ? "  <-- bottleneck" : "");
+    }
+    return result;
+}
+
+/**
+ * @brief terminal view of the BottleneckAnalyser: mean input (left bar) and output (right bar) buffer fill level per block
+ * in processing order, followed by the ranked summary table.
+ *
+ * @code
+ * gr::testing::drawBottleneckChart(scheduler.bottleneckAnalyser().analyse());
+ * @endcode
+ */
+inline void drawBottleneckChart(const std::vector<gr::metrics::BlockLoad>& loads, std::size_t chartWidth = 130UZ, std::size_t chartHeight = 20UZ) {
+    if (loads.empty()) {
+        std::println("bottleneck analysis: no samples");
+        return;
+    }
+    std::vector<double> xIn;
+    std::vector<double> xOut;
+    std::vector<double> yIn;
+    std::vector<double> yOut;
+    for (std::size_t i = 0UZ; i < loads.size(); ++i) {
+        xIn.push_back(static_cast<double>(i) - 0.15);
+        xOut.push_back(static_cast<double>(i) + 0.15);
+        yIn.push_back(100. * loads[i].inputFill);
+        yOut.push_back(100. * loads[i].outputFill);
+    }
+
+    auto chart        = gr::graphs::ImChart<std::dynamic_extent, std::dynamic_extent>({{-0.5, static_cast<double>(loads.size()) - 0.5}, {0., 105.}}, chartWidth, chartHeight);
+    chart.axis_name_x = "block # (ranked)";
+    chart.axis_name_y = "buffer fill [%]";
+    chart.draw<gr::graphs::Style::Bars>(xIn, yIn, "input fill");
+    chart.draw<gr::graphs::Style::Bars>(xOut, yOut, "output fill");
+    chart.draw();
+    std::print("{}", formatBottleneckTable(loads));
+}
+
+} // namespace gr::testing
+
+#endif // GNURADIO_TESTING_BOTTLENECK_CHART_HPP
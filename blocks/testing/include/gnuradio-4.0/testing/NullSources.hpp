@@ -132,6 +132,25 @@ Commonly used used to isolate parts of a flowgraph, manage buffer sizes, or simp
     }
 };
 
+GR_REGISTER_BLOCK(gr::testing::Forward, [T], [ uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> ])
+
+template<typename T>
+struct Forward : Block<Forward<T>, PassThrough<"in", "out">> {
+    using Description = Doc<R""(A block that forwards input samples and tags unmodified without copying them (zero-copy counterpart of 'Copy').
+Downstream ports read directly from the upstream buffer (see gr::PassThrough), i.e. the upstream buffer size applies and no
+buffer isolation takes place. Commonly used as a routing or probe point in a flowgraph.)"">;
+
+    gr::PortIn<T>  in;
+    gr::PortOut<T> out;
+
+    GR_MAKE_REFLECTABLE(Forward, in, out);
+
+    template<gr::meta::t_or_simd<T> V>
+    [[nodiscard]] constexpr auto processOne(V input) const noexcept {
+        return input; // only used if some of the output's readers could not be aliased
+    }
+};
+
 GR_REGISTER_BLOCK(gr::testing::HeadBlock, [T], [ uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> ])
 
 template<typename T>
@@ -0,0 +1,89 @@
+#include <benchmark.hpp>
+
+#include <format>
+
+#include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/DataSetPool.hpp>
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+
+#include <gnuradio-4.0/basic/DataSink.hpp>
+#include <gnuradio-4.0/basic/StreamToDataSet.hpp>
+#include <gnuradio-4.0/testing/TagMonitors.hpp>
+
+inline constexpr std::size_t N_ITER         = 10;
+inline constexpr gr::Size_t  N_SAMPLES      = 2'000'000U;
+inline constexpr gr::Size_t  N_TRIGGER_STEP = 1024U; // one DataSet per trigger
+
+gr::DataSet<float> fillDataSet(gr::DataSet<float> ds, std::size_t nSamples) {
+    ds.axis_names = {"time"};
+    ds.axis_units = {"s"};
+    ds.axis_values[0UZ].resize(nSamples);
+    ds.signal_names      = {"signal"};
+    ds.signal_quantities = {"voltage"};
+    ds.signal_units      = {"V"};
+    ds.signal_values.resize(nSamples, 1.f);
+    ds.signal_ranges = {{0.f, 1.f}};
+    ds.meta_information[0UZ].emplace("n_pre", gr::Size_t(0U));
+    return ds;
+}
+
+void runStreamToDataSet(gr::Size_t nPost) {
+    using namespace boost::ut;
+    using namespace gr;
+
+    Graph graph;
+    auto& source = graph.emplaceBlock<testing::TagSource<float, testing::ProcessFunction::USE_PROCESS_BULK>>({{"n_samples_max", N_SAMPLES}, {"signal_name", "bm signal"}, {"mark_tag", false}, {"verbose_console", false}});
+    for (std::size_t index = N_TRIGGER_STEP; index < N_SAMPLES - N_TRIGGER_STEP; index += N_TRIGGER_STEP) {
+        source._tags.push_back(Tag{index, {{tag::TRIGGER_NAME.shortKey(), std::string("CMD_DIAG_TRIGGER1")}, {tag::TRIGGER_TIME.shortKey(), std::uint64_t(0)}, {tag::TRIGGER_OFFSET.shortKey(), 0.f}, {tag::CONTEXT.shortKey(), std::string()}}});
+    }
+    auto& streamToDataSet = graph.emplaceBlock<basic::StreamToDataSet<float>>({{"filter", "CMD_DIAG_TRIGGER1"}, {"n_pre", gr::Size_t(0U)}, {"n_post", nPost}});
+    auto& sink            = graph.emplaceBlock<basic::DataSetSink<float>>({{"name", "bm_sink"}});
+    expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(source).to<"in">(streamToDataSet)));
+    expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(streamToDataSet).to<"in">(sink)));
+
+    scheduler::Simple sched;
+    if (auto ret = sched.exchange(std::move(graph)); !ret) {
+        throw std::runtime_error(std::format("failed to initialize scheduler: {}", ret.error()));
+    }
+    expect(sched.runAndWait().has_value());
+}
+
+inline const boost::ut::suite<"DataSet<T> pool"> _dataSetPoolBenchmarks = [] {
+    using namespace benchmark;
+    using namespace gr;
+
+    constexpr std::size_t nDataSets = 10'000UZ;
+    for (std::size_t nSamples : {256UZ, 4096UZ, 65536UZ}) {
+        ::benchmark::benchmark<N_ITER>(std::format("DataSet<float>({:5}) - fresh allocation", nSamples), nDataSets) = [nSamples] {
+            for (std::size_t i = 0UZ; i < nDataSets; ++i) {
+                DataSet<float> ds;
+                ds.extents = {static_cast<std::int32_t>(nSamples)};
+                ds.axis_values.resize(1UZ);
+                ds.meta_information.resize(1UZ);
+                ds.timing_events.resize(1UZ);
+                ds = fillDataSet(std::move(ds), nSamples);
+                ::benchmark::force_to_memory(ds);
+            }
+        };
+
+        DataSetPool<float> pool;
+        ::benchmark::benchmark<N_ITER>(std::format("DataSet<float>({:5}) - pool acquire/release", nSamples), nDataSets) = [nSamples, &pool] {
+            for (std::size_t i = 0UZ; i < nDataSets; ++i) {
+                DataSet<float> ds = fillDataSet(pool.acquire({static_cast<std::int32_t>(nSamples)}), nSamples);
+                ::benchmark::force_to_memory(ds);
+                pool.release(std::move(ds));
+            }
+        };
+    }
+    ::benchmark::results::add_separator();
+
+    for (gr::Size_t nPost : {gr::Size_t(256U), gr::Size_t(1000U)}) {
+        globalDataSetPool<float>().setMaxPooled(0UZ); // disables recycling -> baseline
+        ::benchmark::benchmark<N_ITER>(std::format("StreamToDataSet->DataSetSink n_post={:4} - w/o pool", nPost), N_SAMPLES) = [nPost] { runStreamToDataSet(nPost); };
+        globalDataSetPool<float>().setMaxPooled(DataSetPool<float>::kDefaultMaxPooled);
+        ::benchmark::benchmark<N_ITER>(std::format("StreamToDataSet->DataSetSink n_post={:4} - with pool", nPost), N_SAMPLES) = [nPost] { runStreamToDataSet(nPost); };
+    }
+};
+
+int main() { /* not needed by the UT framework */ }
@@ -2,6 +2,7 @@
 
 #include <chrono>
 #include <iostream>
+#include <numeric>
 #include <thread>
 
 #include <format>
@@ -200,6 +201,58 @@ inline const boost::ut::suite _buffer_tests = [] {
             }
         };
     }
+    {
+        constexpr std::size_t chunkSize = 1024UZ;
+        std::vector<float>    chunk(chunkSize);
+        std::iota(chunk.begin(), chunk.end(), 0.f);
+        HistoryBuffer<float> buffer(4096);
+
+        "history_buffer<float>(4096) - push_front per sample (chunks of 1024)"_benchmark.repeat<n_repetitions>(samples) = [&buffer, &chunk] {
+            for (std::size_t i = 0; i < samples; i += chunkSize) {
+                for (const float sample : chunk) {
+                    buffer.push_front(sample);
+                }
+            }
+        };
+
+        "history_buffer<float>(4096) - push_front bulk (chunks of 1024)"_benchmark.repeat<n_repetitions>(samples) = [&buffer, &chunk] {
+            for (std::size_t i = 0; i < samples; i += chunkSize) {
+                buffer.push_front(chunk);
+            }
+        };
+
+        "history_buffer<float>(4096) - push_back bulk (chunks of 1024)"_benchmark.repeat<n_repetitions>(samples) = [&buffer, &chunk] {
+            for (std::size_t i = 0; i < samples; i += chunkSize) {
+                buffer.push_back(chunk);
+            }
+        };
+    }
+    {
+        constexpr std::size_t nTaps = 64UZ;
+        std::vector<float>    taps(nTaps, 1.f / static_cast<float>(nTaps));
+        HistoryBuffer<float>  buffer(nTaps);
+        float                 sum = 0.f;
+
+        "history_buffer<float>(64) - FIR dot product via operator[]"_benchmark.repeat<n_repetitions>(samples) = [&buffer, &taps, &sum] {
+            for (std::size_t i = 0; i < samples; i++) {
+                buffer.push_front(static_cast<float>(i));
+                float acc = 0.f;
+                for (std::size_t k = 0; k < buffer.size(); k++) {
+                    acc += taps[k] * buffer[k];
+                }
+                sum += acc;
+            }
+        };
+
+        "history_buffer<float>(64) - FIR dot product via first(n) span"_benchmark.repeat<n_repetitions>(samples) = [&buffer, &taps, &sum] {
+            for (std::size_t i = 0; i < samples; i++) {
+                buffer.push_front(static_cast<float>(i));
+                const std::span<const float> window = buffer.first(nTaps);
+                sum += std::inner_product(window.begin(), window.end(), taps.begin(), 0.f);
+            }
+        };
+        boost::ut::expect(sum != 0.f);
+    }
 };
 
 int main() { /* not needed by the UT framework */ }
@@ -0,0 +1,70 @@
+#include <benchmark.hpp>
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+
+#include <gnuradio-4.0/testing/NullSources.hpp>
+
+inline constexpr std::size_t N_ITER        = 10;
+inline constexpr gr::Size_t  N_SAMPLES     = gr::util::round_up(10'000'000, 1024);
+inline constexpr std::size_t N_HOPS        = 8; // routing hops between source and sink
+inline constexpr gr::Size_t  N_BUFFER_SIZE = gr::util::round_up(64'000, 1024);
+
+template<typename T, template<typename> typename THop>
+gr::Graph routingChain(std::vector<THop<T>*>& hops) {
+    using namespace boost::ut;
+    gr::Graph testGraph;
+
+    auto& src  = testGraph.emplaceBlock<gr::testing::ConstantSource<T>>({{"n_samples_max", N_SAMPLES}});
+    auto& sink = testGraph.emplaceBlock<gr::testing::NullSink<T>>();
+
+    hops.clear();
+    for (std::size_t i = 0; i < N_HOPS; i++) {
+        hops.emplace_back(std::addressof(testGraph.emplaceBlock<THop<T>>({{"name", std::format("hop.{}", i)}})));
+    }
+    expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(src, N_BUFFER_SIZE).template to<"in">(*hops.front())));
+    for (std::size_t i = 1; i < hops.size(); i++) {
+        expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(*hops[i - 1], N_BUFFER_SIZE).template to<"in">(*hops[i])));
+    }
+    expect(eq(gr::ConnectionResult::SUCCESS, testGraph.connect<"out">(*hops.back(), N_BUFFER_SIZE).template to<"in">(sink)));
+    return testGraph;
+}
+
+template<typename T, template<typename> typename THop>
+double bytesCopiedPerSample(const std::vector<THop<T>*>& hops, std::size_t nSamples) {
+    std::size_t nCopied = 0UZ;
+    for (const auto* hop : hops) {
+        nCopied += hop->out.streamWriter().position();
+    }
+    return static_cast<double>(nCopied * sizeof(T)) / static_cast<double>(nSamples);
+}
+
+void runChain(auto& scheduler, const std::string& testCase, std::source_location srcLoc = std::source_location::current()) {
+    const auto res = scheduler.runAndWait();
+    boost::ut::expect(res.has_value(), srcLoc) << [&] { return std::format("scheduler failure for test-case: {}\n    - error: {}", testCase, res.error()); } << boost::ut::fatal;
+}
+
+[[maybe_unused]] inline const boost::ut::suite<"pass-through routing chain"> passThroughBenchmarks = [] {
+    using T = float;
+
+    std::vector<gr::testing::Forward<T>*> aliasedHops;
+    gr::scheduler::Simple<>               sched1;
+    if (auto ret = sched1.exchange(routingChain<T, gr::testing::Forward>(aliasedHops)); !ret) {
+        throw std::runtime_error(std::format("failed to initialize scheduler: {}", ret.error()));
+    }
+    ::benchmark::benchmark<N_ITER>(std::format("{} hops - aliased (PassThrough)", N_HOPS), N_SAMPLES) = [&sched1]() { runChain(sched1, "aliased"); };
+    std::println("INFO: {} hops - aliased (PassThrough): {:.1f} bytes copied per sample", N_HOPS, bytesCopiedPerSample<T>(aliasedHops, N_SAMPLES));
+
+    std::vector<gr::testing::Copy<T>*> copyingHops;
+    gr::scheduler::Simple<>            sched2;
+    if (auto ret = sched2.exchange(routingChain<T, gr::testing::Copy>(copyingHops)); !ret) {
+        throw std::runtime_error(std::format("failed to initialize scheduler: {}", ret.error()));
+    }
+    ::benchmark::benchmark<N_ITER>(std::format("{} hops - copying", N_HOPS), N_SAMPLES) = [&sched2]() { runChain(sched2, "copying"); };
+    std::println("INFO: {} hops - copying: {:.1f} bytes copied per sample", N_HOPS, bytesCopiedPerSample<T>(copyingHops, N_SAMPLES));
+
+    ::benchmark::results::add_separator();
+};
+
+int main() { /* not needed by the UT framework */ }
@@ -0,0 +1,134 @@
+#include <benchmark.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <string_view>
+#include <vector>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+
+#include <gnuradio-4.0/math/Math.hpp>
+#include <gnuradio-4.0/testing/NullSources.hpp>
+
+/**
+ * Real-time jitter benchmark: measures the cycle latency, i.e. the time between two consecutive sink 'processBulk(..)' calls,
+ * of a short processing chain with small chunks for the default and the real-time scheduler profiles:
+ *   - 'prefault_buffers': all buffer pages are touched at 'start()'
+ *   - 'lock_memory':      mlockall(MCL_CURRENT | MCL_FUTURE) (needs CAP_IPC_LOCK or a sufficient RLIMIT_MEMLOCK)
+ *   - 'runner_policy':    FIFO runner threads (needs CAP_SYS_NICE or a sufficient RLIMIT_RTPRIO)
+ * Missing privileges are reported as scheduler error messages and the corresponding option is skipped.
+ * The tail percentiles (p99.9, max) rather than the throughput are the figure-of-merit.
+ */
+
+using T = float;
+
+inline constexpr std::size_t N_ITER        = 5;
+inline constexpr gr::Size_t  N_SAMPLES     = gr::util::round_up(4'000'000, 1024);
+inline constexpr std::size_t N_CHUNK       = 256UZ; // max_work_items -> number of cycles ~ N_SAMPLES / N_CHUNK
+inline constexpr std::size_t N_DEPTH       = 4UZ;
+inline constexpr gr::Size_t  N_BUFFER_SIZE = 4096U;
+
+template<typename T>
+struct JitterSink : gr::Block<JitterSink<T>> {
+    using Description = gr::Doc<"records the time between consecutive processBulk(..) calls (cycle latency)">;
+    using clock       = std::chrono::steady_clock;
+
+    gr::PortIn<T> in;
+
+    GR_MAKE_REFLECTABLE(JitterSink, in);
+
+    std::vector<long double> _cycles; // [s], pre-allocated and touched upfront -> no allocation in the processing path
+    std::size_t              _nCycles = 0UZ;
+    clock::time_point        _last{};
+
+    void arm(std::size_t maxCycles) {
+        _cycles.assign(maxCycles, 0.0L);
+        _nCycles = 0UZ;
+        _last    = clock::time_point{};
+    }
+
+    [[nodiscard]] gr::work::Status processBulk(std::span<const T> /*input*/) noexcept {
+        const auto now = clock::now();
+        if (_last != clock::time_point{} && _nCycles < _cycles.size()) {
+            _cycles[_nCycles++] = std::chrono::duration<long double>(now - _last).count();
+        }
+        _last = now;
+        return gr::work::Status::OK;
+    }
+};
+
+void addJitterResult(std::string_view name, std::vector<long double> cycles, std::uint64_t maxWorkLatencyNs) {
+    auto& map = ::benchmark::results::add_result(std::format("  └─cycle latency: {}", name));
+    if (cycles.empty()) {
+        return;
+    }
+    std::ranges::sort(cycles);
+    const auto percentile = [&cycles](double p) { return cycles[std::min(cycles.size() - 1UZ, static_cast<std::size_t>(p * static_cast<double>(cycles.size())))]; };
+    map.try_emplace("min", cycles.front(), "s", 2);
+    map.try_emplace("p50", percentile(0.50), "s", 2);
+    map.try_emplace("p99", percentile(0.99), "s", 2);
+    map.try_emplace("p99.9", percentile(0.999), "s", 2);
+    map.try_emplace("max", cycles.back(), "s", 2);
+    map.try_emplace("max work()", static_cast<long double>(maxWorkLatencyNs) * 1e-9L, "s", 2);
+}
+
+template<typename TScheduler>
+void runCase(std::string_view name, gr::property_map profile) {
+    using namespace boost::ut;
+    profile.insert_or_assign(std::string("max_work_items"), N_CHUNK);
+
+    gr::Graph graph;
+    auto&     src  = graph.emplaceBlock<gr::testing::ConstantSource<T>>({{"n_samples_max", N_SAMPLES}});
+    auto*     last = &graph.emplaceBlock<gr::blocks::math::MultiplyConst<T>>({{"value", T(2)}});
+    expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(src, N_BUFFER_SIZE).to<"in">(*last)));
+    for (std::size_t i = 1UZ; i < N_DEPTH; ++i) {
+        auto& next = graph.emplaceBlock<gr::blocks::math::MultiplyConst<T>>({{"value", T(0.5)}});
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(*last, N_BUFFER_SIZE).to<"in">(next)));
+        last = &next;
+    }
+    auto& sink = graph.emplaceBlock<JitterSink<T>>();
+    expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(*last, N_BUFFER_SIZE).to<"in">(sink)));
+
+    TScheduler sched;
+    std::ignore = sched.settings().set(profile);
+    std::ignore = sched.settings().applyStagedParameters();
+    if (auto ret = sched.exchange(std::move(graph)); !ret) {
+        throw std::runtime_error(std::format("failed to initialize scheduler: {}", ret.error()));
+    }
+
+    std::vector<long double> cycles; // accumulated over all iterations
+    std::uint64_t            maxWorkLatencyNs = 0U;
+    ::benchmark::benchmark<N_ITER>(std::format("{:28}", name), N_SAMPLES) = [&]() {
+        sink.arm(N_SAMPLES / 16U); // >> expected number of cycles (~N_SAMPLES / N_CHUNK)
+        sink.workMetrics.reset();
+        const auto res = sched.runAndWait();
+        expect(res.has_value()) << [&] { return std::format("scheduler failure for test-case: {}\n    - error: {}", name, res.error()); } << fatal;
+        cycles.insert(cycles.end(), sink._cycles.begin(), std::next(sink._cycles.begin(), static_cast<std::ptrdiff_t>(sink._nCycles)));
+        maxWorkLatencyNs = std::max(maxWorkLatencyNs, sink.workMetrics.maxWorkLatencyNs());
+    };
+    addJitterResult(name, std::move(cycles), maxWorkLatencyNs);
+}
+
+[[maybe_unused]] inline const boost::ut::suite<"real-time jitter"> _jitter = [] {
+    using namespace std::string_literals;
+    using gr::scheduler::ExecutionPolicy;
+
+    const gr::property_map kDefault;
+    const gr::property_map kPrefault{{"prefault_buffers"s, true}};
+    const gr::property_map kLocked{{"prefault_buffers"s, true}, {"lock_memory"s, true}};
+    const gr::property_map kRealtime{{"prefault_buffers"s, true}, {"lock_memory"s, true}, {"runner_policy"s, "FIFO"s}, {"runner_priority"s, 50}, {"pin_runners"s, true}};
+
+    runCase<gr::scheduler::Simple<ExecutionPolicy::singleThreaded>>("ST default", kDefault);
+    runCase<gr::scheduler::Simple<ExecutionPolicy::singleThreaded>>("ST prefault", kPrefault);
+    runCase<gr::scheduler::Simple<ExecutionPolicy::singleThreaded>>("ST prefault+mlock", kLocked);
+    runCase<gr::scheduler::Simple<ExecutionPolicy::singleThreaded>>("ST prefault+mlock+FIFO", kRealtime);
+    ::benchmark::results::add_separator();
+    runCase<gr::scheduler::Simple<ExecutionPolicy::multiThreaded>>("MT default", kDefault);
+    runCase<gr::scheduler::Simple<ExecutionPolicy::multiThreaded>>("MT prefault+mlock+FIFO+pinned", kRealtime);
+
+    gr::memory::unlockProcessMemory(); // N.B. 'lock_memory' is process-wide and sticky
+};
+
+int main() { /* not needed by the UT framework */ }
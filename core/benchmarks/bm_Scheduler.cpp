@@ -140,6 +140,33 @@ void exec_bm(auto& scheduler, const std::string& test_case, [[maybe_unused]] Tes
     }
     "bifurcated graph - BFS scheduler (multi-threaded)"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched4_mt, &marker]() { exec_bm(sched4_mt, "bifurcated-graph BFS-sched (multi-threaded)", marker); };
 
+    const auto topology = gr::thread_pool::thread::CpuTopology::read();
+    std::println("INFO: CPU topology - usable CPUs: [{}] - physical cores (cache-neighbours first): [{}]", gr::join(topology.usableCpus(), ", "), gr::join(topology.physicalCores(), ", "));
+
+    gr::scheduler::Simple<multiThreaded> sched1_mt_pinned({{"pin_runners", true}});
+    if (auto ret = sched1_mt_pinned.exchange(test_graph_linear<T>(2 * N_NODES)); !ret) {
+        throw std::runtime_error(std::format("failed to initialize scheduler: {}", ret.error()));
+    }
+    "linear graph - simple scheduler (multi-threaded, pinned)"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched1_mt_pinned, &marker]() { exec_bm(sched1_mt_pinned, "linear-graph simple-sched (multi-threaded, pinned)", marker); };
+
+    gr::scheduler::BreadthFirst<multiThreaded> sched2_mt_pinned({{"pin_runners", true}});
+    if (auto ret = sched2_mt_pinned.exchange(test_graph_linear<T>(2 * N_NODES)); !ret) {
+        throw std::runtime_error(std::format("failed to initialize scheduler: {}", ret.error()));
+    }
+    "linear graph - BFS scheduler (multi-threaded, pinned)"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched2_mt_pinned, &marker]() { exec_bm(sched2_mt_pinned, "linear-graph BFS-sched (multi-threaded, pinned)", marker); };
+
+    gr::scheduler::Simple<multiThreaded> sched3_mt_pinned({{"pin_runners", true}});
+    if (auto ret = sched3_mt_pinned.exchange(test_graph_bifurcated<T>(N_NODES)); !ret) {
+        throw std::runtime_error(std::format("failed to initialize scheduler: {}", ret.error()));
+    }
+    "bifurcated graph - simple scheduler (multi-threaded, pinned)"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched3_mt_pinned, &marker]() { exec_bm(sched3_mt_pinned, "bifurcated-graph simple-sched (multi-threaded, pinned)", marker); };
+
+    gr::scheduler::BreadthFirst<multiThreaded> sched4_mt_pinned({{"pin_runners", true}});
+    if (auto ret = sched4_mt_pinned.exchange(test_graph_bifurcated<T>(N_NODES)); !ret) {
+        throw std::runtime_error(std::format("failed to initialize scheduler: {}", ret.error()));
+    }
+    "bifurcated graph - BFS scheduler (multi-threaded, pinned)"_benchmark.repeat<N_ITER>(N_SAMPLES) = [&sched4_mt_pinned, &marker]() { exec_bm(sched4_mt_pinned, "bifurcated-graph BFS-sched (multi-threaded, pinned)", marker); };
+
     gr::scheduler::BreadthFirst<multiThreaded, Profiler> sched4_mt_prof;
     if (auto ret = sched4_mt_prof.exchange(test_graph_bifurcated<T>(N_NODES)); !ret) {
         throw std::runtime_error(std::format("failed to initialize scheduler: {}", ret.error()));
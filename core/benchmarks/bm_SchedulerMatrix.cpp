@@ -0,0 +1,293 @@
+#include <benchmark.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+
+#include <gnuradio-4.0/math/Math.hpp>
+#include <gnuradio-4.0/testing/NullSources.hpp>
+#include <gnuradio-4.0/testing/TagMonitors.hpp>
+
+/**
+ * Scheduler benchmark matrix sweeping: graph topology x block cost x buffer size x scheduler/execution policy x thread count
+ *
+ * usage:
+ *   BM_FILTER="DIAMOND"     ./bm_SchedulerMatrix # runs only the cases whose name contains the given sub-string
+ *   BM_JSON=matrix.json     ./bm_SchedulerMatrix # additionally writes all results (incl. latency percentiles) as JSON ("-" -> stdout)
+ *
+ * The source emits a sequence tag every N_LATENCY_STRIDE samples, the (first) sink records its arrival -> source-to-sink latency percentiles.
+ */
+
+using T = float;
+
+inline constexpr std::size_t N_ITER           = 3;
+inline constexpr gr::Size_t  N_SAMPLES        = gr::util::round_up(4'000'000, 1024);
+inline constexpr gr::Size_t  N_LATENCY_STRIDE = 8192U;
+inline constexpr std::size_t N_WIDTH          = 8UZ;    // fan-out/fan-in/diamond width
+inline constexpr std::size_t N_DEPTH          = 8UZ;    // linear chain depth
+inline constexpr std::size_t N_LARGE_GRAPH    = 1000UZ; // number of blocks for the 'LARGE' topology
+inline constexpr std::string_view kSeqKey     = "bm_seq";
+
+template<typename T>
+struct BusyWork : gr::Block<BusyWork<T>> {
+    using Description = gr::Doc<"copies input to output after 'n_ops' dependent multiply-add operations per sample (emulates block cost)">;
+
+    gr::PortIn<T>  in;
+    gr::PortOut<T> out;
+    gr::Size_t     n_ops = 0U;
+
+    GR_MAKE_REFLECTABLE(BusyWork, in, out, n_ops);
+
+    [[nodiscard]] gr::work::Status processBulk(std::span<const T> input, std::span<T> output) const noexcept {
+        for (std::size_t i = 0UZ; i < input.size(); ++i) {
+            T value = input[i];
+            for (gr::Size_t k = 0U; k < n_ops; ++k) {
+                value = value * T(0.999) + T(0.001); // dependent chain, cannot be folded w/o fast-math
+            }
+            output[i] = value;
+        }
+        return gr::work::Status::OK;
+    }
+};
+
+struct LatencyProbe {
+    using clock = std::chrono::steady_clock;
+    std::vector<clock::time_point> emitted;
+    std::vector<clock::time_point> received;
+    std::vector<long double>       latencies; // [s], accumulated over all iterations
+
+    void arm(std::size_t nTags) {
+        emitted.assign(nTags, clock::time_point{});
+        received.assign(nTags, clock::time_point{});
+    }
+
+    void collect() {
+        for (std::size_t i = 0UZ; i < std::min(emitted.size(), received.size()); ++i) {
+            if (emitted[i] != clock::time_point{} && received[i] != clock::time_point{}) {
+                latencies.push_back(std::chrono::duration<long double>(received[i] - emitted[i]).count());
+            }
+        }
+    }
+
+    static void record(std::vector<clock::time_point>& timestamps, const gr::Tag& tag) {
+        const auto now = clock::now();
+        if (auto it = tag.map.find(std::string(kSeqKey)); it != tag.map.end()) {
+            if (const auto* seq = std::get_if<std::uint64_t>(&it->second); seq != nullptr && *seq < timestamps.size() && timestamps[*seq] == clock::time_point{}) {
+                timestamps[*seq] = now;
+            }
+        }
+    }
+};
+
+inline static LatencyProbe _probe;
+
+enum class Topology { LINEAR, FAN_OUT, FAN_IN, DIAMOND, FEEDBACK, LARGE };
+
+struct GraphConfig {
+    Topology    topology;
+    gr::Size_t  nOps;
+    std::size_t bufferSize;
+
+    [[nodiscard]] gr::Size_t nSamples() const noexcept { return topology == Topology::LARGE ? N_SAMPLES / 16U : N_SAMPLES; }
+};
+
+auto& createSource(gr::Graph& graph, gr::Size_t nSamples) {
+    using namespace gr::testing;
+    auto& src = graph.emplaceBlock<TagSource<T, ProcessFunction::USE_PROCESS_BULK>>({{"name", "source"}, {"n_samples_max", nSamples}, {"mark_tag", false}});
+    for (gr::Size_t index = 0U, seq = 0U; index < nSamples; index += N_LATENCY_STRIDE, ++seq) {
+        src._tags.push_back(gr::Tag{index, {{std::string(kSeqKey), static_cast<std::uint64_t>(seq)}}});
+    }
+    src._tagCallback = [](const gr::Tag& tag) { LatencyProbe::record(_probe.emitted, tag); };
+    return src;
+}
+
+auto& createSink(gr::Graph& graph, bool instrumentalise) {
+    using namespace gr::testing;
+    auto& sink = graph.emplaceBlock<TagSink<T, ProcessFunction::USE_PROCESS_BULK>>({{"name", "sink"}, {"log_samples", false}, {"log_tags", instrumentalise}});
+    if (instrumentalise) {
+        sink._tagCallback = [](const gr::Tag& tag) { LatencyProbe::record(_probe.received, tag); };
+    }
+    return sink;
+}
+
+auto& createWork(gr::Graph& graph, const GraphConfig& config) { return graph.emplaceBlock<BusyWork<T>>({{"n_ops", config.nOps}}); }
+
+auto& createAdd(gr::Graph& graph, std::size_t nInputs) { return graph.emplaceBlock<gr::blocks::math::Add<T>>({{"n_inputs", static_cast<gr::Size_t>(nInputs)}}); }
+
+void connect(gr::Graph& graph, auto& src, auto& dst, const GraphConfig& config, std::string_view dstPort = "in") {
+    using namespace std::string_literals;
+    const auto ret = graph.connect(src, "out"s, dst, std::string(dstPort), config.bufferSize);
+    if (ret != gr::ConnectionResult::SUCCESS) {
+        throw gr::exception(std::format("failed to connect '{}' -> '{}.{}'", src.name, dst.name, dstPort));
+    }
+}
+
+gr::Graph createGraph(const GraphConfig& config) {
+    gr::Graph  graph;
+    const auto nSamples = config.nSamples();
+
+    switch (config.topology) {
+    case Topology::LINEAR: { // src -> work^N_DEPTH -> sink
+        auto& src  = createSource(graph, nSamples);
+        auto* last = &createWork(graph, config);
+        connect(graph, src, *last, config);
+        for (std::size_t i = 1UZ; i < N_DEPTH; ++i) {
+            auto& next = createWork(graph, config);
+            connect(graph, *last, next, config);
+            last = &next;
+        }
+        connect(graph, *last, createSink(graph, true), config);
+    } break;
+    case Topology::FAN_OUT: { // src -> N_WIDTH x (work -> sink)
+        auto& src = createSource(graph, nSamples);
+        for (std::size_t i = 0UZ; i < N_WIDTH; ++i) {
+            auto& work = createWork(graph, config);
+            connect(graph, src, work, config);
+            connect(graph, work, createSink(graph, i == 0UZ), config);
+        }
+    } break;
+    case Topology::FAN_IN: { // N_WIDTH x (src -> work) -> add -> sink
+        auto& add = createAdd(graph, N_WIDTH);
+        for (std::size_t i = 0UZ; i < N_WIDTH; ++i) {
+            auto& work = createWork(graph, config);
+            if (i == 0UZ) {
+                connect(graph, createSource(graph, nSamples), work, config);
+            } else {
+                connect(graph, graph.emplaceBlock<gr::testing::ConstantSource<T>>({{"n_samples_max", nSamples}}), work, config);
+            }
+            connect(graph, work, add, config, std::format("in#{}", i));
+        }
+        connect(graph, add, createSink(graph, true), config);
+    } break;
+    case Topology::DIAMOND: { // src -> N_WIDTH x work -> add -> sink
+        auto& src = createSource(graph, nSamples);
+        auto& add = createAdd(graph, N_WIDTH);
+        for (std::size_t i = 0UZ; i < N_WIDTH; ++i) {
+            auto& work = createWork(graph, config);
+            connect(graph, src, work, config);
+            connect(graph, work, add, config, std::format("in#{}", i));
+        }
+        connect(graph, add, createSink(graph, true), config);
+    } break;
+    case Topology::FEEDBACK: { // src -> add -> work -> sink, add -> work(feedback) -> add (loop is primed by the scheduler)
+        auto& src      = createSource(graph, nSamples);
+        auto& add      = createAdd(graph, 2UZ);
+        auto& forward  = createWork(graph, config);
+        auto& feedback = graph.emplaceBlock<BusyWork<T>>({{"name", "feedback"}, {"n_ops", config.nOps}});
+        connect(graph, src, add, config, "in#0");
+        connect(graph, add, forward, config);
+        connect(graph, forward, createSink(graph, true), config);
+        connect(graph, add, feedback, config);
+        connect(graph, feedback, add, config, "in#1");
+    } break;
+    case Topology::LARGE: { // src -> N_WIDTH parallel chains -> N_WIDTH sinks, N_LARGE_GRAPH blocks in total
+        auto&             src      = createSource(graph, nSamples);
+        const std::size_t nPerPath = (N_LARGE_GRAPH - 1UZ) / N_WIDTH - 1UZ; // minus source, minus one sink per path
+        for (std::size_t path = 0UZ; path < N_WIDTH; ++path) {
+            auto* last = &createWork(graph, config);
+            connect(graph, src, *last, config);
+            for (std::size_t i = 1UZ; i < nPerPath; ++i) {
+                auto& next = createWork(graph, config);
+                connect(graph, *last, next, config);
+                last = &next;
+            }
+            connect(graph, *last, createSink(graph, path == 0UZ), config);
+        }
+    } break;
+    }
+    return graph;
+}
+
+[[nodiscard]] bool isSelected(std::string_view name) {
+    const char* filter = std::getenv("BM_FILTER");
+    return filter == nullptr || name.find(filter) != std::string_view::npos;
+}
+
+void setCpuThreads(std::size_t nThreads) {
+    using namespace gr::thread_pool;
+    Manager::instance().replacePool(std::string(kDefaultCpuPoolId), std::make_shared<ThreadPoolWrapper>(std::make_unique<BasicThreadPool>(std::string(kDefaultCpuPoolId), TaskType::CPU_BOUND, nThreads, nThreads), "CPU"));
+}
+
+void addLatencyResult(const std::vector<long double>& latencies) {
+    auto& map = ::benchmark::results::add_result("  └─latency: source→sink tag");
+    if (latencies.empty()) {
+        return;
+    }
+    std::vector<long double> sorted = latencies;
+    std::ranges::sort(sorted);
+    const auto percentile = [&sorted](double p) { return sorted[std::min(sorted.size() - 1UZ, static_cast<std::size_t>(p * static_cast<double>(sorted.size())))]; };
+    map.try_emplace("min", sorted.front(), "s", 2);
+    map.try_emplace("p50", percentile(0.50), "s", 2);
+    map.try_emplace("p90", percentile(0.90), "s", 2);
+    map.try_emplace("p99", percentile(0.99), "s", 2);
+    map.try_emplace("max", sorted.back(), "s", 2);
+    map.try_emplace("#tags", static_cast<std::uint64_t>(sorted.size()), "", 0);
+}
+
+template<typename TScheduler>
+void runCase(std::string_view schedulerName, const GraphConfig& config, std::size_t nThreads) {
+    const std::string name = std::format("{:8} ops={:2} buf={:6} {:12} threads={:2}", magic_enum::enum_name(config.topology), config.nOps, config.bufferSize, schedulerName, nThreads);
+    if (!isSelected(name)) {
+        return;
+    }
+
+    TScheduler sched;
+    if (auto ret = sched.exchange(createGraph(config)); !ret) {
+        throw std::runtime_error(std::format("failed to initialize scheduler: {}", ret.error()));
+    }
+
+    const std::size_t nTags = config.nSamples() / N_LATENCY_STRIDE + 1UZ;
+    _probe.latencies.clear();
+    ::benchmark::benchmark<N_ITER>(name, config.nSamples()) = [&sched, &name, nTags]() {
+        _probe.arm(nTags);
+        const auto res = sched.runAndWait();
+        boost::ut::expect(res.has_value()) << [&] { return std::format("scheduler failure for test-case: {}\n    - error: {}", name, res.error()); } << boost::ut::fatal;
+        _probe.collect();
+    };
+    addLatencyResult(_probe.latencies);
+}
+
+template<gr::scheduler::ExecutionPolicy policy>
+void runSchedulers(const GraphConfig& config, std::size_t nThreads) {
+    using namespace gr::scheduler;
+    const auto policyName = policy == ExecutionPolicy::singleThreaded ? "ST" : (policy == ExecutionPolicy::singleThreadedBlocking ? "ST-blocking" : "MT");
+    runCase<Simple<policy>>(std::format("simple-{}", policyName), config, nThreads);
+    runCase<BreadthFirst<policy>>(std::format("BFS-{}", policyName), config, nThreads);
+    runCase<DepthFirst<policy>>(std::format("DFS-{}", policyName), config, nThreads);
+}
+
+[[maybe_unused]] inline const boost::ut::suite<"scheduler matrix"> _schedulerMatrix = [] {
+    using gr::scheduler::ExecutionPolicy;
+
+    const std::size_t nCores = std::max(2UZ, static_cast<std::size_t>(std::thread::hardware_concurrency()));
+    std::println("INFO: std::thread::hardware_concurrency() = {} - BM_FILTER = '{}'", nCores, std::getenv("BM_FILTER") ? std::getenv("BM_FILTER") : "");
+
+    for (Topology topology : magic_enum::enum_values<Topology>()) {
+        for (gr::Size_t nOps : {gr::Size_t(0U), gr::Size_t(16U)}) {
+            for (std::size_t bufferSize : {4096UZ, 65536UZ}) {
+                const GraphConfig config{topology, nOps, bufferSize};
+
+                setCpuThreads(1UZ);
+                runSchedulers<ExecutionPolicy::singleThreaded>(config, 1UZ);
+                runSchedulers<ExecutionPolicy::singleThreadedBlocking>(config, 1UZ);
+                for (std::size_t nThreads : {2UZ, nCores}) {
+                    setCpuThreads(nThreads);
+                    runSchedulers<ExecutionPolicy::multiThreaded>(config, nThreads);
+                    if (nThreads == nCores) {
+                        break; // avoid duplicates on 2-core machines
+                    }
+                }
+            }
+        }
+        ::benchmark::results::add_separator();
+    }
+};
+
+int main() { /* not needed by the UT framework */ }
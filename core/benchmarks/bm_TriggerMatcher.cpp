@@ -0,0 +1,82 @@
+#include <benchmark.hpp>
+
+#include <array>
+#include <format>
+
+#include <gnuradio-4.0/Tag.hpp>
+#include <gnuradio-4.0/TriggerMatcher.hpp>
+
+namespace {
+constexpr std::size_t kNContexts = 32UZ; // concurrently monitored beam-process contexts
+constexpr std::size_t kNTags     = 10'000UZ;
+
+std::vector<gr::Tag> timingEventStream() {
+    using namespace gr;
+    constexpr std::array eventNames{"CMD_SEQ_START", "CMD_BP_START", "CMD_BEAM_INJECTION", "CMD_START_ENERGY_RAMP", "CMD_BEAM_EXTRACTION", "CMD_BP_STOP"};
+    std::vector<Tag>     tags;
+    tags.reserve(kNTags);
+    for (std::size_t i = 0UZ; i < kNTags; ++i) {
+        const std::size_t context = (i / eventNames.size()) % kNContexts;
+        tags.emplace_back(i * 100UZ, property_map{
+                                         {tag::TRIGGER_NAME.shortKey(), std::string(eventNames[i % eventNames.size()])},                      //
+                                         {tag::CONTEXT.shortKey(), std::format("FAIR.SELECTOR.C={}:S=1:P={}", context, i % 3UZ)},              //
+                                         {tag::TRIGGER_TIME.shortKey(), static_cast<std::uint64_t>(i * 1'000'000UZ)},                        //
+                                         {tag::TRIGGER_OFFSET.shortKey(), 0.f},                                                              //
+                                         {tag::TRIGGER_META_INFO.shortKey(), property_map{{"beam-in", true}, {"local-time", std::uint64_t{0}}}} //
+                                     });
+    }
+    return tags;
+}
+
+std::vector<std::string> contextFilters() {
+    std::vector<std::string> filters;
+    for (std::size_t context = 0UZ; context < kNContexts; ++context) {
+        filters.push_back(std::format("[CMD_BP_START/FAIR.SELECTOR.C={}, CMD_BP_STOP/FAIR.SELECTOR.C={}]", context, context));
+    }
+    return filters;
+}
+} // namespace
+
+inline const boost::ut::suite<"trigger matcher"> _triggerMatcherBenchmarks = [] {
+    using namespace benchmark;
+    using namespace gr::trigger;
+    using namespace gr::trigger::BasicTriggerNameCtxMatcher;
+    constexpr std::size_t n_repetitions = 10;
+
+    const std::vector<gr::Tag>     tags    = timingEventStream();
+    const std::vector<std::string> filters = contextFilters();
+
+    {
+        std::vector<gr::property_map> states(kNContexts);
+        std::size_t                   nMatches = 0UZ;
+        ::benchmark::benchmark<n_repetitions>(std::format("filter(criteria, tag, property_map) - {} contexts", kNContexts), kNTags * kNContexts) = [&] {
+            for (const auto& tag : tags) {
+                for (std::size_t i = 0UZ; i < kNContexts; ++i) {
+                    nMatches += filter(filters[i], tag, states[i]) != MatchResult::Ignore;
+                }
+            }
+        };
+        boost::ut::expect(nMatches > 0UZ);
+    }
+
+    {
+        std::vector<Compiled> matchers;
+        for (const auto& definition : filters) {
+            matchers.emplace_back(definition);
+        }
+        std::vector<State> states(kNContexts);
+        std::size_t        nMatches = 0UZ;
+        ::benchmark::benchmark<n_repetitions>(std::format("Compiled(tag, State)                - {} contexts", kNContexts), kNTags * kNContexts) = [&] {
+            for (const auto& tag : tags) {
+                for (std::size_t i = 0UZ; i < kNContexts; ++i) {
+                    nMatches += matchers[i](tag, states[i]) != MatchResult::Ignore;
+                }
+            }
+        };
+        boost::ut::expect(nMatches > 0UZ);
+    }
+
+    ::benchmark::results::add_separator();
+};
+
+int main() { /* not needed by the UT framework */ }
@@ -0,0 +1,80 @@
+#include <benchmark.hpp>
+
+#include <format>
+#include <string>
+
+#include <gnuradio-4.0/YamlPmt.hpp>
+
+/**
+ * YAML parsing of a GRC graph description with large typed tap vectors (e.g. FIR filter coefficients):
+ * 'std::from_chars' fast path for homogeneous numeric sequences vs. the generic per-element 'pmt' parser
+ */
+
+inline constexpr std::size_t N_ITER = 5;
+inline constexpr std::size_t N_TAPS = 1'000'000;
+
+enum class Style { Block, Flow };
+
+std::string makeGraph(std::string_view typeTag, Style style, std::size_t nTaps) {
+    std::string yaml;
+    yaml.reserve(nTaps * 16UZ + 512UZ);
+    yaml += R"(blocks:
+  - name: source
+    id: gr::testing::NullSource<float32>
+  - name: filter
+    id: gr::filter::fir_filter<float32>
+    parameters:
+      name: filter
+)";
+    yaml += std::format("      b: {}", typeTag);
+    if (style == Style::Block) {
+        yaml += '\n';
+        for (std::size_t i = 0UZ; i < nTaps; ++i) {
+            yaml += std::format("        - {}\n", 1.0 / static_cast<double>(i + 1UZ));
+        }
+    } else {
+        yaml += " [";
+        for (std::size_t i = 0UZ; i < nTaps; ++i) {
+            yaml += std::format("{}{}", i == 0UZ ? "" : ", ", 1.0 / static_cast<double>(i + 1UZ));
+        }
+        yaml += "]\n";
+    }
+    yaml += R"(  - name: sink
+    id: gr::testing::NullSink<float32>
+connections:
+  - [source, 0, filter, 0]
+  - [filter, 0, sink, 0]
+)";
+    return yaml;
+}
+
+template<typename T>
+void parseGraph(const std::string& yaml, bool numericFastPath) {
+    using namespace boost::ut;
+    using namespace std::string_literals;
+    auto result = pmtv::yaml::detail::deserialize(yaml, numericFastPath);
+    expect(result.has_value()) << fatal;
+    const auto& blocks = std::get<std::vector<pmtv::pmt>>(result->at("blocks"s));
+    const auto& filter = std::get<pmtv::map_t>(blocks[1UZ]);
+    const auto& taps   = std::get<std::vector<T>>(std::get<pmtv::map_t>(filter.at("parameters"s)).at("b"s));
+    expect(eq(taps.size(), N_TAPS));
+    ::benchmark::force_to_memory(result);
+}
+
+template<typename T>
+void runBenchmarks(std::string_view typeTag) {
+    for (Style style : {Style::Block, Style::Flow}) {
+        const std::string yaml      = makeGraph(typeTag, style, N_TAPS);
+        const std::string styleName = style == Style::Block ? "block" : "flow ";
+        ::benchmark::benchmark<N_ITER>(std::format("{:9} {} taps - generic parser", typeTag, styleName), N_TAPS) = [&yaml] { parseGraph<T>(yaml, false); };
+        ::benchmark::benchmark<N_ITER>(std::format("{:9} {} taps - from_chars fast path", typeTag, styleName), N_TAPS) = [&yaml] { parseGraph<T>(yaml, true); };
+    }
+}
+
+inline const boost::ut::suite<"YAML typed numeric sequences"> _yamlPmtBenchmarks = [] {
+    runBenchmarks<float>("!!float32");
+    ::benchmark::results::add_separator();
+    runBenchmarks<double>("!!float64");
+};
+
+int main() { /* not needed by the UT framework */ }
@@ -0,0 +1,440 @@
+#ifndef GNURADIO_BINARY_PMT_HPP
+#define GNURADIO_BINARY_PMT_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <format>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <pmtv/pmt.hpp>
+
+namespace pmtv::binary {
+
+/**
+ * Compact, versioned binary encoding of 'pmtv::pmt' and 'pmtv::map_t' -- the counterpart to 'pmtv::yaml' for large
+ * property maps (e.g. filter taps, calibration tables, graph snapshots, or message payloads) where text formatting and
+ * parsing of every numeric element dominates.
+ *
+ * layout:
+ *   header:       'G' 'R' 'P' 'B' | version (uint8) | flags (uint8, bit0: big-endian writer)
+ *   string table: count (varint), then per map key: length (varint) + UTF-8 bytes -- each distinct key is stored once
+ *   root value:   type code (uint8) + payload
+ *
+ * payloads:
+ *   null: -, bool: uint8, scalars: raw bytes in writer byte-order, string: length (varint) + bytes,
+ *   map:  count (varint), then per entry: key index into the string table (varint) + value,
+ *   vector<pmt>: count (varint) + values, vector<T>: type code | 0x80, count (varint) + contiguous raw element bytes
+ *   (N.B. vector<bool>: one byte per element, vector<string>: length-prefixed strings).
+ *
+ * Readers reject unknown versions; data written on a host of different byte-order is swapped while reading.
+ */
+
+inline constexpr std::array<std::uint8_t, 4UZ> kMagic{'G', 'R', 'P', 'B'};
+inline constexpr std::uint8_t                  kVersion  = 1U;
+inline constexpr std::size_t                   kMaxDepth = 256UZ; // limits recursion on malformed/malicious input
+
+struct ParseError {
+    std::size_t offset = std::numeric_limits<std::size_t>::max(); // byte offset
+    std::string message;
+};
+
+namespace detail {
+
+enum class TypeCode : std::uint8_t { Null = 0U, Bool, UInt8, UInt16, UInt32, UInt64, Int8, Int16, Int32, Int64, Float32, Float64, Complex32, Complex64, String, Map, PmtVector, Invalid = 0x7FU, VectorFlag = 0x80U };
+
+template<typename T>
+struct is_complex : std::false_type {};
+template<typename T>
+struct is_complex<std::complex<T>> : std::true_type {};
+
+template<typename T>
+constexpr TypeCode typeCode() noexcept {
+    if constexpr (std::is_same_v<T, bool>) {
+        return TypeCode::Bool;
+    } else if constexpr (std::is_same_v<T, std::uint8_t>) {
+        return TypeCode::UInt8;
+    } else if constexpr (std::is_same_v<T, std::uint16_t>) {
+        return TypeCode::UInt16;
+    } else if constexpr (std::is_same_v<T, std::uint32_t>) {
+        return TypeCode::UInt32;
+    } else if constexpr (std::is_same_v<T, std::uint64_t>) {
+        return TypeCode::UInt64;
+    } else if constexpr (std::is_same_v<T, std::int8_t>) {
+        return TypeCode::Int8;
+    } else if constexpr (std::is_same_v<T, std::int16_t>) {
+        return TypeCode::Int16;
+    } else if constexpr (std::is_same_v<T, std::int32_t>) {
+        return TypeCode::Int32;
+    } else if constexpr (std::is_same_v<T, std::int64_t>) {
+        return TypeCode::Int64;
+    } else if constexpr (std::is_same_v<T, float>) {
+        return TypeCode::Float32;
+    } else if constexpr (std::is_same_v<T, double>) {
+        return TypeCode::Float64;
+    } else if constexpr (std::is_same_v<T, std::complex<float>>) {
+        return TypeCode::Complex32;
+    } else if constexpr (std::is_same_v<T, std::complex<double>>) {
+        return TypeCode::Complex64;
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return TypeCode::String;
+    } else {
+        return TypeCode::Invalid;
+    }
+}
+
+template<typename T>
+concept RawScalar = ((std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) || is_complex<T>::value) && typeCode<T>() != TypeCode::Invalid;
+
+template<typename T>
+concept TypedVector = std::ranges::random_access_range<T> && requires { typename T::value_type; } && (typeCode<typename T::value_type>() != TypeCode::Invalid);
+
+template<typename Fnc>
+pmtv::pmt applyTypeCode(TypeCode code, Fnc&& fnc) {
+    switch (code) {
+    case TypeCode::Bool: return fnc(std::type_identity<bool>{});
+    case TypeCode::UInt8: return fnc(std::type_identity<std::uint8_t>{});
+    case TypeCode::UInt16: return fnc(std::type_identity<std::uint16_t>{});
+    case TypeCode::UInt32: return fnc(std::type_identity<std::uint32_t>{});
+    case TypeCode::UInt64: return fnc(std::type_identity<std::uint64_t>{});
+    case TypeCode::Int8: return fnc(std::type_identity<std::int8_t>{});
+    case TypeCode::Int16: return fnc(std::type_identity<std::int16_t>{});
+    case TypeCode::Int32: return fnc(std::type_identity<std::int32_t>{});
+    case TypeCode::Int64: return fnc(std::type_identity<std::int64_t>{});
+    case TypeCode::Float32: return fnc(std::type_identity<float>{});
+    case TypeCode::Float64: return fnc(std::type_identity<double>{});
+    case TypeCode::Complex32: return fnc(std::type_identity<std::complex<float>>{});
+    case TypeCode::Complex64: return fnc(std::type_identity<std::complex<double>>{});
+    case TypeCode::String: return fnc(std::type_identity<std::string>{});
+    default: return fnc(std::type_identity<void>{});
+    }
+}
+
+struct Writer {
+    std::vector<std::uint8_t>                           body;
+    std::unordered_map<std::string_view, std::uint64_t> keyIndex; // N.B. views into the keys of the map being serialised
+    std::vector<std::string_view>                       keys;
+
+    static void writeVarint(std::vector<std::uint8_t>& out, std::uint64_t value) {
+        while (value >= 0x80U) {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80U));
+            value >>= 7U;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    static void writeBytes(std::vector<std::uint8_t>& out, const void* data, std::size_t nBytes) {
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+        out.insert(out.end(), bytes, bytes + nBytes);
+    }
+
+    static void writeString(std::vector<std::uint8_t>& out, std::string_view str) {
+        writeVarint(out, str.size());
+        writeBytes(out, str.data(), str.size());
+    }
+
+    void writeCode(TypeCode code) { body.push_back(static_cast<std::uint8_t>(code)); }
+
+    void writeKey(std::string_view key) {
+        const auto [it, inserted] = keyIndex.try_emplace(key, keys.size());
+        if (inserted) {
+            keys.push_back(key);
+        }
+        writeVarint(body, it->second);
+    }
+
+    void writeValue(const pmtv::pmt& var) {
+        std::visit(
+            [this]<typename T>(const T& value) {
+                if constexpr (std::is_same_v<T, std::monostate>) {
+                    writeCode(TypeCode::Null);
+                } else if constexpr (std::is_same_v<T, bool>) {
+                    writeCode(TypeCode::Bool);
+                    body.push_back(value ? 1U : 0U);
+                } else if constexpr (RawScalar<T>) {
+                    writeCode(typeCode<T>());
+                    writeBytes(body, &value, sizeof(T));
+                } else if constexpr (std::is_same_v<T, std::string>) {
+                    writeCode(TypeCode::String);
+                    writeString(body, value);
+                } else if constexpr (std::is_same_v<T, pmtv::map_t>) {
+                    writeCode(TypeCode::Map);
+                    writeVarint(body, value.size());
+                    for (const auto& [key, item] : value) {
+                        writeKey(key);
+                        writeValue(item);
+                    }
+                } else if constexpr (std::is_same_v<T, std::vector<pmtv::pmt>>) {
+                    writeCode(TypeCode::PmtVector);
+                    writeVarint(body, value.size());
+                    for (const auto& item : value) {
+                        writeValue(item);
+                    }
+                } else if constexpr (TypedVector<T>) {
+                    using V = typename T::value_type;
+                    body.push_back(static_cast<std::uint8_t>(typeCode<V>()) | static_cast<std::uint8_t>(TypeCode::VectorFlag));
+                    writeVarint(body, value.size());
+                    if constexpr (std::is_same_v<V, bool>) {
+                        for (const bool item : value) {
+                            body.push_back(item ? 1U : 0U);
+                        }
+                    } else if constexpr (std::is_same_v<V, std::string>) {
+                        for (const auto& item : value) {
+                            writeString(body, item);
+                        }
+                    } else {
+                        writeBytes(body, value.data(), value.size() * sizeof(V)); // bulk copy
+                    }
+                } else {
+                    throw std::invalid_argument("pmtv::binary::serialize: unsupported pmt value type");
+                }
+            },
+            var);
+    }
+
+    [[nodiscard]] std::vector<std::uint8_t> finish() const {
+        std::vector<std::uint8_t> out;
+        out.reserve(kMagic.size() + 2UZ + body.size() + 16UZ * keys.size());
+        out.insert(out.end(), kMagic.begin(), kMagic.end());
+        out.push_back(kVersion);
+        out.push_back(std::endian::native == std::endian::big ? 1U : 0U);
+        writeVarint(out, keys.size());
+        for (const auto& key : keys) {
+            writeString(out, key);
+        }
+        out.insert(out.end(), body.begin(), body.end());
+        return out;
+    }
+};
+
+struct DecodeFailure {
+    std::size_t offset;
+    std::string message;
+};
+
+struct Reader {
+    std::span<const std::uint8_t> data;
+    std::size_t                   pos       = 0UZ;
+    bool                          swapBytes = false;
+    std::vector<std::string>      keys;
+
+    [[noreturn]] void fail(std::string message) const { throw DecodeFailure{pos, std::move(message)}; }
+
+    [[nodiscard]] std::size_t remaining() const noexcept { return data.size() - pos; }
+
+    std::uint8_t readByte() {
+        if (remaining() < 1UZ) {
+            fail("unexpected end of data");
+        }
+        return data[pos++];
+    }
+
+    std::uint64_t readVarint() {
+        std::uint64_t value = 0U;
+        for (unsigned shift = 0U; shift < 64U; shift += 7U) {
+            const std::uint8_t byte = readByte();
+            value |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+            if ((byte & 0x80U) == 0U) {
+                return value;
+            }
+        }
+        fail("varint too long");
+    }
+
+    /// reads an element count and checks it against the remaining bytes to reject corrupt sizes before allocating
+    std::size_t readCount(std::size_t minBytesPerElement) {
+        const std::uint64_t count = readVarint();
+        if (minBytesPerElement > 0UZ && count > remaining() / minBytesPerElement) {
+            fail(std::format("count {} exceeds remaining {} bytes", count, remaining()));
+        }
+        return static_cast<std::size_t>(count);
+    }
+
+    std::string readString() {
+        const std::size_t length = readCount(1UZ);
+        std::string       str(reinterpret_cast<const char*>(data.data() + pos), length);
+        pos += length;
+        return str;
+    }
+
+    template<RawScalar T>
+    void readRaw(T* dst, std::size_t nElements) {
+        const std::size_t nBytes = nElements * sizeof(T);
+        if (remaining() < nBytes) {
+            fail("unexpected end of data");
+        }
+        std::memcpy(dst, data.data() + pos, nBytes);
+        pos += nBytes;
+        if constexpr (sizeof(T) > 1UZ) {
+            if (swapBytes) {
+                constexpr std::size_t wordSize = is_complex<T>::value ? sizeof(T) / 2UZ : sizeof(T); // complex: swap real/imag separately
+                auto*                 bytes    = reinterpret_cast<std::uint8_t*>(dst);
+                for (std::size_t i = 0UZ; i < nBytes; i += wordSize) {
+                    std::reverse(bytes + i, bytes + i + wordSize);
+                }
+            }
+        }
+    }
+
+    void readHeader() {
+        if (data.size() < kMagic.size() + 2UZ || !std::equal(kMagic.begin(), kMagic.end(), data.begin())) {
+            fail("missing binary pmt magic");
+        }
+        pos = kMagic.size();
+        const std::uint8_t version   = readByte();
+        const std::uint8_t flags     = readByte();
+        const bool         bigEndian = (flags & 0x01U) != 0U;
+        if (version != kVersion) {
+            pos -= 2UZ;
+            fail(std::format("unsupported binary pmt version {} (supported: {})", version, kVersion));
+        }
+        swapBytes = bigEndian != (std::endian::native == std::endian::big);
+
+        const std::size_t nKeys = readCount(1UZ);
+        keys.reserve(nKeys);
+        for (std::size_t i = 0UZ; i < nKeys; ++i) {
+            keys.push_back(readString());
+        }
+    }
+
+    pmtv::pmt readVector(TypeCode elementCode) {
+        return applyTypeCode(elementCode, [this]<typename T>(std::type_identity<T>) -> pmtv::pmt {
+            if constexpr (std::is_void_v<T>) {
+                fail("unknown vector element type");
+            } else if constexpr (std::is_same_v<T, bool>) {
+                std::vector<bool> vec(readCount(1UZ));
+                for (std::size_t i = 0UZ; i < vec.size(); ++i) {
+                    vec[i] = readByte() != 0U;
+                }
+                return vec;
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                std::vector<std::string> vec(readCount(1UZ));
+                for (auto& str : vec) {
+                    str = readString();
+                }
+                return vec;
+            } else {
+                std::vector<T> vec(readCount(sizeof(T)));
+                readRaw(vec.data(), vec.size());
+                return vec;
+            }
+        });
+    }
+
+    pmtv::map_t readMap(std::size_t depth) {
+        pmtv::map_t       map;
+        const std::size_t nEntries = readCount(2UZ);
+        for (std::size_t i = 0UZ; i < nEntries; ++i) {
+            const std::uint64_t keyIndex = readVarint();
+            if (keyIndex >= keys.size()) {
+                fail(std::format("key index {} out of range [0, {})", keyIndex, keys.size()));
+            }
+            map.insert_or_assign(keys[static_cast<std::size_t>(keyIndex)], readValue(depth + 1UZ));
+        }
+        return map;
+    }
+
+    pmtv::pmt readValue(std::size_t depth) {
+        if (depth > kMaxDepth) {
+            fail(std::format("nesting depth exceeds {}", kMaxDepth));
+        }
+        const std::uint8_t code = readByte();
+        if ((code & static_cast<std::uint8_t>(TypeCode::VectorFlag)) != 0U) {
+            return readVector(static_cast<TypeCode>(code & ~static_cast<std::uint8_t>(TypeCode::VectorFlag)));
+        }
+        switch (static_cast<TypeCode>(code)) {
+        case TypeCode::Null: return std::monostate{};
+        case TypeCode::Bool: return readByte() != 0U;
+        case TypeCode::String: return readString();
+        case TypeCode::Map: return readMap(depth);
+        case TypeCode::PmtVector: {
+            std::vector<pmtv::pmt> vec(readCount(1UZ));
+            for (auto& item : vec) {
+                item = readValue(depth + 1UZ);
+            }
+            return vec;
+        }
+        default:
+            return applyTypeCode(static_cast<TypeCode>(code), [this, code]<typename T>(std::type_identity<T>) -> pmtv::pmt {
+                if constexpr (RawScalar<T>) {
+                    T value;
+                    readRaw(&value, 1UZ);
+                    return value;
+                } else {
+                    pos -= 1UZ;
+                    fail(std::format("unknown type code {:#04x}", code));
+                }
+            });
+        }
+    }
+};
+
+template<typename TResult>
+std::expected<TResult, ParseError> decode(std::span<const std::uint8_t> data) {
+    Reader reader{.data = data};
+    try {
+        reader.readHeader();
+        pmtv::pmt root = reader.readValue(0UZ);
+        if (reader.remaining() != 0UZ) {
+            reader.fail(std::format("{} trailing bytes", reader.remaining()));
+        }
+        if constexpr (std::is_same_v<TResult, pmtv::pmt>) {
+            return root;
+        } else {
+            if (auto* map = std::get_if<pmtv::map_t>(&root); map != nullptr) {
+                return std::move(*map);
+            }
+            return std::unexpected(ParseError{.offset = kMagic.size() + 2UZ, .message = "root value is not a map"});
+        }
+    } catch (const DecodeFailure& e) {
+        return std::unexpected(ParseError{.offset = e.offset, .message = e.message});
+    } catch (const std::bad_alloc&) {
+        return std::unexpected(ParseError{.offset = reader.pos, .message = "out of memory"});
+    }
+}
+
+} // namespace detail
+
+/// @return true if 'data' starts with the binary pmt magic (e.g. to dispatch between YAML and binary input)
+[[nodiscard]] inline bool isBinary(std::span<const std::uint8_t> data) noexcept { return data.size() >= kMagic.size() && std::equal(kMagic.begin(), kMagic.end(), data.begin()); }
+
+[[nodiscard]] inline bool isBinary(std::string_view data) noexcept { return isBinary(std::span(reinterpret_cast<const std::uint8_t*>(data.data()), data.size())); }
+
+[[nodiscard]] inline std::vector<std::uint8_t> serialize(const pmtv::pmt& value) {
+    detail::Writer writer;
+    writer.writeValue(value);
+    return writer.finish();
+}
+
+[[nodiscard]] inline std::vector<std::uint8_t> serialize(const pmtv::map_t& map) {
+    detail::Writer writer;
+    writer.writeCode(detail::TypeCode::Map);
+    detail::Writer::writeVarint(writer.body, map.size());
+    for (const auto& [key, item] : map) {
+        writer.writeKey(key);
+        writer.writeValue(item);
+    }
+    return writer.finish();
+}
+
+inline std::expected<pmtv::map_t, ParseError> deserialize(std::span<const std::uint8_t> data) { return detail::decode<pmtv::map_t>(data); }
+
+inline std::expected<pmtv::map_t, ParseError> deserialize(std::string_view data) { return deserialize(std::span(reinterpret_cast<const std::uint8_t*>(data.data()), data.size())); }
+
+inline std::expected<pmtv::pmt, ParseError> deserializePmt(std::span<const std::uint8_t> data) { return detail::decode<pmtv::pmt>(data); }
+
+} // namespace pmtv::binary
+
+#endif // GNURADIO_BINARY_PMT_HPP
@@ -1,6 +1,8 @@
 #ifndef GNURADIO_BLOCK_HPP
 #define GNURADIO_BLOCK_HPP
 
+#include <array>
+#include <chrono>
 #include <limits>
 #include <map>
 #include <source_location>
@@ -469,6 +471,70 @@ struct Result {
     std::size_t performed_work = 0;
     Status      status         = Status::OK;
 };
+
+/**
+ * @brief lock-free per-block runtime statistics updated by 'work()' and read asynchronously (e.g. via the block::property::kMetrics property)
+ *
+ * All counters use relaxed atomics: they are monotonic, independent and only need to be eventually consistent for the reader.
+ */
+class Metrics {
+    static constexpr std::array kStatusList{Status::OK, Status::DONE, Status::INSUFFICIENT_INPUT_ITEMS, Status::INSUFFICIENT_OUTPUT_ITEMS, Status::ERROR};
+
+    std::atomic<std::uint64_t>                                 _nWorkCalls{0U};
+    std::atomic<std::uint64_t>                                 _nSamplesIn{0U};
+    std::atomic<std::uint64_t>                                 _nSamplesOut{0U};
+    std::atomic<std::uint64_t>                                 _processingTimeNs{0U}; // time spent inside the user-provided processBulk(...)/processOne(...)
+    std::atomic<std::uint64_t>                                 _maxWorkLatencyNs{0U}; // worst-case duration of a single work(...) call
+    std::array<std::atomic<std::uint64_t>, kStatusList.size()> _nStatus{};
+
+    static constexpr std::size_t statusIndex(Status status) noexcept {
+        const auto it = std::ranges::find(kStatusList, status);
+        return it != kStatusList.end() ? static_cast<std::size_t>(std::distance(kStatusList.begin(), it)) : kStatusList.size() - 1UZ;
+    }
+
+public:
+    void recordWork(Status status, std::chrono::nanoseconds latency = std::chrono::nanoseconds::zero()) noexcept {
+        _nWorkCalls.fetch_add(1U, std::memory_order_relaxed);
+        _nStatus[statusIndex(status)].fetch_add(1U, std::memory_order_relaxed);
+        const auto    latencyNs = static_cast<std::uint64_t>(std::max(latency.count(), std::chrono::nanoseconds::rep{0}));
+        std::uint64_t maxNs     = _maxWorkLatencyNs.load(std::memory_order_relaxed);
+        while (latencyNs > maxNs && !_maxWorkLatencyNs.compare_exchange_weak(maxNs, latencyNs, std::memory_order_relaxed)) {
+        }
+    }
+
+    void recordSamples(std::size_t nIn, std::size_t nOut) noexcept {
+        _nSamplesIn.fetch_add(nIn, std::memory_order_relaxed);
+        _nSamplesOut.fetch_add(nOut, std::memory_order_relaxed);
+    }
+
+    void recordProcessingTime(std::chrono::nanoseconds duration) noexcept { _processingTimeNs.fetch_add(static_cast<std::uint64_t>(duration.count()), std::memory_order_relaxed); }
+
+    [[nodiscard]] std::uint64_t nWorkCalls() const noexcept { return _nWorkCalls.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t nSamplesIn() const noexcept { return _nSamplesIn.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t nSamplesOut() const noexcept { return _nSamplesOut.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t processingTimeNs() const noexcept { return _processingTimeNs.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t maxWorkLatencyNs() const noexcept { return _maxWorkLatencyNs.load(std::memory_order_relaxed); }
+    [[nodiscard]] std::uint64_t nStatus(Status status) const noexcept { return _nStatus[statusIndex(status)].load(std::memory_order_relaxed); }
+
+    void reset() noexcept {
+        _nWorkCalls.store(0U, std::memory_order_relaxed);
+        _nSamplesIn.store(0U, std::memory_order_relaxed);
+        _nSamplesOut.store(0U, std::memory_order_relaxed);
+        _processingTimeNs.store(0U, std::memory_order_relaxed);
+        _maxWorkLatencyNs.store(0U, std::memory_order_relaxed);
+        std::ranges::for_each(_nStatus, [](auto& counter) { counter.store(0U, std::memory_order_relaxed); });
+    }
+
+    [[nodiscard]] property_map toPropertyMap() const {
+        using namespace std::string_literals;
+        property_map statusHistogram;
+        for (const Status status : kStatusList) {
+            statusHistogram.insert_or_assign(std::string(magic_enum::enum_name(status)), nStatus(status));
+        }
+        return {{"nWorkCalls"s, nWorkCalls()}, {"nSamplesIn"s, nSamplesIn()}, {"nSamplesOut"s, nSamplesOut()}, {"processingTimeNs"s, processingTimeNs()}, {"maxWorkLatencyNs"s, maxWorkLatencyNs()}, //
+            {"status"s, std::move(statusHistogram)}};
+    }
+};
 } // namespace work
 
 template<typename T>
@@ -535,6 +601,8 @@ inline static const char* kActiveContext    = "ActiveContext";    ///< retrieve
 inline static const char* kSettingsCtx      = "SettingsCtx";      ///< retrieve/creates/remove a new stored context
 inline static const char* kSettingsContexts = "SettingsContexts"; ///< retrieve/creates/remove a new stored context
 
+inline static const char* kMetrics = "Metrics"; ///< retrieve (Get) or reset (Set) the runtime statistics: work() calls, samples in/out, processing time, status histogram and port buffer fill levels
+
 } // namespace block::property
 
 namespace block {
@@ -684,10 +752,12 @@ public:
     using StrideControl              = ArgumentsTypeList::template find_or_default<is_stride, Stride<0UL, true>>;
     using AllowIncompleteFinalUpdate = ArgumentsTypeList::template find_or_default<is_incompleteFinalUpdatePolicy, IncompleteFinalUpdatePolicy<IncompleteFinalUpdateEnum::DROP>>;
     using DrawableControl            = ArgumentsTypeList::template find_or_default<is_drawable, Drawable<UICategory::None, "">>;
+    using PassThroughControl         = ArgumentsTypeList::template find_or_default<is_pass_through, PassThrough<>>;
 
     constexpr static bool blockingIO             = std::disjunction_v<std::is_same<BlockingIO<true>, Arguments>..., std::is_same<BlockingIO<false>, Arguments>...>;
     constexpr static bool noDefaultTagForwarding = std::disjunction_v<std::is_same<NoDefaultTagForwarding, Arguments>...>;
     constexpr static bool backwardTagForwarding  = std::disjunction_v<std::is_same<BackwardTagForwarding, Arguments>...>;
+    constexpr static bool passThrough            = std::disjunction_v<is_pass_through<Arguments>...>;
 
     constexpr static block::Category blockCategory = block::Category::NormalBlock;
 
@@ -707,6 +777,7 @@ public:
     alignas(hardware_destructive_interference_size) std::atomic<work::Status> ioLastWorkStatus{work::Status::OK};
     alignas(hardware_destructive_interference_size) std::shared_ptr<gr::Sequence> progress = std::make_shared<gr::Sequence>();
     alignas(hardware_destructive_interference_size) std::atomic<bool> ioThreadRunning{false};
+    alignas(hardware_destructive_interference_size) work::Metrics workMetrics{}; // runtime statistics, @see block::property::kMetrics
 
     using ResamplingValue = std::conditional_t<ResamplingControl::kIsConst, const gr::Size_t, gr::Size_t>;
     using ResamplingLimit = Limits<1UL, std::numeric_limits<ResamplingValue>::max()>;
@@ -778,6 +849,7 @@ public:
         {block::property::kSettingsContexts, std::mem_fn(&Block::propertyCallbackSettingsContexts)}, //
         {block::property::kMetaInformation, std::mem_fn(&Block::propertyCallbackMetaInformation)},   //
         {block::property::kUiConstraints, std::mem_fn(&Block::propertyCallbackUiConstraints)},       //
+        {block::property::kMetrics, std::mem_fn(&Block::propertyCallbackMetrics)},                   //
     };
     std::map<std::string, std::set<std::string>> propertySubscriptions;
 
@@ -879,6 +951,11 @@ public:
         traits::block::all_input_ports<Derived>::for_each(setPortName);
         traits::block::all_output_ports<Derived>::for_each(setPortName);
 
+        if constexpr (passThrough) { // N.B. ports reached their final location -> safe to link the forwarding output to its input
+            static_assert(traits::block::stream_input_ports<Derived>::size == 1 && traits::block::stream_output_ports<Derived>::size == 1, "PassThrough<> blocks must have exactly one stream input and one stream output port");
+            outputPort<PassThroughControl::kOutputPort>(&self()).setPassThroughSource(inputPort<PassThroughControl::kInputPort>(&self()));
+        }
+
         settings().init();
 
         // important: these tags need to be queued because at this stage the block is not yet connected to other downstream blocks
@@ -909,6 +986,45 @@ public:
     void setSettings(const CtxSettings<Derived>& settings) { _settings.assignFrom(settings); }
     void setSettings(CtxSettings<Derived>&& settings) { _settings.assignFrom(std::move(settings)); }
 
+    /**
+     * @brief snapshot of the 'workMetrics' counters and the present fill level of the buffers attached to the connected stream ports
+     * (N.B. output fill level is w.r.t. the slowest downstream reader, i.e. high values indicate back-pressure from downstream)
+     */
+    [[nodiscard]] property_map runtimeMetrics() {
+        using namespace std::string_literals;
+        property_map           result = workMetrics.toPropertyMap();
+        std::vector<pmtv::pmt> ports;
+        auto                   addPort = [&ports]<gr::PortLike TPort>(TPort& port) {
+            if (!port.isConnected()) {
+                return;
+            }
+            const std::size_t bufferSize = port.bufferSize();
+            const std::size_t available  = std::min(port.available(), bufferSize);
+            const std::size_t fillLevel  = TPort::kDirection == PortDirection::INPUT ? available : bufferSize - available;
+            ports.emplace_back(property_map{{"name"s, std::string(port.name)}, {"direction"s, std::string(magic_enum::enum_name(TPort::kDirection))}, //
+                {"bufferSize"s, static_cast<std::uint64_t>(bufferSize)}, {"fillLevel"s, static_cast<std::uint64_t>(fillLevel)}});
+        };
+        for_each_port(addPort, inputPorts<PortType::STREAM>(&self()));
+        for_each_port(addPort, outputPorts<PortType::STREAM>(&self()));
+        result.insert_or_assign("ports"s, std::move(ports));
+        return result;
+    }
+
+    /**
+     * @brief touches all pages of the output port buffers (the input buffers are owned by the upstream blocks) and of the
+     * block-internal state if 'Derived' provides a 'std::size_t prefault()' hook (e.g. for HistoryBuffers), so that these
+     * page faults do not occur on the first 'work()' call. N.B. not thread-safe w.r.t. a concurrently running 'work()'.
+     * @return number of touched pages
+     */
+    std::size_t prefaultBuffers() noexcept {
+        std::size_t nPages = 0UZ;
+        for_each_port([&nPages]<gr::PortLike TPort>(TPort& port) { nPages += port.prefaultBuffer(); }, outputPorts<PortType::STREAM>(&self()));
+        if constexpr (requires(Derived& d) { { d.prefault() } -> std::convertible_to<std::size_t>; }) {
+            nPages += self().prefault();
+        }
+        return nPages;
+    }
+
     template<std::size_t Index, typename Self>
     friend constexpr auto& inputPort(Self* self) noexcept;
 
@@ -1585,6 +1701,30 @@ protected:
         throw gr::exception(std::format("block {} property {} does not implement command {}, msg: {}", unique_name, propertyName, message.cmd, message));
     }
 
+    std::optional<Message> propertyCallbackMetrics(std::string_view propertyName, Message message) {
+        using enum gr::message::Command;
+        assert(propertyName == block::property::kMetrics);
+
+        if (message.cmd == Set) { // any 'Set' resets the counters
+            workMetrics.reset();
+            message.data = runtimeMetrics();
+            return message;
+        } else if (message.cmd == Get) {
+            message.data = runtimeMetrics();
+            return message;
+        } else if (message.cmd == Subscribe) {
+            if (!message.clientRequestID.empty()) {
+                propertySubscriptions[std::string(propertyName)].insert(message.clientRequestID);
+            }
+            return std::nullopt;
+        } else if (message.cmd == Unsubscribe) {
+            propertySubscriptions[std::string(propertyName)].erase(message.clientRequestID);
+            return std::nullopt;
+        }
+
+        throw gr::exception(std::format("block {} property {} does not implement command {}, msg: {}", unique_name, propertyName, message.cmd, message));
+    }
+
     std::optional<Message> propertyCallbackUiConstraints(std::string_view propertyName, Message message) {
         using enum gr::message::Command;
         assert(propertyName == block::property::kUiConstraints);
@@ -1927,6 +2067,40 @@ protected:
         }
     }
 
+    [[nodiscard]] bool isForwardingAliasedOnly() noexcept
+    requires(passThrough)
+    {
+        const auto& out = outputPort<PassThroughControl::kOutputPort>(&self());
+        return out.nAliasedReaders() > 0UZ && out.nReaders() == 0UZ;
+    }
+
+    /**
+     * forwards 'nSamples' of a 'PassThrough<>' block whose output readers are all aliased onto the upstream buffer: consuming the
+     * input advances the aliased readers' gate, tags stay in the upstream tag buffer -- nothing is copied or published.
+     */
+    work::Result forwardAliasedPassThrough(std::size_t requestedWork, std::size_t nSamples)
+    requires(passThrough)
+    {
+        {
+            auto inputSpans = prepareStreams(inputPorts<PortType::STREAM>(&self()), nSamples);
+            updateMergedInputTagAndApplySettings(inputSpans, nSamples);
+            applyChangedSettings();
+            if (!consumeReaders(nSamples, inputSpans)) {
+                return {requestedWork, 0UZ, work::Status::ERROR};
+            }
+        } // N.B. samples are consumed -- i.e. become visible to the aliased readers -- once the input spans go out of scope
+        _mergedInputTag.map.clear();
+
+        if (nSamples > 0UZ) {
+            progress->incrementAndGet();
+        }
+        if constexpr (blockingIO) {
+            progress->notify_all();
+        }
+        workMetrics.recordSamples(nSamples, nSamples);
+        return {requestedWork, nSamples, work::Status::OK};
+    }
+
     /**
      * Central function managing the dispatch of work to the block implementation provided work implementation
      * @brief
@@ -2031,6 +2205,12 @@ protected:
             return {requestedWork, 0UZ, resampledStatus};
         }
 
+        if constexpr (passThrough) {
+            if (isForwardingAliasedOnly()) { // zero-copy: all downstream readers alias the upstream buffer
+                return forwardAliasedPassThrough(requestedWork, resampledIn);
+            }
+        }
+
         // for non-bulk processing, the processed span has to be limited to the first sample if it contains a tag s.t. the tag is not applied to every sample
         const bool limitByFirstTag = (!HasProcessBulkFunction<Derived> && HasProcessOneFunction<Derived>) && hasTag;
 
@@ -2050,6 +2230,7 @@ protected:
         publishCachedOutputTags(outputSpans);
         publishMergedInputTag(outputSpans);
 
+        const auto processingStart = std::chrono::steady_clock::now();
         if constexpr (HasProcessBulkFunction<Derived>) {
             invokeUserProvidedFunction("invokeProcessBulk", [&userReturnStatus, &inputSpans, &outputSpans, this] noexcept(HasNoexceptProcessBulkFunction<Derived>) { userReturnStatus = invokeProcessBulk(inputSpans, outputSpans); });
 
@@ -2109,6 +2290,7 @@ protected:
         } else { // block does not define any valid processing function
             meta::print_types<meta::message_type<"neither processBulk(...) nor processOne(...) implemented for:">, Derived>{};
         }
+        workMetrics.recordProcessingTime(std::chrono::steady_clock::now() - processingStart);
 
         // sanitise input/output samples based on explicit user-defined processBulk(...) return status
         if (userReturnStatus == INSUFFICIENT_OUTPUT_ITEMS || userReturnStatus == INSUFFICIENT_INPUT_ITEMS || userReturnStatus == ERROR) {
@@ -2177,6 +2359,7 @@ protected:
                 progress->notify_all();
             }
         }
+        workMetrics.recordSamples(processedIn, processedOut);
         return {requestedWork, performedWork, userReturnStatus};
     } // end: work::Result workInternal(std::size_t requestedWork) { ... }
 
@@ -2195,16 +2378,21 @@ public:
         if constexpr (Derived::blockCategory != block::Category::NormalBlock) {
             return {requestedWork, 0UZ, gr::work::Status::OK};
         } else {
-            return workInternal(requestedWork);
+            const auto         workStart = std::chrono::steady_clock::now();
+            const work::Result result    = workInternal(requestedWork);
+            workMetrics.recordWork(result.status, std::chrono::steady_clock::now() - workStart);
+            return result;
         }
     }
 
     work::Status invokeWork()
     requires(blockingIO && Derived::blockCategory == block::Category::NormalBlock)
     {
+        const auto workStart                          = std::chrono::steady_clock::now();
         auto [work_requested, work_done, last_status] = workInternal(std::atomic_load_explicit(&ioRequestedWork, std::memory_order_acquire));
         ioWorkDone.increment(work_requested, work_done);
         ioLastWorkStatus.exchange(last_status, std::memory_order_relaxed);
+        workMetrics.recordWork(last_status, std::chrono::steady_clock::now() - workStart);
         return last_status;
     }
 
@@ -449,6 +449,17 @@ public:
 
     [[nodiscard]] virtual UICategory uiCategory() const { return UICategory::None; }
 
+    /**
+     * @brief snapshot of the block's runtime statistics (work() calls, samples in/out, processing time, status histogram, port buffer fill levels)
+     * @see block::property::kMetrics
+     */
+    [[nodiscard]] virtual property_map runtimeMetrics() { return {}; }
+
+    /**
+     * @brief touches all pages of the block's output buffers (and internal state, if supported) upfront, @return number of touched pages
+     */
+    virtual std::size_t prefaultBuffers() { return 0UZ; }
+
     // port and sample information
     /**
      * @brief returns the input_chunk_size to output_chunk_size ratio for the block
@@ -810,6 +821,10 @@ public:
 
     [[nodiscard]] UICategory uiCategory() const override { return T::DrawableControl::kCategory; }
 
+    [[nodiscard]] property_map runtimeMetrics() override { return blockRef().runtimeMetrics(); }
+
+    std::size_t prefaultBuffers() override { return blockRef().prefaultBuffers(); }
+
     [[nodiscard]] gr::Ratio  resamplingRatio() const noexcept override { return {static_cast<std::int32_t>(blockRef().input_chunk_size), static_cast<std::int32_t>(blockRef().output_chunk_size)}; }
     [[nodiscard]] gr::Size_t stride() const noexcept override { return blockRef().stride; }
 
@@ -0,0 +1,170 @@
+#ifndef GNURADIO_BOTTLENECK_ANALYSER_HPP
+#define GNURADIO_BOTTLENECK_ANALYSER_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gnuradio-4.0/HistoryBuffer.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+namespace gr::metrics {
+
+/**
+ * @brief per-block summary of the BottleneckAnalyser over its sampling window
+ */
+struct BlockLoad {
+    std::string   name;
+    double        inputFill           = 0.0; ///< mean fill ratio [0, 1] of the fullest input buffer (sources: 1, i.e. never starved)
+    double        outputFill          = 0.0; ///< mean fill ratio [0, 1] of the fullest output buffer (sinks: 0, i.e. never back-pressured)
+    double        score               = 0.0; ///< inputFill * (1 - outputFill) -> 1: inputs full & outputs empty = the block limits the throughput
+    double        processingShare     = 0.0; ///< fraction of the total processBulk/processOne time spent in this block within the window
+    std::uint64_t nWorkCalls          = 0U;  ///< work() calls within the window
+    std::uint64_t nInsufficientInput  = 0U;  ///< INSUFFICIENT_INPUT_ITEMS returns within the window (starved)
+    std::uint64_t nInsufficientOutput = 0U;  ///< INSUFFICIENT_OUTPUT_ITEMS returns within the window (back-pressure)
+};
+
+/**
+ * @brief identifies the throughput-limiting block ('bottleneck') of a running graph from periodic samples of the per-block runtime metrics.
+ *
+ * The buffer fill levels are the most direct observable: upstream of the bottleneck the buffers fill up (back-pressure),
+ * downstream of it they run empty (starvation). Hence, the block whose inputs are full and whose outputs are empty
+ * maximises 'score = inputFill * (1 - outputFill)'. Sources count as having full inputs and sinks as having empty outputs,
+ * so that a slow source or slow sink is identified the same way. Single samples are noisy (bursty schedulers), thus the
+ * fill levels are averaged over a sliding window of 'windowSize' samples.
+ *
+ * Input are snapshots as returned by the scheduler's 'blockMetrics()' (@see scheduler::property::kBlockMetrics).
+ * This class is not thread-safe, the owner needs to serialise 'sample(..)' and 'analyse()'.
+ */
+class BottleneckAnalyser {
+    struct Snapshot {
+        double        inputFill           = 0.0;
+        double        outputFill          = 0.0;
+        std::uint64_t processingTimeNs    = 0U;
+        std::uint64_t nWorkCalls          = 0U;
+        std::uint64_t nInsufficientInput  = 0U;
+        std::uint64_t nInsufficientOutput = 0U;
+    };
+
+    std::size_t                                    _windowSize;
+    std::size_t                                    _nSamples = 0UZ;
+    std::map<std::string, HistoryBuffer<Snapshot>> _history;
+
+    template<typename T>
+    [[nodiscard]] static T valueOr(const property_map& map, const std::string& key, T defaultValue = T{}) {
+        const auto it = map.find(key);
+        if (it == map.end()) {
+            return defaultValue;
+        }
+        const T* value = std::get_if<T>(&it->second);
+        return value != nullptr ? *value : defaultValue;
+    }
+
+    [[nodiscard]] static Snapshot toSnapshot(const property_map& metrics) {
+        const auto status   = valueOr<property_map>(metrics, "status");
+        Snapshot   snapshot{.processingTimeNs = valueOr<std::uint64_t>(metrics, "processingTimeNs"), .nWorkCalls = valueOr<std::uint64_t>(metrics, "nWorkCalls"), //
+              .nInsufficientInput = valueOr<std::uint64_t>(status, "INSUFFICIENT_INPUT_ITEMS"), .nInsufficientOutput = valueOr<std::uint64_t>(status, "INSUFFICIENT_OUTPUT_ITEMS")};
+
+        bool hasInput  = false;
+        bool hasOutput = false;
+        for (const auto& portValue : valueOr<std::vector<pmtv::pmt>>(metrics, "ports")) {
+            const auto* port = std::get_if<property_map>(&portValue);
+            if (port == nullptr) {
+                continue;
+            }
+            const auto   bufferSize = valueOr<std::uint64_t>(*port, "bufferSize");
+            const double fill       = bufferSize > 0U ? static_cast<double>(valueOr<std::uint64_t>(*port, "fillLevel")) / static_cast<double>(bufferSize) : 0.0;
+            if (valueOr<std::string>(*port, "direction") == "INPUT") {
+                snapshot.inputFill = hasInput ? std::max(snapshot.inputFill, fill) : fill;
+                hasInput           = true;
+            } else {
+                snapshot.outputFill = hasOutput ? std::max(snapshot.outputFill, fill) : fill;
+                hasOutput           = true;
+            }
+        }
+        if (!hasInput) {
+            snapshot.inputFill = 1.0; // source: never starved
+        }
+        return snapshot;
+    }
+
+public:
+    explicit BottleneckAnalyser(std::size_t windowSize = 64UZ) : _windowSize(std::max(windowSize, 2UZ)) {}
+
+    [[nodiscard]] std::size_t windowSize() const noexcept { return _windowSize; }
+    [[nodiscard]] std::size_t nSamples() const noexcept { return _nSamples; }
+
+    void reset() {
+        _history.clear();
+        _nSamples = 0UZ;
+    }
+
+    /// @param blockMetrics map: block unique name -> runtime metrics (@see BlockModel::runtimeMetrics())
+    void sample(const property_map& blockMetrics) {
+        std::erase_if(_history, [&blockMetrics](const auto& entry) { return !blockMetrics.contains(entry.first); }); // removed blocks
+        for (const auto& [blockName, value] : blockMetrics) {
+            const auto* metrics = std::get_if<property_map>(&value);
+            if (metrics == nullptr) {
+                continue;
+            }
+            auto [it, _] = _history.try_emplace(blockName, _windowSize);
+            it->second.push_back(toSnapshot(*metrics));
+        }
+        _nSamples++;
+    }
+
+    /// @return per-block load summary sorted by descending 'score', i.e. the first entry is the most likely bottleneck
+    [[nodiscard]] std::vector<BlockLoad> analyse() const {
+        std::vector<BlockLoad> result;
+        result.reserve(_history.size());
+        std::uint64_t totalProcessingNs = 0U;
+        for (const auto& [blockName, history] : _history) {
+            if (history.empty()) {
+                continue;
+            }
+            BlockLoad load{.name = blockName};
+            for (std::size_t i = 0UZ; i < history.size(); ++i) {
+                load.inputFill += history[i].inputFill;
+                load.outputFill += history[i].outputFill;
+            }
+            load.inputFill /= static_cast<double>(history.size());
+            load.outputFill /= static_cast<double>(history.size());
+            load.score = load.inputFill * (1.0 - load.outputFill);
+
+            const Snapshot& oldest   = history.front();
+            const Snapshot& newest   = history.back();
+            load.nWorkCalls          = newest.nWorkCalls - std::min(oldest.nWorkCalls, newest.nWorkCalls); // N.B. guards against intermediate counter resets
+            load.nInsufficientInput  = newest.nInsufficientInput - std::min(oldest.nInsufficientInput, newest.nInsufficientInput);
+            load.nInsufficientOutput = newest.nInsufficientOutput - std::min(oldest.nInsufficientOutput, newest.nInsufficientOutput);
+            const std::uint64_t processingNs = newest.processingTimeNs - std::min(oldest.processingTimeNs, newest.processingTimeNs);
+            load.processingShare             = static_cast<double>(processingNs); // normalised below
+            totalProcessingNs += processingNs;
+            result.push_back(std::move(load));
+        }
+
+        for (auto& load : result) {
+            load.processingShare = totalProcessingNs > 0U ? load.processingShare / static_cast<double>(totalProcessingNs) : 0.0;
+        }
+        std::ranges::sort(result, [](const BlockLoad& lhs, const BlockLoad& rhs) { // ties (e.g. all buffers empty/full) are resolved by the time spent in processing
+            return lhs.score != rhs.score ? lhs.score > rhs.score : lhs.processingShare > rhs.processingShare;
+        });
+        return result;
+    }
+
+    [[nodiscard]] property_map toPropertyMap() const {
+        using namespace std::string_literals;
+        const std::vector<BlockLoad> loads = analyse();
+        property_map                 blocks;
+        for (const BlockLoad& load : loads) {
+            blocks.insert_or_assign(load.name, property_map{{"inputFill"s, load.inputFill}, {"outputFill"s, load.outputFill}, {"score"s, load.score}, {"processingShare"s, load.processingShare}, //
+                                                   {"nWorkCalls"s, load.nWorkCalls}, {"nInsufficientInput"s, load.nInsufficientInput}, {"nInsufficientOutput"s, load.nInsufficientOutput}});
+        }
+        return {{"bottleneck"s, loads.empty() ? std::string() : loads.front().name}, {"nSamples"s, static_cast<std::uint64_t>(_nSamples)}, {"blocks"s, std::move(blocks)}};
+    }
+};
+
+} // namespace gr::metrics
+
+#endif // GNURADIO_BOTTLENECK_ANALYSER_HPP
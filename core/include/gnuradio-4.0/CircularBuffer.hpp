@@ -57,6 +57,7 @@ static constexpr bool has_posix_mmap_interface = false;
 #include "ClaimStrategy.hpp"
 #include "Sequence.hpp"
 #include "WaitStrategy.hpp"
+#include "thread/MemoryPrefault.hpp"
 
 namespace gr {
 
@@ -427,6 +428,16 @@ class CircularBuffer {
             return *this;
         }
 
+        friend void swap(Writer& lhs, Writer& rhs) noexcept { // N.B. exchanges the buffer registrations as-is (writer counts unaffected)
+            std::swap(lhs._buffer, rhs._buffer);
+            std::swap(lhs._nRequestedSamplesToPublish, rhs._nRequestedSamplesToPublish);
+            std::swap(lhs._isPublishRequested, rhs._isPublishRequested);
+            std::swap(lhs._index, rhs._index);
+            std::swap(lhs._offset, rhs._offset);
+            std::swap(lhs._internalSpan, rhs._internalSpan);
+            std::swap(lhs._instanceCount, rhs._instanceCount);
+        }
+
         ~Writer() {
             if (_buffer) {
                 _buffer->_writer_count.fetch_sub(1UZ, std::memory_order_relaxed);
@@ -627,6 +638,7 @@ class CircularBuffer {
         std::shared_ptr<Sequence> _readIndex = std::make_shared<Sequence>();
         std::size_t               _readIndexCached;
         BufferTypeLocal           _buffer;                                                    // controls buffer life-cycle, the rest are cache optimisations
+        std::shared_ptr<Sequence> _gate{};                                                    // optional: limits the readable range to below the gate's value (aliased pass-through readers)
         std::size_t               _nSamplesFirstGet{std::numeric_limits<std::size_t>::max()}; // Maximum number of samples returned by the first call to get() (when reader is consumed). Subsequent calls to get(), without calling consume() again, will return up to _nSamplesFirstGet.
         std::size_t               _instanceCount{0UZ};                                        // number of ReaderSpan instances
 
@@ -648,10 +660,32 @@ class CircularBuffer {
             _readIndexCached = _readIndex->value();
         }
 
+        /**
+         * @brief gated reader: registers like a regular reader (i.e. back-pressures the writers of this buffer) but only samples below
+         * the 'gate' value are readable. Used to alias a downstream reader onto the buffer upstream of a pass-through block, with the
+         * gate being the read sequence of the pass-through block's input, i.e. samples become readable once they have been forwarded.
+         * N.B. the reader starts at min(publish cursor, gate), i.e. receives all samples forwarded after it has been created.
+         */
+        Reader(std::shared_ptr<BufferImpl> buffer, std::shared_ptr<Sequence> gate) noexcept : Reader(std::move(buffer), gate, gate ? gate->value() : std::numeric_limits<std::size_t>::max()) {}
+
+        /**
+         * @brief (optionally gated) reader starting at min(publish cursor, 'startPosition') rather than at the publish cursor.
+         * N.B. 'startPosition' must not be behind the position of another reader of this buffer, as the writers may already have
+         * overwritten older samples -- e.g. the position of the pass-through block's input reader whose output is aliased.
+         */
+        Reader(std::shared_ptr<BufferImpl> buffer, std::shared_ptr<Sequence> gate, std::size_t startPosition) noexcept : Reader(std::move(buffer)) {
+            _gate = std::move(gate);
+            if (startPosition < _readIndexCached) {
+                _readIndex->setValue(startPosition);
+                _readIndexCached = _readIndex->value();
+            }
+        }
+
         Reader(Reader&& other) noexcept
             : _readIndex(std::move(other._readIndex)),                                      //
               _readIndexCached(std::exchange(other._readIndexCached, _readIndex->value())), //
               _buffer(other._buffer),                                                       //
+              _gate(other._gate),                                                           //
               _nSamplesFirstGet(other._nSamplesFirstGet),                                   //
               _instanceCount(other._instanceCount),                                         //
               _nRequestedSamplesToConsume(other._nRequestedSamplesToConsume),               //
@@ -661,12 +695,25 @@ class CircularBuffer {
             std::swap(_readIndex, tmp._readIndex);
             std::swap(_readIndexCached, tmp._readIndexCached);
             std::swap(_buffer, tmp._buffer);
+            std::swap(_gate, tmp._gate);
             std::swap(_nSamplesFirstGet, tmp._nSamplesFirstGet);
             std::swap(_instanceCount, tmp._instanceCount);
             std::swap(_nRequestedSamplesToConsume, tmp._nRequestedSamplesToConsume);
             std::swap(_nSamplesConsumed, tmp._nSamplesConsumed);
             return *this;
         };
+
+        friend void swap(Reader& lhs, Reader& rhs) noexcept { // N.B. exchanges the buffer registrations as-is (reader counts and read sequences unaffected)
+            std::swap(lhs._readIndex, rhs._readIndex);
+            std::swap(lhs._readIndexCached, rhs._readIndexCached);
+            std::swap(lhs._buffer, rhs._buffer);
+            std::swap(lhs._gate, rhs._gate);
+            std::swap(lhs._nSamplesFirstGet, rhs._nSamplesFirstGet);
+            std::swap(lhs._instanceCount, rhs._instanceCount);
+            std::swap(lhs._nRequestedSamplesToConsume, rhs._nRequestedSamplesToConsume);
+            std::swap(lhs._nSamplesConsumed, rhs._nSamplesConsumed);
+        }
+
         ~Reader() {
             gr::detail::removeSequence(_buffer->_claimStrategy._readSequences, _readIndex);
             _buffer->_reader_count.fetch_sub(1UZ, std::memory_order_relaxed);
@@ -700,7 +747,16 @@ class CircularBuffer {
 
         [[nodiscard]] constexpr std::size_t position() const noexcept { return _readIndexCached; }
 
-        [[nodiscard]] constexpr std::size_t available() const noexcept { return _buffer->_claimStrategy._publishCursor.value() - _readIndexCached; }
+        [[nodiscard]] constexpr bool                             isGated() const noexcept { return _gate != nullptr; }
+        [[nodiscard]] constexpr const std::shared_ptr<Sequence>& readSequence() const noexcept { return _readIndex; }
+
+        [[nodiscard]] constexpr std::size_t available() const noexcept {
+            if (_gate) [[unlikely]] { // N.B. gate <= publish cursor by construction, the gated reader may however have been created ahead of it
+                const std::size_t gate = _gate->value();
+                return gate > _readIndexCached ? gate - _readIndexCached : 0UZ;
+            }
+            return _buffer->_claimStrategy._publishCursor.value() - _readIndexCached;
+        }
     }; // class Reader
     // static_assert(BufferReaderLike<Reader<T>>);
 
@@ -723,6 +779,8 @@ public:
     [[nodiscard]] std::size_t           size() const noexcept { return _sharedBufferPtr->_size; }
     [[nodiscard]] BufferWriterLike auto new_writer() { return Writer<T>(_sharedBufferPtr); }
     [[nodiscard]] BufferReaderLike auto new_reader() { return Reader<T>(_sharedBufferPtr); }
+    [[nodiscard]] BufferReaderLike auto new_reader(std::shared_ptr<Sequence> gate) { return Reader<T>(_sharedBufferPtr, std::move(gate)); }
+    [[nodiscard]] BufferReaderLike auto new_reader(std::shared_ptr<Sequence> gate, std::size_t startPosition) { return Reader<T>(_sharedBufferPtr, std::move(gate), startPosition); }
 
     // implementation specific interface -- not part of public Buffer / production-code API
     [[nodiscard]] std::size_t n_writers() const { return _sharedBufferPtr->_writer_count.load(std::memory_order_relaxed); }
@@ -730,6 +788,17 @@ public:
     [[nodiscard]] const auto& claim_strategy() { return _sharedBufferPtr->_claimStrategy; }
     [[nodiscard]] const auto& wait_strategy() { return _sharedBufferPtr->_claimStrategy._wait_strategy; }
     [[nodiscard]] const auto& cursor_sequence() { return _sharedBufferPtr->_claimStrategy._publishCursor; }
+
+    /// touches all pages (incl. the double-mapped second half) upfront, N.B. not thread-safe w.r.t. concurrent writers, @see gr::memory::prefault(..)
+    std::size_t prefault() noexcept {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            BufferImpl&       impl   = *_sharedBufferPtr;
+            const std::size_t nItems = impl._isMmapAllocated ? 2UZ * impl._size : impl._data.size();
+            return memory::prefault(static_cast<void*>(impl._data.data()), nItems * sizeof(T));
+        } else {
+            return 0UZ; // non-trivial types are constructed, i.e. touched, on allocation
+        }
+    }
 };
 static_assert(BufferLike<CircularBuffer<int32_t>>);
 
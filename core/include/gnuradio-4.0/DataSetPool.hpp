@@ -0,0 +1,186 @@
+#ifndef GNURADIO_DATASET_POOL_HPP
+#define GNURADIO_DATASET_POOL_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <span>
+#include <utility>
+
+#include <gnuradio-4.0/DataSet.hpp>
+
+namespace gr {
+
+/**
+ * @brief thread-safe free-list of 'DataSet<T>' objects that retains the (heap-)storage of released DataSets for re-use.
+ *
+ * Producers (e.g. StreamToDataSet, FFT, DataSink trigger windows) 'acquire(..)' a DataSet that is reset and pre-sized
+ * for the requested extents, while consumers hand back DataSets they no longer need via 'release(..)'. The latter is
+ * typically done implicitly by swapping a new DataSet into an already consumed (port or poller) buffer slot and
+ * releasing the old slot content, rather than move-assigning (and thus freeing) it.
+ *
+ * Pooled DataSets are keyed by their 'signal_values' capacity so that 'acquire(..)' returns the smallest DataSet that
+ * fits without re-allocation. The number of pooled objects is capped by 'maxPooled' (excess DataSets are freed).
+ *
+ * usage:
+ * @code
+ * auto& pool = gr::globalDataSetPool<float>();
+ * gr::DataSet<float> ds = pool.acquire({1024}, 2UZ); // 1D, 1024 samples, 2 signals -> no allocation once warmed-up
+ * // ... fill ds and hand it on, eventually:
+ * pool.release(std::move(ds));
+ * @endcode
+ */
+template<typename T>
+class DataSetPool {
+    mutable std::mutex                     _mutex;
+    std::multimap<std::size_t, DataSet<T>> _free; // signal_values capacity -> DataSet
+    std::size_t                            _maxPooled;
+    std::size_t                            _nAcquired = 0UZ;
+    std::size_t                            _nRecycled = 0UZ;
+
+public:
+    static constexpr std::size_t kDefaultMaxPooled = 64UZ;
+
+    explicit DataSetPool(std::size_t maxPooled = kDefaultMaxPooled) : _maxPooled(maxPooled) {}
+    DataSetPool(const DataSetPool&)            = delete;
+    DataSetPool& operator=(const DataSetPool&) = delete;
+
+    /**
+     * @return a DataSet with 'extents' set, 'axis_values' sized to the number of dimensions, 'meta_information' and
+     * 'timing_events' sized to 'nSignals' (all elements empty) and all remaining vectors empty but with their capacity reserved.
+     */
+    [[nodiscard]] DataSet<T> acquire(std::span<const std::int32_t> extents, std::size_t nSignals = 1UZ) {
+        const std::size_t nSamples = std::accumulate(extents.begin(), extents.end(), 1UZ, [](std::size_t acc, std::int32_t e) { return acc * static_cast<std::size_t>(std::max(e, 0)); });
+        DataSet<T>        ds       = take(nSamples * nSignals);
+
+        ds.extents.assign(extents.begin(), extents.end());
+        ds.axis_values.resize(extents.size());
+        for (std::size_t dim = 0UZ; dim < extents.size(); ++dim) {
+            ds.axis_values[dim].reserve(static_cast<std::size_t>(std::max(extents[dim], 0)));
+        }
+        ds.axis_names.reserve(extents.size());
+        ds.axis_units.reserve(extents.size());
+
+        ds.signal_names.reserve(nSignals);
+        ds.signal_quantities.reserve(nSignals);
+        ds.signal_units.reserve(nSignals);
+        ds.signal_values.reserve(nSamples * nSignals);
+        ds.signal_ranges.reserve(nSignals);
+        ds.meta_information.resize(nSignals);
+        ds.timing_events.resize(nSignals);
+        return ds;
+    }
+
+    [[nodiscard]] DataSet<T> acquire(std::initializer_list<std::int32_t> extents, std::size_t nSignals = 1UZ) { return acquire(std::span<const std::int32_t>(extents.begin(), extents.size()), nSignals); }
+
+    /// returns the DataSet's storage to the pool (the content is discarded)
+    void release(DataSet<T>&& ds) {
+        clear(ds);
+        const std::size_t key = ds.signal_values.capacity();
+        if (key == 0UZ && ds.axis_values.capacity() == 0UZ) {
+            return; // nothing worth keeping (e.g. default-constructed or moved-from slot)
+        }
+        std::lock_guard lock{_mutex};
+        if (_free.size() >= _maxPooled) {
+            auto smallest = _free.begin(); // favour keeping larger storage
+            if (smallest->first >= key) {
+                return;
+            }
+            _free.erase(smallest);
+        }
+        _free.emplace(key, std::move(ds));
+        ++_nRecycled;
+    }
+
+    void setMaxPooled(std::size_t maxPooled) {
+        std::lock_guard lock{_mutex};
+        _maxPooled = maxPooled;
+        while (_free.size() > _maxPooled) {
+            _free.erase(_free.begin());
+        }
+    }
+
+    void shrink() {
+        std::lock_guard lock{_mutex};
+        _free.clear();
+    }
+
+    [[nodiscard]] std::size_t size() const {
+        std::lock_guard lock{_mutex};
+        return _free.size();
+    }
+
+    [[nodiscard]] std::size_t maxPooled() const {
+        std::lock_guard lock{_mutex};
+        return _maxPooled;
+    }
+
+    /// number of 'acquire(..)' calls that were served from the pool, and number of DataSets accepted by 'release(..)'
+    [[nodiscard]] std::pair<std::size_t, std::size_t> statistics() const {
+        std::lock_guard lock{_mutex};
+        return {_nAcquired, _nRecycled};
+    }
+
+    /// resets all fields while retaining the vectors' capacities (N.B. nested vectors of 'axis_values' are kept)
+    static void clear(DataSet<T>& ds) noexcept {
+        ds.default_value = T();
+        ds.timestamp     = 0;
+        ds.axis_names.clear();
+        ds.axis_units.clear();
+        for (auto& axis : ds.axis_values) {
+            axis.clear();
+        }
+        ds.extents.clear();
+        ds.layout = typename DataSet<T>::tensor_layout_type{};
+        ds.signal_names.clear();
+        ds.signal_quantities.clear();
+        ds.signal_units.clear();
+        ds.signal_values.clear();
+        ds.signal_ranges.clear();
+        ds.meta_information.clear();
+        for (auto& events : ds.timing_events) {
+            events.clear();
+        }
+    }
+
+private:
+    DataSet<T> take(std::size_t nValues) {
+        std::lock_guard lock{_mutex};
+        if (_free.empty()) {
+            return {};
+        }
+        auto it = _free.lower_bound(nValues); // smallest DataSet that fits without re-allocation
+        if (it == _free.end()) {
+            it = std::prev(it); // largest available -> grows only once
+        }
+        DataSet<T> ds = std::move(_free.extract(it).mapped());
+        ++_nAcquired;
+        return ds;
+    }
+};
+
+/// process-wide DataSet pool per value type, shared between producers and consumers
+template<typename T>
+__attribute__((visibility("default"))) inline DataSetPool<T>& globalDataSetPool() {
+    static DataSetPool<T> instance;
+    return instance;
+}
+
+/**
+ * @brief moves 'ds' into the (already consumed) buffer 'slot' and returns the slot's previous storage to 'pool'
+ * instead of freeing it.
+ */
+template<typename T>
+inline void publishRecycled(DataSet<T>& slot, DataSet<T>&& ds, DataSetPool<T>& pool = globalDataSetPool<T>()) {
+    using std::swap;
+    swap(slot, ds);
+    pool.release(std::move(ds));
+}
+
+} // namespace gr
+
+#endif // GNURADIO_DATASET_POOL_HPP
@@ -478,21 +478,43 @@ public:
             throw gr::exception(std::format("Can not create block {}", type));
         }
 
+        return replaceBlock(uniqueName, std::move(newBlock));
+    }
+
+    /// replaces the block 'uniqueName' by an already instantiated 'newBlock' and re-targets all its edges (incl. their cached port references) to the equally named ports of 'newBlock'
+    std::pair<std::shared_ptr<BlockModel>, std::shared_ptr<BlockModel>> replaceBlock(const std::string& uniqueName, std::shared_ptr<BlockModel> newBlock) {
+        auto it = std::ranges::find_if(_blocks, [&uniqueName](const auto& block) { return block->uniqueName() == uniqueName; });
+        if (it == _blocks.end()) {
+            throw gr::exception(std::format("Block {} was not found in {}", uniqueName, this->unique_name));
+        }
+
+        std::shared_ptr<BlockModel> oldBlock = *it;
+        _blocks.erase(it);
         addBlock(newBlock);
 
+        const auto counterpart = [](auto&& lookupPort) -> DynamicPort* {
+            try {
+                return std::addressof(lookupPort());
+            } catch (const gr::exception&) {
+                return nullptr; // no equally named port -> edge needs to be reconnected
+            }
+        };
         for (auto& edge : _edges) {
-            if (edge._sourceBlock == *it) {
+            if (edge._sourceBlock == oldBlock) {
                 edge._sourceBlock = newBlock;
+                if (edge._sourcePort != nullptr) {
+                    edge._sourcePort = counterpart([&] -> DynamicPort& { return newBlock->dynamicOutputPort(edge._sourcePortDefinition); });
+                }
             }
 
-            if (edge._destinationBlock == *it) {
+            if (edge._destinationBlock == oldBlock) {
                 edge._destinationBlock = newBlock;
+                if (edge._destinationPort != nullptr) {
+                    edge._destinationPort = counterpart([&] -> DynamicPort& { return newBlock->dynamicInputPort(edge._destinationPortDefinition); });
+                }
             }
         }
 
-        std::shared_ptr<BlockModel> oldBlock = std::move(*it);
-        _blocks.erase(it);
-
         return {std::move(oldBlock), newBlock};
     }
 
@@ -685,6 +707,7 @@ public:
                 if (minBufferSize != undefined_size) {
                     maxSize = std::max(maxSize, e.minBufferSize());
                 }
+                maxSize = std::max(maxSize, aliasedMinBufferSize(e, _edges.size()));
             }
         });
         // assert(maxSize != 0UZ);
@@ -692,6 +715,36 @@ public:
         return maxSize;
     }
 
+    /**
+     * @brief buffer size demanded by the edges that will be aliased onto the buffer of 'refEdge' -- i.e. the not yet connected edges
+     * of the pass-through output forwarding the destination of 'refEdge', recursively for pass-through chains (@see gr::PassThrough).
+     * Their readers share the upstream buffer, which hence needs to satisfy their 'minBufferSize' and their input's 'min_samples'.
+     */
+    std::size_t aliasedMinBufferSize(const Edge& refEdge, std::size_t maxDepth) const {
+        std::size_t maxSize = 0UZ;
+        if (maxDepth == 0UZ) { // N.B. guards against pass-through-only cycles, which are never aliased
+            return maxSize;
+        }
+        for (const Edge& e : _edges) {
+            if (e._sourceBlock != refEdge._destinationBlock || e._state != Edge::EdgeState::WaitingToBeConnected) {
+                continue;
+            }
+            try {
+                if (!e._sourceBlock->dynamicOutputPort(e._sourcePortDefinition).isPassThroughPending()) {
+                    continue;
+                }
+                if (e.minBufferSize() != undefined_size) {
+                    maxSize = std::max(maxSize, e.minBufferSize());
+                }
+                maxSize = std::max(maxSize, e._destinationBlock->dynamicInputPort(e._destinationPortDefinition).min_samples);
+                maxSize = std::max(maxSize, aliasedMinBufferSize(e, maxDepth - 1UZ));
+            } catch (...) {
+                continue; // reported by applyEdgeConnection(..)
+            }
+        }
+        return maxSize;
+    }
+
     void disconnectAllEdges() {
         for (auto& block : _blocks) {
             block->initDynamicPorts();
@@ -718,14 +771,36 @@ public:
 
     bool connectPendingEdges() {
         bool allConnected = true;
-        for (auto& edge : _edges) {
-            if (edge.state() == Edge::EdgeState::WaitingToBeConnected) {
-                applyEdgeConnection(edge);
-                const bool wasConnected = edge.state() == Edge::EdgeState::Connected;
-                if (!wasConnected) {
-                    std::print("Edge could not be connected {}\n", edge);
+        auto connectEdge  = [this, &allConnected](Edge& edge) {
+            applyEdgeConnection(edge);
+            const bool wasConnected = edge.state() == Edge::EdgeState::Connected;
+            if (!wasConnected) {
+                std::print("Edge could not be connected {}\n", edge);
+            }
+            allConnected = allConnected && wasConnected;
+        };
+        // pass-through outputs alias the buffer upstream of their forwarded input -> defer their edges until that input is connected
+        auto isDeferred = [](const Edge& edge) {
+            try {
+                return edge._sourceBlock->dynamicOutputPort(edge._sourcePortDefinition).isPassThroughPending();
+            } catch (...) {
+                return false; // reported by applyEdgeConnection(..)
+            }
+        };
+
+        bool progress = true;
+        while (progress) { // resolves (multi-hop) pass-through chains one hop per iteration
+            progress = false;
+            for (auto& edge : _edges) {
+                if (edge.state() == Edge::EdgeState::WaitingToBeConnected && !isDeferred(edge)) {
+                    connectEdge(edge);
+                    progress = true;
                 }
-                allConnected = allConnected && wasConnected;
+            }
+        }
+        for (auto& edge : _edges) { // forwarded input remains unconnected -> regular, i.e. copying, connection
+            if (edge.state() == Edge::EdgeState::WaitingToBeConnected) {
+                connectEdge(edge);
             }
         }
         return allConnected;
@@ -2,7 +2,9 @@
 #define GNURADIO_GRAPH_YAML_IMPORTER_H
 
 #include <ranges>
+#include <span>
 
+#include <gnuradio-4.0/BinaryPmt.hpp>
 #include <gnuradio-4.0/YamlPmt.hpp>
 
 #include "BlockModel.hpp"
@@ -292,7 +294,22 @@ inline gr::property_map saveGraphToMap(PluginLoader& loader, const gr::Graph& ro
 
 } // namespace detail
 
+inline gr::Graph loadGrc(PluginLoader& loader, std::span<const std::uint8_t> binarySrc, std::source_location location = std::source_location::current()) {
+    Graph      resultGraph;
+    const auto map = pmtv::binary::deserialize(binarySrc);
+    if (!map) {
+        throw gr::exception(std::format("Could not decode binary graph: {} at byte {}", map.error().message, map.error().offset));
+    }
+
+    detail::loadGraphFromMap(loader, resultGraph, *map, location);
+    return resultGraph;
+}
+
+/// N.B. also accepts the binary encoding (see 'saveGrcBinary(..)') if passed as a string
 inline gr::Graph loadGrc(PluginLoader& loader, std::string_view yamlSrc, std::source_location location = std::source_location::current()) {
+    if (pmtv::binary::isBinary(yamlSrc)) {
+        return loadGrc(loader, std::span(reinterpret_cast<const std::uint8_t*>(yamlSrc.data()), yamlSrc.size()), location);
+    }
     Graph      resultGraph;
     const auto yaml = pmtv::yaml::deserialize(yamlSrc);
     if (!yaml) {
@@ -305,6 +322,9 @@ inline gr::Graph loadGrc(PluginLoader& loader, std::string_view yamlSrc, std::so
 
 inline std::string saveGrc(PluginLoader& loader, const gr::Graph& rootGraph) { return pmtv::yaml::serialize(detail::saveGraphToMap(loader, rootGraph)); }
 
+/// compact binary alternative to 'saveGrc(..)' for graphs carrying large parameter vectors (e.g. filter taps), see 'BinaryPmt.hpp'
+inline std::vector<std::uint8_t> saveGrcBinary(PluginLoader& loader, const gr::Graph& rootGraph) { return pmtv::binary::serialize(detail::saveGraphToMap(loader, rootGraph)); }
+
 } // namespace gr
 
 #endif // include guard
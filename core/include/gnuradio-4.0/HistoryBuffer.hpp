@@ -13,6 +13,8 @@
 
 #include <format>
 
+#include <gnuradio-4.0/thread/MemoryPrefault.hpp>
+
 namespace gr {
 
 /**
@@ -30,7 +32,7 @@ namespace gr {
  * - `front()`, `back()`: Returns the first/last item in logical order.
  * - `operator[](i)`, `at(i)`: Unchecked/checked access.
  * - `resize(...)` (dynamic-only): Adjust capacity, preserving existing data.
- * - `get_span(...)`: Obtain a contiguous view across wrap boundaries.
+ * - `get_span(...)`, `first(n)`, `last(n)`: Obtain a contiguous view across wrap boundaries.
  *
  * ### Examples
  * \code{.cpp}
@@ -113,13 +115,38 @@ public:
 
     /**
      * @brief Adds a range of elements the end expiring the oldest elements beyond the buffer's capacities.
+     *
+     * Equivalent to calling `push_front(*it)` for each element, i.e. the last element of the range becomes `[0]`.
+     * Random-access ranges are written (reversed) in at most two contiguous segments into both mirrored halves.
      */
     template<std::input_iterator Iter>
     constexpr void push_front(Iter begin, Iter end) noexcept {
-        const auto nSamplesToCopy = std::distance(begin, end);
-        Iter       optimizedBegin = static_cast<std::size_t>(nSamplesToCopy) > _capacity ? std::prev(end, static_cast<std::ptrdiff_t>(_capacity)) : begin;
-        for (auto it = optimizedBegin; it != end; ++it) {
-            push_front(*it);
+        if constexpr (std::random_access_iterator<Iter>) {
+            std::size_t n = static_cast<std::size_t>(std::distance(begin, end));
+            if (n == 0UZ) {
+                return;
+            }
+            if (n > _capacity) { // input range is larger than capacity -> keep only trailing bit
+                begin = std::prev(end, static_cast<std::ptrdiff_t>(_capacity));
+                n     = _capacity;
+            }
+
+            _size           = std::min(_size + n, _capacity);
+            _write_position = _write_position >= n ? _write_position - n : _write_position + _capacity - n;
+
+            const auto        rbegin = std::make_reverse_iterator(end); // newest element first
+            const std::size_t chunk1 = std::min(n, _capacity - _write_position);
+            std::copy_n(rbegin, chunk1, _buffer.data() + _write_position);
+            std::copy_n(rbegin, chunk1, _buffer.data() + _write_position + _capacity);
+
+            if (const std::size_t chunk2 = n - chunk1; chunk2 > 0UZ) { // copy the wrapped-around remainder (if needed)
+                std::copy_n(std::next(rbegin, static_cast<std::ptrdiff_t>(chunk1)), chunk2, _buffer.data());
+                std::copy_n(std::next(rbegin, static_cast<std::ptrdiff_t>(chunk1)), chunk2, _buffer.data() + _capacity);
+            }
+        } else {
+            for (auto it = begin; it != end; ++it) {
+                push_front(*it);
+            }
         }
     }
 
@@ -313,6 +340,15 @@ public:
 
     [[nodiscard]] constexpr const T* data() const noexcept { return _buffer.data(); }
 
+    /// touches all pages of the (double-sized) storage upfront, @see gr::memory::prefault(..)
+    std::size_t prefault() noexcept {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            return memory::prefault(static_cast<void*>(_buffer.data()), _buffer.size() * sizeof(T));
+        } else {
+            return 0UZ;
+        }
+    }
+
     /**
      * @brief Returns a span of elements with given (optional) length with the last element being the newest
      */
@@ -321,6 +357,20 @@ public:
         return std::span<const T>(&_buffer[map_index(index)], length);
     }
 
+    /**
+     * @brief contiguous view of the logical elements [0, count), e.g. the `count` newest samples in `push_front(..)` usage (newest first).
+     * N.B. no index arithmetic or wrap-around handling needed thanks to the mirrored storage, e.g. for FIR dot products or FFT windows
+     */
+    [[nodiscard]] constexpr std::span<const T> first(std::size_t count) const noexcept { return std::span<const T>(_buffer.data() + map_index(0UZ), std::min(count, _size)); }
+
+    /**
+     * @brief contiguous view of the logical elements [size() - count, size()), e.g. the `count` newest samples in `push_back(..)` usage (oldest first).
+     */
+    [[nodiscard]] constexpr std::span<const T> last(std::size_t count) const noexcept {
+        count = std::min(count, _size);
+        return std::span<const T>(_buffer.data() + map_index(_size - count), count);
+    }
+
     [[nodiscard]] auto begin() noexcept { return std::next(_buffer.begin(), static_cast<signed_index_type>(_write_position)); }
 
     constexpr void reset(T defaultValue = T()) {
@@ -0,0 +1,258 @@
+#ifndef GNURADIO_METRICS_EXPORTER_HPP
+#define GNURADIO_METRICS_EXPORTER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <expected>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <gnuradio-4.0/Message.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+
+namespace gr::metrics {
+
+/**
+ * Serialisation and periodic export of the per-block runtime statistics as provided by the scheduler::property::kBlockMetrics
+ * property (i.e. map: block unique name -> @see gr::work::Metrics::toPropertyMap() + 'ports').
+ *
+ * Supported formats:
+ *  - Prometheus text exposition format (e.g. for the node_exporter 'textfile' collector, file is replaced atomically on each export),
+ *    monotonic counters carry the '_total' suffix (e.g. 'gr4_block_nWorkCalls_total'), gauges don't (e.g. 'gr4_block_fillLevel')
+ *  - CSV in long format 'timestamp_ms,block,metric,value' (rows are appended on each export)
+ *
+ * N.B. the scheduler's 'blockMetrics()' must not be called from the exporter thread (it iterates the graph). Instead, keep the
+ * latest kBlockMetrics reply received by the application's message loop and hand out copies of it:
+ * @code
+ * std::mutex   metricsMutex;
+ * property_map latestMetrics;
+ * // message loop: periodically sendMessage<Get>(toScheduler, sched.unique_name, scheduler::property::kBlockMetrics, {}) and on
+ * // a reply with 'reply.endpoint == scheduler::property::kBlockMetrics': { std::lock_guard lock(metricsMutex); latestMetrics = *reply.data; }
+ * gr::metrics::PeriodicExporter exporter([&] { std::lock_guard lock(metricsMutex); return latestMetrics; }, //
+ *     "/var/lib/node_exporter/gr4.prom", gr::metrics::Format::Prometheus, std::chrono::seconds(5));
+ * @endcode
+ */
+enum class Format { Prometheus, CSV };
+
+namespace detail {
+[[nodiscard]] inline std::string numberToString(const pmtv::pmt& value) {
+    return std::visit(
+        []<typename T>(const T& arg) -> std::string {
+            if constexpr (std::is_same_v<T, bool>) {
+                return arg ? "1" : "0";
+            } else if constexpr (std::is_arithmetic_v<T>) {
+                return std::format("{}", arg);
+            } else {
+                return {};
+            }
+        },
+        value);
+}
+
+[[nodiscard]] inline std::string escapeLabel(std::string_view value) {
+    std::string result;
+    result.reserve(value.size());
+    for (const char c : value) {
+        switch (c) {
+        case '\\': result += "\\\\"; break;
+        case '"': result += "\\\""; break;
+        case '\n': result += "\\n"; break;
+        default: result += c;
+        }
+    }
+    return result;
+}
+
+[[nodiscard]] inline std::string escapeCsv(std::string_view value) {
+    if (value.find_first_of(",\"\n") == std::string_view::npos) {
+        return std::string(value);
+    }
+    std::string result = "\"";
+    for (const char c : value) {
+        result += c;
+        if (c == '"') {
+            result += '"';
+        }
+    }
+    result += '"';
+    return result;
+}
+
+template<typename T>
+[[nodiscard]] const T* findAs(const property_map& map, const std::string& key) {
+    const auto it = map.find(key);
+    return it != map.end() ? std::get_if<T>(&it->second) : nullptr;
+}
+
+/// calls 'fn(blockName, metricName, labels, value)' for each scalar metric, 'labels' being a list of (key, value) pairs besides the block name
+template<typename Fn>
+void forEachMetric(const property_map& blockMetrics, Fn&& fn) {
+    using Labels = std::vector<std::pair<std::string_view, std::string>>;
+    for (const auto& [blockName, value] : blockMetrics) {
+        const auto* metrics = std::get_if<property_map>(&value);
+        if (metrics == nullptr) {
+            continue;
+        }
+        for (const auto& [metricName, metricValue] : *metrics) {
+            if (const std::string number = numberToString(metricValue); !number.empty()) {
+                fn(blockName, std::string_view(metricName), Labels{}, number);
+            }
+        }
+        if (const auto* status = findAs<property_map>(*metrics, "status")) {
+            for (const auto& [statusName, count] : *status) {
+                fn(blockName, std::string_view("status"), Labels{{"status", statusName}}, numberToString(count));
+            }
+        }
+        if (const auto* ports = findAs<std::vector<pmtv::pmt>>(*metrics, "ports")) {
+            for (const auto& portValue : *ports) {
+                const auto* port = std::get_if<property_map>(&portValue);
+                if (port == nullptr) {
+                    continue;
+                }
+                const auto* portName  = findAs<std::string>(*port, "name");
+                const auto* direction = findAs<std::string>(*port, "direction");
+                Labels      labels{{"port", portName ? *portName : std::string()}, {"direction", direction ? *direction : std::string()}};
+                for (const char* key : {"bufferSize", "fillLevel"}) {
+                    if (auto it = port->find(key); it != port->end()) {
+                        fn(blockName, std::string_view(key), labels, numberToString(it->second));
+                    }
+                }
+            }
+        }
+    }
+}
+} // namespace detail
+
+[[nodiscard]] inline std::string formatPrometheus(const property_map& blockMetrics, std::string_view prefix = "gr4_block_") {
+    // prometheus requires all samples of a given metric family to be grouped -> collect per metric name first
+    struct Family {
+        bool        isGauge;
+        std::string samples;
+    };
+    std::map<std::string, Family, std::less<>> families;
+    detail::forEachMetric(blockMetrics, [&](const std::string& blockName, std::string_view metricName, const auto& labels, const std::string& value) {
+        const bool        isGauge    = metricName == "bufferSize" || metricName == "fillLevel" || metricName == "maxWorkLatencyNs";
+        const std::string familyName = std::format("{}{}{}", prefix, metricName, isGauge ? "" : "_total"); // prometheus naming convention for counters
+        auto& [_, samples]           = families.try_emplace(familyName, Family{isGauge, {}}).first->second;
+        samples += std::format("{}{{block=\"{}\"", familyName, detail::escapeLabel(blockName));
+        for (const auto& [labelName, labelValue] : labels) {
+            samples += std::format(",{}=\"{}\"", labelName, detail::escapeLabel(labelValue));
+        }
+        samples += std::format("}} {}\n", value);
+    });
+
+    std::string result;
+    for (const auto& [familyName, family] : families) {
+        result += std::format("# TYPE {} {}\n{}", familyName, family.isGauge ? "gauge" : "counter", family.samples);
+    }
+    return result;
+}
+
+inline constexpr std::string_view kCsvHeader = "timestamp_ms,block,metric,value\n";
+
+[[nodiscard]] inline std::string formatCsv(const property_map& blockMetrics, std::chrono::system_clock::time_point timeStamp = std::chrono::system_clock::now()) {
+    const auto  timeStampMs = std::chrono::duration_cast<std::chrono::milliseconds>(timeStamp.time_since_epoch()).count();
+    std::string result;
+    detail::forEachMetric(blockMetrics, [&](const std::string& blockName, std::string_view metricName, const auto& labels, const std::string& value) {
+        std::string name(metricName);
+        for (const auto& [_, labelValue] : labels) {
+            name += std::format(".{}", labelValue);
+        }
+        result += std::format("{},{},{},{}\n", timeStampMs, detail::escapeCsv(blockName), detail::escapeCsv(name), value);
+    });
+    return result;
+}
+
+/**
+ * @brief background thread that periodically queries 'source' and writes the result to 'path'
+ *
+ * The 'source' is invoked from the exporter thread and thus needs to be safe w.r.t. the running scheduler, e.g. return a
+ * copy of the latest scheduler::property::kBlockMetrics reply (see example above) rather than calling 'blockMetrics()'.
+ */
+class PeriodicExporter {
+    std::function<property_map()>  _source;
+    std::filesystem::path          _path;
+    Format                         _format;
+    std::chrono::milliseconds      _period;
+    std::mutex                     _waitMutex;
+    std::mutex                     _exportMutex;
+    std::condition_variable_any    _cv;
+    std::jthread                   _thread;
+
+public:
+    PeriodicExporter(std::function<property_map()> source, std::filesystem::path path, Format format, std::chrono::milliseconds period) //
+        : _source(std::move(source)), _path(std::move(path)), _format(format), _period(period) {
+        if (!_source) {
+            throw gr::exception("PeriodicExporter: metrics source must not be empty");
+        }
+        if (_period <= std::chrono::milliseconds(0)) {
+            throw gr::exception(std::format("PeriodicExporter: invalid export period {}", _period));
+        }
+        _thread = std::jthread([this](std::stop_token stopToken) {
+            while (!stopToken.stop_requested()) {
+                {
+                    std::unique_lock lock(_waitMutex);
+                    std::ignore = _cv.wait_for(lock, stopToken, _period, [] { return false; });
+                }
+                std::ignore = exportNow(); // N.B. also performs a final export on shutdown
+            }
+        });
+    }
+
+    PeriodicExporter(const PeriodicExporter&)            = delete;
+    PeriodicExporter& operator=(const PeriodicExporter&) = delete;
+
+    ~PeriodicExporter() {
+        _thread.request_stop();
+        if (_thread.joinable()) {
+            _thread.join();
+        }
+    }
+
+    [[nodiscard]] const std::filesystem::path& path() const noexcept { return _path; }
+
+    /// one-shot export, also used by the background thread
+    std::expected<void, Error> exportNow() {
+        std::lock_guard    guard(_exportMutex);
+        const property_map metrics = _source();
+        if (_format == Format::Prometheus) { // write-and-rename to never expose a partially written file to the scraper
+            std::filesystem::path tmpPath = _path;
+            tmpPath += ".tmp";
+            {
+                std::ofstream file(tmpPath, std::ios::trunc);
+                if (!file) {
+                    return std::unexpected(Error(std::format("PeriodicExporter: cannot open '{}'", tmpPath.string())));
+                }
+                file << formatPrometheus(metrics);
+            }
+            std::error_code ec;
+            std::filesystem::rename(tmpPath, _path, ec);
+            if (ec) {
+                return std::unexpected(Error(std::format("PeriodicExporter: cannot rename '{}' -> '{}': {}", tmpPath.string(), _path.string(), ec.message())));
+            }
+        } else {
+            std::error_code ec;
+            const bool      writeHeader = !std::filesystem::exists(_path, ec) || std::filesystem::file_size(_path, ec) == 0UZ;
+            std::ofstream   file(_path, std::ios::app);
+            if (!file) {
+                return std::unexpected(Error(std::format("PeriodicExporter: cannot open '{}'", _path.string())));
+            }
+            if (writeHeader) {
+                file << kCsvHeader;
+            }
+            file << formatCsv(metrics);
+        }
+        return {};
+    }
+};
+
+} // namespace gr::metrics
+
+#endif // GNURADIO_METRICS_EXPORTER_HPP
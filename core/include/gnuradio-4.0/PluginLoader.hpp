@@ -2,8 +2,16 @@
 #define GNURADIO_PLUGIN_LOADER_HPP
 
 #include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
 #include <filesystem>
+#include <format>
+#include <fstream>
+#include <map>
+#include <mutex>
 #include <span>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -14,6 +22,7 @@
 
 #ifdef INTERNAL_ENABLE_BLOCK_PLUGINS
 #include <dlfcn.h>
+#include <unistd.h>
 
 #include "Plugin.hpp"
 #endif
@@ -117,25 +126,173 @@ public:
     auto* operator->() const { return _instance; }
 };
 
+/**
+ * @brief persistent cache of the blocks provided by each plugin file ('block name -> plugin file'), keyed by the file's
+ * modification time and size.
+ *
+ * It allows 'PluginLoader' to list the available blocks without 'dlopen'ing every plugin at start-up. Plugins that are
+ * new or modified since the last scan are loaded once to refresh their entry. The file location defaults to
+ * '$GNURADIO4_PLUGIN_MANIFEST' (an empty value disables caching), '$XDG_CACHE_HOME/gnuradio4/plugin_manifest.txt',
+ * or '$HOME/.cache/gnuradio4/plugin_manifest.txt'.
+ */
+struct PluginManifest {
+    struct Entry {
+        std::int64_t             mtime    = 0;
+        std::uintmax_t           fileSize = 0U;
+        std::string              status; // empty: plugin loaded successfully when scanned, otherwise the load error
+        std::vector<std::string> blockNames;
+    };
+
+    std::map<std::string, Entry, std::less<>> entries; // absolute plugin file path -> entry
+
+    static constexpr std::string_view kHeader = "gnuradio4-plugin-manifest 1";
+
+    [[nodiscard]] static std::filesystem::path defaultFile() {
+        if (const char* manifest = ::getenv("GNURADIO4_PLUGIN_MANIFEST"); manifest != nullptr) {
+            return manifest;
+        }
+        if (const char* cacheHome = ::getenv("XDG_CACHE_HOME"); cacheHome != nullptr && *cacheHome != '\0') {
+            return std::filesystem::path(cacheHome) / "gnuradio4" / "plugin_manifest.txt";
+        }
+        if (const char* home = ::getenv("HOME"); home != nullptr && *home != '\0') {
+            return std::filesystem::path(home) / ".cache" / "gnuradio4" / "plugin_manifest.txt";
+        }
+        return {};
+    }
+
+    [[nodiscard]] static std::pair<std::int64_t, std::uintmax_t> fileStamp(const std::filesystem::path& file) {
+        std::error_code ec;
+        const auto      mtime = std::filesystem::last_write_time(file, ec);
+        const auto      size  = std::filesystem::file_size(file, ec);
+        return ec ? std::pair<std::int64_t, std::uintmax_t>{-1, 0U} : std::pair<std::int64_t, std::uintmax_t>{static_cast<std::int64_t>(mtime.time_since_epoch().count()), size};
+    }
+
+    [[nodiscard]] bool isUpToDate(std::string_view pluginFile, std::pair<std::int64_t, std::uintmax_t> stamp) const {
+        auto it = entries.find(pluginFile);
+        return it != entries.end() && stamp.first >= 0 && it->second.mtime == stamp.first && it->second.fileSize == stamp.second;
+    }
+
+    /// line format: 'P<TAB>mtime<TAB>size<TAB>path<TAB>status' followed by one 'B<TAB>block name' line per provided block
+    [[nodiscard]] static PluginManifest read(const std::filesystem::path& manifestFile) {
+        PluginManifest manifest;
+        std::ifstream  in(manifestFile);
+        std::string    line;
+        if (!in || !std::getline(in, line) || line != kHeader) {
+            return manifest; // missing, unreadable or incompatible -> rescan
+        }
+
+        Entry* current = nullptr;
+        while (std::getline(in, line)) {
+            if (line.starts_with("B\t") && current != nullptr) {
+                current->blockNames.emplace_back(line.substr(2UZ));
+            } else if (line.starts_with("P\t")) {
+                std::array<std::string, 4UZ> fields;
+                std::istringstream           stream(line.substr(2UZ));
+                for (auto& field : fields) {
+                    std::getline(stream, field, '\t');
+                }
+                Entry entry;
+                if (std::from_chars(fields[0].data(), fields[0].data() + fields[0].size(), entry.mtime).ec != std::errc{} || std::from_chars(fields[1].data(), fields[1].data() + fields[1].size(), entry.fileSize).ec != std::errc{} || fields[2].empty()) {
+                    return {}; // corrupt -> rescan
+                }
+                entry.status = std::move(fields[3]);
+                current      = &manifest.entries.insert_or_assign(std::move(fields[2]), std::move(entry)).first->second;
+            } else if (!line.empty()) {
+                return {};
+            }
+        }
+        return manifest;
+    }
+
+    /// writes atomically (temporary file + rename) so that concurrently starting processes never read a partial manifest, stale entries of deleted plugins are dropped
+    bool write(const std::filesystem::path& manifestFile) const {
+        std::error_code ec;
+        if (manifestFile.has_parent_path()) {
+            std::filesystem::create_directories(manifestFile.parent_path(), ec);
+        }
+        const std::filesystem::path tmpFile = manifestFile.string() + std::format(".{}.tmp", ::getpid());
+        {
+            std::ofstream out(tmpFile, std::ios::trunc);
+            if (!out) {
+                return false;
+            }
+            out << kHeader << '\n';
+            for (const auto& [pluginFile, entry] : entries) {
+                if (!std::filesystem::exists(pluginFile, ec)) {
+                    continue;
+                }
+                out << std::format("P\t{}\t{}\t{}\t{}\n", entry.mtime, entry.fileSize, pluginFile, entry.status);
+                for (const auto& blockName : entry.blockNames) {
+                    out << "B\t" << blockName << '\n';
+                }
+            }
+            if (!out.flush()) {
+                std::filesystem::remove(tmpFile, ec);
+                return false;
+            }
+        }
+        std::filesystem::rename(tmpFile, manifestFile, ec);
+        if (ec) {
+            std::filesystem::remove(tmpFile, ec);
+            return false;
+        }
+        return true;
+    }
+};
+
+/**
+ * @brief discovers block plugins in the given directories and 'dlopen's a plugin only the first time one of its blocks
+ * is requested via 'instantiate(..)' or 'isBlockAvailable(..)'.
+ *
+ * The 'block name -> plugin file' index is taken from the 'PluginManifest' cache (see above), only new or modified
+ * plugin files are loaded during construction. Use 'loadAll()' to load all plugins eagerly (e.g. before entering a
+ * latency-critical section), and an empty 'manifestFile' to disable the cache.
+ */
 class PluginLoader {
 private:
-    std::vector<PluginHandler>                       _pluginHandlers;
-    std::unordered_map<std::string, gr_plugin_base*> _pluginForBlockName;
-    std::unordered_map<std::string, std::string>     _failedPlugins;
-    std::unordered_set<std::string>                  _loadedPluginFiles;
+    struct PluginFile {
+        std::string     path;
+        gr_plugin_base* instance      = nullptr;
+        bool            loadAttempted = false;
+    };
+
+    mutable std::mutex                                   _mutex;
+    mutable std::vector<PluginHandler>                   _pluginHandlers;
+    mutable std::vector<PluginFile>                      _pluginFiles;
+    std::unordered_map<std::string, std::size_t>         _pluginForBlockName; // block name -> index into _pluginFiles
+    mutable std::unordered_map<std::string, std::string> _failedPlugins;
+    std::unordered_set<std::string>                      _loadedPluginFiles;
+    std::filesystem::path                                _manifestFile;
 
     BlockRegistry* _registry;
 
+    gr_plugin_base* load(PluginFile& file) const { // N.B. requires '_mutex' to be held
+        if (!file.loadAttempted) {
+            file.loadAttempted = true;
+            if (PluginHandler handler(file.path); handler) {
+                file.instance = handler.operator->();
+                _pluginHandlers.push_back(std::move(handler));
+            } else {
+                _failedPlugins[file.path] = handler.status();
+            }
+        }
+        return file.instance;
+    }
+
     gr_plugin_base* pluginForBlockName(std::string_view name) const {
+        std::lock_guard lock(_mutex);
         if (auto it = _pluginForBlockName.find(std::string(name)); it != _pluginForBlockName.end()) {
-            return it->second;
+            return load(_pluginFiles[it->second]);
         } else {
             return nullptr;
         }
     }
 
 public:
-    PluginLoader(BlockRegistry& registry, std::span<const std::filesystem::path> plugin_directories) : _registry(&registry) {
+    PluginLoader(BlockRegistry& registry, std::span<const std::filesystem::path> plugin_directories, std::filesystem::path manifestFile = PluginManifest::defaultFile()) : _manifestFile(std::move(manifestFile)), _registry(&registry) {
+        PluginManifest manifest        = _manifestFile.empty() ? PluginManifest{} : PluginManifest::read(_manifestFile);
+        bool           manifestChanged = false;
+
         for (const auto& directory : plugin_directories) {
             if (!std::filesystem::is_directory(directory)) {
                 continue;
@@ -147,33 +304,73 @@ public:
 #else
                 if (file.is_regular_file() && file.path().extension() == ".so") {
 #endif
-                    auto fileString = file.path().string();
+                    std::error_code ec;
+                    const auto      absolutePath = std::filesystem::absolute(file.path(), ec);
+                    auto            fileString   = ec ? file.path().string() : absolutePath.lexically_normal().string();
                     if (_loadedPluginFiles.contains(fileString)) {
                         continue;
                     }
                     _loadedPluginFiles.insert(fileString);
 
-                    if (PluginHandler handler(file.path().string()); handler) {
-                        for (std::string_view blockName : handler->availableBlocks()) {
-                            _pluginForBlockName.emplace(std::string(blockName), handler.operator->());
+                    PluginFile pluginFile{fileString};
+                    if (const auto stamp = PluginManifest::fileStamp(file.path()); !manifest.isUpToDate(fileString, stamp)) {
+                        // new or modified plugin -> load once to (re-)discover its blocks
+                        PluginManifest::Entry entry{.mtime = stamp.first, .fileSize = stamp.second};
+                        pluginFile.loadAttempted = true;
+                        if (PluginHandler handler(fileString); handler) {
+                            entry.blockNames   = handler->availableBlocks();
+                            pluginFile.instance = handler.operator->();
+                            _pluginHandlers.push_back(std::move(handler));
+                        } else {
+                            entry.status = handler.status();
                         }
+                        manifest.entries.insert_or_assign(fileString, std::move(entry));
+                        manifestChanged = true;
+                    }
 
-                        _pluginHandlers.push_back(std::move(handler));
-
-                    } else {
-                        _failedPlugins[file.path().string()] = handler.status();
+                    const auto& entry = manifest.entries.at(fileString);
+                    if (!entry.status.empty()) {
+                        _failedPlugins[fileString] = entry.status;
+                        continue;
+                    }
+                    for (const auto& blockName : entry.blockNames) {
+                        _pluginForBlockName.emplace(blockName, _pluginFiles.size());
                     }
+                    _pluginFiles.push_back(std::move(pluginFile));
                 }
             }
         }
+
+        if (manifestChanged && !_manifestFile.empty()) {
+            std::ignore = manifest.write(_manifestFile); // best effort, failing merely disables the start-up speed-up
+        }
     }
 
     BlockRegistry& registry() { return *_registry; }
 
-    const auto& plugins() const { return _pluginHandlers; }
+    /// N.B. loads all discovered plugins
+    const auto& plugins() const {
+        loadAll();
+        return _pluginHandlers;
+    }
 
     const auto& failedPlugins() const { return _failedPlugins; }
 
+    /// 'dlopen's all plugins that have not been loaded yet
+    void loadAll() const {
+        std::lock_guard lock(_mutex);
+        for (auto& file : _pluginFiles) {
+            std::ignore = load(file);
+        }
+    }
+
+    [[nodiscard]] std::size_t nLoadedPlugins() const {
+        std::lock_guard lock(_mutex);
+        return _pluginHandlers.size();
+    }
+
+    [[nodiscard]] const std::filesystem::path& manifestFile() const { return _manifestFile; }
+
     std::vector<std::string> availableBlocks() const {
         auto                     keysView = _pluginForBlockName | std::views::keys;
         std::vector<std::string> result(keysView.begin(), keysView.end());
@@ -227,7 +424,7 @@ private:
     BlockRegistry* _registry;
 
 public:
-    PluginLoader(BlockRegistry& registry, std::span<const std::filesystem::path> /*plugin_directories*/) : _registry(&registry) {}
+    PluginLoader(BlockRegistry& registry, std::span<const std::filesystem::path> /*plugin_directories*/, const std::filesystem::path& /*manifestFile*/ = {}) : _registry(&registry) {}
 
     BlockRegistry& registry() { return *_registry; }
 
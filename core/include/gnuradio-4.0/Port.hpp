@@ -6,6 +6,7 @@
 #include <complex>
 #include <set>
 #include <span>
+#include <typeinfo>
 #include <variant>
 
 #include <gnuradio-4.0/meta/utils.hpp>
@@ -288,6 +289,7 @@ concept PortLike = requires(T t, const std::size_t n_items, const std::any& newD
 struct InternalPortBuffers {
     void* streamHandler;
     void* tagHandler;
+    void* passThroughGate = nullptr; // 'std::shared_ptr<gr::Sequence>*', non-null for aliased pass-through outputs: stream/tag handlers then refer to the forwarded input's readers, @see gr::PassThrough
 };
 
 /**
@@ -743,6 +745,17 @@ private:
     TagIoType _tagIoHandler = newTagIoHandler();
     Tag       _cachedTag{}; // todo: for now this is only used in the output ports
 
+    InternalPortBuffers       _passThroughSource{nullptr, nullptr}; // reader handlers of the input forwarded unchanged by this output, @see setPassThroughSource(..)
+    std::shared_ptr<Sequence> _passThroughGate{};                   // forwarded input's read sequence shared with the aliased downstream readers
+
+    [[nodiscard]] bool isPassThroughSourceConnected() const noexcept {
+        if constexpr (kIsOutput) {
+            return _passThroughSource.streamHandler != nullptr && static_cast<const ReaderType*>(_passThroughSource.streamHandler)->buffer().n_writers() > 0UZ;
+        } else {
+            return false;
+        }
+    }
+
     [[nodiscard]] constexpr auto newIoHandler(std::size_t buffer_size = kDefaultBufferSize) const noexcept {
         if constexpr (kIsInput) {
             return BufferType(buffer_size).new_reader();
@@ -779,6 +792,16 @@ public:
     [[nodiscard]] InternalPortBuffers writerHandlerInternal() noexcept
     requires(kIsOutput)
     {
+        if constexpr (requires(const ReaderType& reader) { reader.readSequence(); }) {
+            if (isPassThroughSourceConnected()) { // alias the downstream reader onto the buffer upstream of the forwarded input
+                const auto& sourceSequence = static_cast<ReaderType*>(_passThroughSource.streamHandler)->readSequence();
+                if (!_passThroughGate || _passThroughGate.get() != sourceSequence.get()) {
+                    auto owner       = std::make_shared<std::shared_ptr<Sequence>>(sourceSequence);
+                    _passThroughGate = std::shared_ptr<Sequence>(owner, owner->get()); // aliasing ctor: use_count() - 1 == number of aliased readers
+                }
+                return {_passThroughSource.streamHandler, _passThroughSource.tagHandler, static_cast<void*>(std::addressof(_passThroughGate))};
+            }
+        }
         return {static_cast<void*>(std::addressof(_ioHandler)), static_cast<void*>(std::addressof(_tagIoHandler))};
     }
 
@@ -796,17 +819,93 @@ public:
         //       this will fail. We need to add a check that two ports that
         //       connect to each other use the same buffer type
         //       (std::any could be a viable approach)
+        if (buffer_writer_handler_other.passThroughGate != nullptr) { // aliased pass-through output -> read the upstream buffer, gated by the forwarded input
+            if constexpr (requires(BufferType b, TagBufferType tb, std::shared_ptr<Sequence> gate) {
+                              b.new_reader(gate);
+                              tb.new_reader(gate, 0UZ);
+                          }) {
+                auto typed_buffer_reader     = static_cast<ReaderType*>(buffer_writer_handler_other.streamHandler);
+                auto typed_tag_buffer_reader = static_cast<TagReaderType*>(buffer_writer_handler_other.tagHandler);
+                _ioHandler                   = typed_buffer_reader->buffer().new_reader(*static_cast<std::shared_ptr<Sequence>*>(buffer_writer_handler_other.passThroughGate));
+                // tags start at the forwarded input's tag position (not the tag cursor) -- the stream reader starts at the gate, i.e. includes samples not yet forwarded
+                _tagIoHandler = typed_tag_buffer_reader->buffer().new_reader(nullptr, typed_tag_buffer_reader->position());
+                return true;
+            } else {
+                return false;
+            }
+        }
+
         auto typed_buffer_writer     = static_cast<WriterType*>(buffer_writer_handler_other.streamHandler);
         auto typed_tag_buffer_writer = static_cast<TagWriterType*>(buffer_writer_handler_other.tagHandler);
         setBuffer(typed_buffer_writer->buffer(), typed_tag_buffer_writer->buffer());
         return true;
     }
 
+    [[nodiscard]] InternalPortBuffers ioHandlerInternal() noexcept {
+        if constexpr (kIsOutput) {
+            return {static_cast<void*>(std::addressof(_ioHandler)), static_cast<void*>(std::addressof(_tagIoHandler)), static_cast<void*>(std::addressof(_passThroughGate))};
+        } else {
+            return {static_cast<void*>(std::addressof(_ioHandler)), static_cast<void*>(std::addressof(_tagIoHandler))};
+        }
+    }
+
+    /**
+     * @brief exchanges the stream and tag buffer handlers -- i.e. the connection including its pending read/write position -- with
+     * another port's handlers of identical 'IoType' and 'TagIoType' (obtained via 'ioHandlerInternal()').
+     *
+     * N.B. not thread-safe: neither port may be processed concurrently, i.e. swap only in between the 'work(...)' calls of the owning blocks.
+     */
+    [[nodiscard]] bool swapIoHandlerInternal(InternalPortBuffers handler_other) noexcept {
+        if (handler_other.streamHandler == nullptr || handler_other.tagHandler == nullptr) {
+            return false;
+        }
+        using std::swap;
+        swap(_ioHandler, *static_cast<IoType*>(handler_other.streamHandler));
+        swap(_tagIoHandler, *static_cast<TagIoType*>(handler_other.tagHandler));
+        if constexpr (kIsOutput) {
+            if (handler_other.passThroughGate != nullptr) { // N.B. aliased readers follow the (swapped) forwarded input's read sequence
+                swap(_passThroughGate, *static_cast<std::shared_ptr<Sequence>*>(handler_other.passThroughGate));
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief declares that this output forwards the samples and tags of 'input' unchanged (@see gr::PassThrough).
+     * Downstream ports connected while 'input' is connected are aliased onto the buffer upstream of 'input' -- gated by the
+     * read position of 'input' -- rather than reading from this port's own buffer.
+     */
+    template<typename TInputPort>
+    void setPassThroughSource(TInputPort& input) noexcept
+    requires(kIsOutput && TInputPort::kIsInput)
+    {
+        static_assert(std::is_same_v<typename TInputPort::BufferType, BufferType> && std::is_same_v<typename TInputPort::TagBufferType, TagBufferType>, "pass-through input and output need to share the same stream and tag buffer types");
+        static_assert(requires(BufferType b, std::shared_ptr<Sequence> gate, const ReaderType& reader) {
+            b.new_reader(gate);
+            reader.readSequence();
+        }, "pass-through requires a buffer type supporting gated readers");
+        _passThroughSource = input.ioHandlerInternal();
+    }
+
+    /// true if this is a pass-through output whose forwarded input is not (yet) connected, i.e. downstream ports connected now would not be aliased
+    [[nodiscard]] bool isPassThroughPending() const noexcept {
+        if constexpr (kIsOutput) {
+            return _passThroughSource.streamHandler != nullptr && !isPassThroughSourceConnected();
+        } else {
+            return false;
+        }
+    }
+
+    [[nodiscard]] std::size_t nAliasedReaders() const noexcept {
+        const auto useCount = _passThroughGate.use_count();
+        return useCount > 1L ? static_cast<std::size_t>(useCount - 1L) : 0UZ;
+    }
+
     [[nodiscard]] constexpr bool isConnected() const noexcept {
         if constexpr (kIsInput) {
             return _ioHandler.buffer().n_writers() > 0;
         } else {
-            return _ioHandler.buffer().n_readers() > 0;
+            return _ioHandler.buffer().n_readers() > 0 || nAliasedReaders() > 0UZ;
         }
     }
 
@@ -896,6 +995,19 @@ public:
         return port_buffers{_ioHandler.buffer(), _tagIoHandler.buffer()};
     }
 
+    /// touches all pages of the attached stream and tag buffers (N.B. not thread-safe w.r.t. concurrent buffer writes), @return number of touched pages
+    std::size_t prefaultBuffer() noexcept {
+        auto        buffers = buffer();
+        std::size_t nPages  = 0UZ;
+        if constexpr (requires(BufferType& b) { b.prefault(); }) {
+            nPages += buffers.streamBuffer.prefault();
+        }
+        if constexpr (requires(TagBufferType& b) { b.prefault(); }) {
+            nPages += buffers.tagBuffer.prefault();
+        }
+        return nPages;
+    }
+
     void setBuffer(gr::BufferLike auto streamBuffer, gr::BufferLike auto tagBuffer) noexcept {
         if constexpr (kIsInput) {
             _ioHandler    = streamBuffer.new_reader();
@@ -952,6 +1064,7 @@ public:
         }
         _ioHandler    = newIoHandler();
         _tagIoHandler = newTagIoHandler();
+        _passThroughGate.reset();
         return ConnectionResult::SUCCESS;
     }
 
@@ -1119,11 +1232,15 @@ private:
 
         [[nodiscard]] virtual ConnectionResult resizeBuffer(std::size_t min_size) noexcept = 0;
         [[nodiscard]] virtual bool             isConnected() const noexcept                = 0;
+        [[nodiscard]] virtual bool             isPassThroughPending() const noexcept       = 0;
         [[nodiscard]] virtual ConnectionResult disconnect() noexcept                       = 0;
         [[nodiscard]] virtual ConnectionResult connect(DynamicPort& dst_port)              = 0;
 
         // internal runtime polymorphism access
         [[nodiscard]] virtual bool updateReaderInternal(InternalPortBuffers buffer_other) noexcept = 0;
+        [[nodiscard]] virtual InternalPortBuffers   ioHandlerInternal() noexcept                = 0;
+        [[nodiscard]] virtual const std::type_info& ioHandlerType() const noexcept              = 0;
+        [[nodiscard]] virtual ConnectionResult      swapConnection(DynamicPort& other) noexcept = 0;
 
         [[nodiscard]] virtual std::size_t nReaders() const   = 0;
         [[nodiscard]] virtual std::size_t nWriters() const   = 0;
@@ -1205,8 +1322,18 @@ private:
         [[nodiscard]] std::size_t      nWriters() const override { return _value.nWriters(); }
         [[nodiscard]] std::size_t      bufferSize() const override { return _value.bufferSize(); }
         [[nodiscard]] bool             isConnected() const noexcept override { return _value.isConnected(); }
+        [[nodiscard]] bool             isPassThroughPending() const noexcept override { return _value.isPassThroughPending(); }
         [[nodiscard]] ConnectionResult disconnect() noexcept override { return _value.disconnect(); }
 
+        [[nodiscard]] InternalPortBuffers   ioHandlerInternal() noexcept override { return _value.ioHandlerInternal(); }
+        [[nodiscard]] const std::type_info& ioHandlerType() const noexcept override { return typeid(std::pair<typename TPortType::IoType, typename TPortType::TagIoType>); }
+        [[nodiscard]] ConnectionResult      swapConnection(DynamicPort& other) noexcept override {
+            if (ioHandlerType() != other._accessor->ioHandlerType()) {
+                return ConnectionResult::FAILED; // different direction, value or buffer type
+            }
+            return _value.swapIoHandlerInternal(other._accessor->ioHandlerInternal()) ? ConnectionResult::SUCCESS : ConnectionResult::FAILED;
+        }
+
         [[nodiscard]] ConnectionResult connect(DynamicPort& dst_port) override { // TODO: return signature: refactor to non-throwing std::expected<ConnectionResult, Error> return -> follow-up PR
             using enum gr::ConnectionResult;
             port::BitMask thisMask = portMaskInfo();
@@ -1325,12 +1452,21 @@ public:
 
     [[nodiscard]] bool isConnected() const noexcept { return _accessor->isConnected(); }
 
+    /// true for pass-through outputs whose forwarded input is not yet connected, i.e. connections made now would copy rather than alias, @see gr::PassThrough
+    [[nodiscard]] bool isPassThroughPending() const noexcept { return _accessor->isPassThroughPending(); }
+
     [[nodiscard]] std::size_t nReaders() const { return _accessor->nReaders(); }
     [[nodiscard]] std::size_t nWriters() const { return _accessor->nWriters(); }
     [[nodiscard]] std::size_t bufferSize() const { return _accessor->bufferSize(); }
 
     [[nodiscard]] ConnectionResult disconnect() noexcept { return _accessor->disconnect(); }
 
+    /// true if the connection of this port can be moved to 'other' (same direction, value and buffer types), @see swapConnection
+    [[nodiscard]] bool isSwappableWith(const DynamicPort& other) const noexcept { return _accessor->ioHandlerType() == other._accessor->ioHandlerType(); }
+
+    /// exchanges the connections (buffer reader/writer incl. unconsumed samples and tags) of both ports, e.g. to hand over a live edge to a replacement block
+    [[nodiscard]] ConnectionResult swapConnection(DynamicPort& other) noexcept { return _accessor->swapConnection(other); }
+
     [[nodiscard]] ConnectionResult connect(DynamicPort& dst_port) { return _accessor->connect(dst_port); }
 };
 
@@ -4,12 +4,14 @@
 #include <bit>
 #include <chrono>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <set>
 
 #include <thread>
 #include <utility>
 
+#include <gnuradio-4.0/BottleneckAnalyser.hpp>
 #include <gnuradio-4.0/Graph.hpp>
 #include <gnuradio-4.0/Graph_yaml_importer.hpp>
 #include <gnuradio-4.0/LifeCycle.hpp>
@@ -17,6 +19,8 @@
 #include <gnuradio-4.0/Port.hpp>
 #include <gnuradio-4.0/Profiler.hpp>
 #include <gnuradio-4.0/meta/reflection.hpp>
+#include <gnuradio-4.0/thread/MemoryMonitor.hpp>
+#include <gnuradio-4.0/thread/cpu_topology.hpp>
 #include <gnuradio-4.0/thread/thread_pool.hpp>
 
 #ifdef __EMSCRIPTEN__
@@ -70,7 +74,9 @@ inline static const char* kBlockReplaced = "BlockReplaced";
 inline static const char* kEdgeEmplaced  = "EdgeEmplaced";
 inline static const char* kEdgeRemoved   = "EdgeRemoved";
 
-inline static const char* kGraphGRC = "GraphGRC";
+inline static const char* kGraphGRC     = "GraphGRC";
+inline static const char* kBlockMetrics = "BlockMetrics"; ///< runtime statistics of all (nested) normal blocks, keyed by their unique name, @see block::property::kMetrics
+inline static const char* kBottleneck   = "Bottleneck";   ///< buffer fill-level based bottleneck/back-pressure analysis (Get, Set: reset, Subscribe: notified when the bottleneck changes), @see gr::metrics::BottleneckAnalyser
 } // namespace property
 
 enum class ExecutionPolicy {
@@ -81,6 +87,85 @@ enum class ExecutionPolicy {
 
 using JobLists = std::vector<std::vector<std::shared_ptr<BlockModel>>>;
 
+namespace detail {
+/// calls 'fn(DynamicPort& port, DynamicPort* counterpart)' for all ports in 'ports' (incl. port collection members), 'counterpart' being the equally named port in 'otherPorts' or nullptr
+template<typename Fn>
+void forEachCounterpartPort(BlockModel::DynamicPorts& ports, BlockModel::DynamicPorts& otherPorts, Fn&& fn) {
+    for (BlockModel::DynamicPortOrCollection& entry : ports) {
+        const std::string name    = BlockModel::portName(entry);
+        auto              otherIt = std::ranges::find_if(otherPorts, [&name](const auto& otherEntry) { return BlockModel::portName(otherEntry) == name; });
+        if (auto* port = std::get_if<DynamicPort>(&entry)) {
+            fn(*port, otherIt != otherPorts.end() ? std::get_if<DynamicPort>(&*otherIt) : nullptr);
+            continue;
+        }
+        auto& collection      = std::get<BlockModel::NamedPortCollection>(entry);
+        auto* otherCollection = otherIt != otherPorts.end() ? std::get_if<BlockModel::NamedPortCollection>(&*otherIt) : nullptr;
+        for (std::size_t i = 0UZ; i < collection.ports.size(); ++i) {
+            fn(collection.ports[i], otherCollection != nullptr && i < otherCollection->ports.size() ? &otherCollection->ports[i] : nullptr);
+        }
+    }
+}
+
+/// the default IO pool is shared by all schedulers: the first scheduler keeping it off its pinned runner cores saves the pool's affinity, the last one restores it, @see pin_runners
+class SharedIoPoolAffinity {
+    std::mutex        _mutex;
+    std::size_t       _nUsers = 0UZ;
+    std::vector<bool> _savedMask;
+
+public:
+    static SharedIoPoolAffinity& instance() {
+        static SharedIoPoolAffinity singleton;
+        return singleton;
+    }
+
+    void acquire(gr::thread_pool::BasicThreadPool& pool, const std::vector<bool>& ioMask) {
+        std::lock_guard lock(_mutex);
+        if (_nUsers == 0UZ) {
+            _savedMask = pool.getAffinityMask();
+        }
+        pool.setAffinityMask(ioMask); // may throw std::system_error, N.B. the latest placement wins while several schedulers are pinned
+        ++_nUsers;
+    }
+
+    void release(gr::thread_pool::BasicThreadPool& pool, std::size_t nCpus) {
+        std::lock_guard lock(_mutex);
+        if (_nUsers == 0UZ || --_nUsers > 0UZ) {
+            return;
+        }
+        // N.B. an empty mask does not reset the threads' affinity -> an unconstrained pool is restored as 'all CPUs allowed'
+        pool.setAffinityMask(_savedMask.empty() ? std::vector<bool>(nCpus, true) : _savedMask);
+    }
+};
+
+/// memory locking is process-wide: the first scheduler with 'lock_memory' locks the process memory, the last one to stop unlocks it, @see lock_memory
+class SharedMemoryLock {
+    std::mutex  _mutex;
+    std::size_t _nUsers = 0UZ;
+
+public:
+    static SharedMemoryLock& instance() {
+        static SharedMemoryLock singleton;
+        return singleton;
+    }
+
+    void acquire() {
+        std::lock_guard lock(_mutex);
+        if (_nUsers == 0UZ) {
+            gr::memory::lockProcessMemory(); // may throw std::system_error (e.g. missing CAP_IPC_LOCK)
+        }
+        ++_nUsers;
+    }
+
+    void release() {
+        std::lock_guard lock(_mutex);
+        if (_nUsers == 0UZ || --_nUsers > 0UZ) {
+            return;
+        }
+        gr::memory::unlockProcessMemory();
+    }
+};
+} // namespace detail
+
 template<typename Derived, ExecutionPolicy execution = ExecutionPolicy::singleThreaded, profiling::ProfilerLike TProfiler = profiling::null::Profiler>
 struct SchedulerBase : Block<Derived> {
     friend class lifecycle::StateMachine<Derived>;
@@ -112,6 +197,9 @@ protected:
     std::shared_ptr<gr::Sequence> _nRunningJobs = std::make_shared<gr::Sequence>();
     std::recursive_mutex          _executionOrderMutex; // only used when modifying and copying the graph->local job list
     std::shared_ptr<JobLists>     _executionOrder = std::make_shared<JobLists>();
+    std::vector<std::size_t>      _runnerCpus;      // runnerID -> pinned CPU (empty: not pinned), @see pin_runners
+    std::size_t                   _nIoPoolCpus  = 0UZ;   // >0: default IO pool affinity changed by this scheduler, restored on stop()
+    bool                          _memoryLocked = false; // process memory locked by this scheduler, unlocked on stop(), @see lock_memory
 
     std::mutex                               _zombieBlocksMutex;
     std::vector<std::shared_ptr<BlockModel>> _zombieBlocks;
@@ -121,6 +209,18 @@ protected:
     // fixed-sized vector indexed by runnerId. Cheaper than a map.
     std::vector<std::vector<std::shared_ptr<BlockModel>>> _adoptionBlocks;
 
+    // RCU-style execution-plan updates for live block replacement, @see propertyCallbackReplaceBlock(..)
+    struct PlanUpdate {
+        std::size_t                 epoch;
+        std::shared_ptr<BlockModel> oldBlock;
+        std::shared_ptr<BlockModel> newBlock;
+        bool                        handedOver = false;
+    };
+    std::atomic<std::size_t> _planEpoch{0UZ};
+    std::mutex               _planUpdatesMutex;
+    std::vector<PlanUpdate>  _planUpdates;
+    std::vector<std::size_t> _runnerPlanEpochs; // runnerID -> last acknowledged plan epoch
+
     MsgPortOutForChildren    _toChildMessagePort;
     MsgPortInFromChildren    _fromChildMessagePort;
     std::vector<gr::Message> _pendingMessagesToChildren;
@@ -128,6 +228,10 @@ protected:
 
     std::atomic_flag _processingScheduledMessages;
 
+    gr::metrics::BottleneckAnalyser       _bottleneckAnalyser;
+    std::chrono::steady_clock::time_point _lastBottleneckSample{};
+    std::string                           _lastBottleneck;
+
     void rebuildProfiler(const profiling::Options& opt) {
         std::destroy_at(std::addressof(_profiler));
         std::construct_at(std::addressof(_profiler), opt);
@@ -143,6 +247,8 @@ protected:
         callbacks[scheduler::property::kEmplaceEdge]  = std::mem_fn(&SchedulerBase::propertyCallbackEmplaceEdge);
         callbacks[scheduler::property::kReplaceBlock] = std::mem_fn(&SchedulerBase::propertyCallbackReplaceBlock);
         callbacks[scheduler::property::kGraphGRC]     = std::mem_fn(&SchedulerBase::propertyCallbackGraphGRC);
+        callbacks[scheduler::property::kBlockMetrics] = std::mem_fn(&SchedulerBase::propertyCallbackBlockMetrics);
+        callbacks[scheduler::property::kBottleneck]   = std::mem_fn(&SchedulerBase::propertyCallbackBottleneck);
         this->settings().updateActiveParameters();
     }
 
@@ -156,8 +262,14 @@ public:
     Annotated<std::string, "pool name", Doc<"default pool name">>                                                              poolName                        = std::string(gr::thread_pool::kDefaultCpuPoolId);
     Annotated<std::size_t, "max_work_items", Doc<"number of work items per work scheduling interval (controls latency)">>      max_work_items                  = std::numeric_limits<std::size_t>::max(); // TODO: check whether we can keep this std::size_t or more consistently to gr::Size_t
     Annotated<property_map, "sched_settings", Doc<"scheduler implementation specific settings">>                               sched_settings{};
+    Annotated<gr::Size_t, "bottleneck_sample_period", Unit<"ms">, Doc<"bottleneck analyser sampling period (0: on request)">>  bottleneck_sample_period        = 0U;
+    Annotated<bool, "pin_runners", Doc<"pin runners one per physical core, cache-neighbours first, IO pool on the rest">>      pin_runners                     = false;
+    Annotated<bool, "prefault_buffers", Doc<"real-time: touch all buffer pages at start() (no page-faults while running)">>    prefault_buffers                = false;
+    Annotated<bool, "lock_memory", Doc<"real-time: mlockall(current|future) start() to stop() (needs CAP_IPC_LOCK)">>          lock_memory                     = false;
+    Annotated<std::string, "runner_policy", Doc<"real-time: runner OS scheduling policy: OTHER, FIFO, ROUND_ROBIN">>           runner_policy                   = std::string("OTHER");
+    Annotated<int, "runner_priority", Doc<"real-time: runner OS priority (FIFO, ROUND_ROBIN: 1..99)">>                         runner_priority                 = 0;
 
-    GR_MAKE_REFLECTABLE(SchedulerBase, timeout_ms, timeout_inactivity_count, process_stream_to_message_ratio, max_work_items, sched_settings);
+    GR_MAKE_REFLECTABLE(SchedulerBase, timeout_ms, timeout_inactivity_count, process_stream_to_message_ratio, max_work_items, sched_settings, bottleneck_sample_period, pin_runners, prefault_buffers, lock_memory, runner_policy, runner_priority);
 
     constexpr static block::Category blockCategory = block::Category::ScheduledBlockGroup;
 
@@ -254,6 +366,16 @@ public:
     [[nodiscard]] const gr::Graph& graph() const noexcept { return _graph; }
     [[nodiscard]] const TProfiler& profiler() const noexcept { return _profiler; }
 
+    /// runtime statistics of all (nested) normal blocks keyed by their unique name, @see BlockModel::runtimeMetrics()
+    [[nodiscard]] property_map blockMetrics() const {
+        property_map result;
+        graph::forEachBlock<block::Category::TransparentBlockGroup>(_graph, [&result](const std::shared_ptr<BlockModel>& block) { result.insert_or_assign(std::string(block->uniqueName()), block->runtimeMetrics()); }, block::Category::NormalBlock);
+        return result;
+    }
+
+    /// N.B. sampled from within the scheduler's message-processing thread, @see bottleneck_sample_period and scheduler::property::kBottleneck
+    [[nodiscard]] const gr::metrics::BottleneckAnalyser& bottleneckAnalyser() const noexcept { return _bottleneckAnalyser; }
+
     [[nodiscard]] bool isProcessing() const
     requires(executionPolicy() == ExecutionPolicy::multiThreaded)
     {
@@ -314,6 +436,7 @@ public:
         on_scope_exit _ = [&] { std::atomic_flag_clear_explicit(&_processingScheduledMessages, std::memory_order_release); };
 
         base_t::processScheduledMessages(); // filters messages and calls own property handler
+        sampleBottleneckAnalyser();
 
         // Process messages in the graph
         _graph.processScheduledMessages();
@@ -486,6 +609,8 @@ protected:
             }
         }
 
+        applyMemoryProfile(); // N.B. before RUNNING, i.e. before the blocks' (IO) threads touch the buffers
+
         std::lock_guard lock(_executionOrderMutex);
         graph::forEachBlock<TransparentBlockGroup>(_graph, [this](auto& block) { //
             this->emitErrorMessageIfAny("LifecycleState -> RUNNING", block->changeStateTo(lifecycle::RUNNING));
@@ -501,11 +626,13 @@ protected:
 
         assert(_nRunningJobs->value() == 0UZ);
         assert(!_executionOrder->empty());
+        resetPlanUpdates(_executionOrder->size());
         if constexpr (executionPolicy() == ExecutionPolicy::singleThreaded || executionPolicy() == ExecutionPolicy::singleThreadedBlocking) {
             static_cast<Derived*>(this)->poolWorker(0UZ, _executionOrder);
         } else { // run on processing thread pool
             [[maybe_unused]] const auto pe           = _profilerHandler->startCompleteEvent("scheduler_base.runOnPool");
             auto                        jobListsCopy = _executionOrder;
+            planRunnerPlacement(_executionOrder->size());
             for (std::size_t runnerID = 0UZ; runnerID < _executionOrder->size(); runnerID++) {
                 _pool->execute([this, runnerID, jobListsCopy]() { static_cast<Derived*>(this)->poolWorker(runnerID, jobListsCopy); });
             }
@@ -526,6 +653,8 @@ protected:
         nRunningJobs->incrementAndGet();
         nRunningJobs->notify_all();
         gr::thread_pool::thread::setThreadName(std::format("pW{}-{}", runnerID, gr::meta::shorten_type_name(this->unique_name)));
+        const std::vector<bool> poolAffinity = pinRunner(runnerID);
+        const auto              poolScheduling = applyRunnerPolicy();
 
         [[maybe_unused]] auto profiler_handler = _profiler.forThisThread();
 
@@ -539,6 +668,7 @@ protected:
         }
 
         [[maybe_unused]] auto currentProgress    = this->_graph.progress().value();
+        std::size_t           localPlanEpoch     = _planEpoch.load(std::memory_order_acquire);
         std::size_t           inactiveCycleCount = 0UZ;
         std::size_t           msgToCount         = 0UZ;
         auto                  activeState        = this->state();
@@ -561,6 +691,12 @@ protected:
 
                 adoptBlocks(runnerID, localBlockList);
 
+                // sample boundary: none of the local blocks is inside 'work(..)' -> switch to a newly published execution plan
+                if (const std::size_t epoch = _planEpoch.load(std::memory_order_acquire); epoch != localPlanEpoch) {
+                    applyPlanUpdates(runnerID, localBlockList, epoch);
+                    localPlanEpoch = epoch;
+                }
+
                 std::ranges::for_each(localBlockList, &BlockModel::processScheduledMessages);
                 activeState = this->state();
                 msgToCount++;
@@ -606,10 +742,140 @@ protected:
                 }
             }
         } while (lifecycle::isActive(activeState));
+        acknowledgePlanEpoch(runnerID, std::numeric_limits<std::size_t>::max()); // this runner holds no further references to retired blocks
+        if (!poolAffinity.empty()) { // pool threads are shared -> restore the pool's affinity
+            this->emitErrorMessageIfAny("poolWorker -> restore affinity", setRunnerAffinity(poolAffinity));
+        }
+        if (poolScheduling.has_value()) { // ditto for the OS scheduling policy
+            this->emitErrorMessageIfAny("poolWorker -> restore policy", setRunnerPolicy(poolScheduling->policy, poolScheduling->priority));
+        }
         std::ignore = nRunningJobs->subAndGet(1UZ);
         nRunningJobs->notify_all();
     }
 
+    void planRunnerPlacement(std::size_t nRunners) {
+        _runnerCpus.clear();
+        if (!pin_runners) {
+            return;
+        }
+        const auto placement = gr::thread_pool::thread::planPlacement(gr::thread_pool::thread::CpuTopology::read(), nRunners);
+        _runnerCpus          = placement.runnerCpus;
+        if (auto* ioPool = dynamic_cast<gr::thread_pool::ThreadPoolWrapper*>(gr::thread_pool::Manager::defaultIoPool().get()); ioPool != nullptr && !placement.ioMask.empty() && _nIoPoolCpus == 0UZ) {
+            try {
+                detail::SharedIoPoolAffinity::instance().acquire(ioPool->impl(), placement.ioMask); // N.B. the default IO pool is shared -> restored in stop()
+                _nIoPoolCpus = placement.ioMask.size();
+            } catch (const std::system_error& e) {
+                this->emitErrorMessage("start() -> IO pool affinity", Error(e));
+            }
+        }
+    }
+
+    void restoreMemoryProfile() {
+        if (!_memoryLocked) {
+            return;
+        }
+        try {
+            detail::SharedMemoryLock::instance().release();
+        } catch (const std::system_error& e) {
+            this->emitErrorMessage("stop() -> unlock memory", Error(e));
+        }
+        _memoryLocked = false;
+    }
+
+    void restoreIoPoolAffinity() {
+        if (_nIoPoolCpus == 0UZ) {
+            return;
+        }
+        if (auto* ioPool = dynamic_cast<gr::thread_pool::ThreadPoolWrapper*>(gr::thread_pool::Manager::defaultIoPool().get()); ioPool != nullptr) {
+            try {
+                detail::SharedIoPoolAffinity::instance().release(ioPool->impl(), _nIoPoolCpus);
+            } catch (const std::system_error& e) {
+                this->emitErrorMessage("stop() -> restore IO pool affinity", Error(e));
+            }
+        }
+        _nIoPoolCpus = 0UZ;
+    }
+
+    [[nodiscard]] static std::expected<void, Error> setRunnerAffinity(const std::vector<bool>& affinityMask) noexcept {
+        try {
+            gr::thread_pool::thread::setThreadAffinity(affinityMask);
+        } catch (const std::system_error& e) {
+            return std::unexpected(Error(e));
+        }
+        return {};
+    }
+
+    /// @return the thread's previous affinity mask if the runner has been pinned (empty otherwise)
+    std::vector<bool> pinRunner(std::size_t runnerID) noexcept {
+        if (runnerID >= _runnerCpus.size()) {
+            return {};
+        }
+        std::vector<bool> poolAffinity;
+        try {
+            poolAffinity = gr::thread_pool::thread::getThreadAffinity();
+        } catch (const std::system_error& e) {
+            this->emitErrorMessage("poolWorker -> pin runner", Error(e));
+            return {};
+        }
+        if (auto pinned = setRunnerAffinity(gr::thread_pool::thread::cpuMask(_runnerCpus[runnerID])); !pinned) {
+            this->emitErrorMessageIfAny("poolWorker -> pin runner", pinned);
+            return {};
+        }
+        return poolAffinity;
+    }
+
+    void applyMemoryProfile() {
+        if (lock_memory && !_memoryLocked) {
+            try {
+                detail::SharedMemoryLock::instance().acquire(); // N.B. process-wide -> unlocked once the last locking scheduler stopped
+                _memoryLocked = true;
+            } catch (const std::system_error& e) {
+                this->emitErrorMessage("start() -> lock_memory", Error(e));
+            }
+        }
+        if (prefault_buffers) {
+            [[maybe_unused]] const auto pe = _profilerHandler->startCompleteEvent("scheduler_base.prefault");
+            graph::forEachBlock<TransparentBlockGroup>(_graph, [](auto& block) { std::ignore = block->prefaultBuffers(); });
+        }
+    }
+
+    [[nodiscard]] static std::expected<void, Error> setRunnerPolicy(gr::thread_pool::thread::Policy policy, int priority) noexcept {
+        try {
+            gr::thread_pool::thread::setThreadSchedulingParameter(policy, priority);
+        } catch (const std::system_error& e) {
+            return std::unexpected(Error(e));
+        }
+        return {};
+    }
+
+    /// @return the thread's previous scheduling parameter if 'runner_policy' has been applied (nullopt otherwise)
+    std::optional<gr::thread_pool::thread::SchedulingParameter> applyRunnerPolicy() noexcept {
+        using gr::thread_pool::thread::Policy;
+        const auto policy = magic_enum::enum_cast<Policy>(std::string_view(runner_policy.value));
+        if (!policy.has_value() || *policy == Policy::UNKNOWN) {
+            this->emitErrorMessage("poolWorker -> runner_policy", std::format("unknown policy '{}', expected one of: OTHER, FIFO, ROUND_ROBIN", runner_policy.value));
+            return std::nullopt;
+        }
+        if (*policy == Policy::OTHER && runner_priority.value == 0) {
+            return std::nullopt; // default -> keep the pool's setting
+        }
+        gr::thread_pool::thread::SchedulingParameter poolScheduling{};
+        try {
+            poolScheduling = gr::thread_pool::thread::getThreadSchedulingParameter();
+        } catch (const std::system_error& e) {
+            this->emitErrorMessage("poolWorker -> runner_policy", Error(e));
+            return std::nullopt;
+        }
+        if (poolScheduling.policy == Policy::UNKNOWN) {
+            return std::nullopt; // cannot be restored (e.g. SCHED_BATCH/IDLE set externally) -> leave untouched
+        }
+        if (auto applied = setRunnerPolicy(*policy, runner_priority.value); !applied) {
+            this->emitErrorMessageIfAny("poolWorker -> runner_policy", applied); // typically: missing CAP_SYS_NICE/rtprio limit
+            return std::nullopt;
+        }
+        return poolScheduling;
+    }
+
     void runWatchDog(std::size_t timeOut_ms, std::size_t timeOut_count) {
         on_scope_exit _ = [this] { _nWatchdogsRunning.fetch_sub(1, std::memory_order_acq_rel); };
 
@@ -658,6 +924,8 @@ protected:
         });
 
         this->emitErrorMessageIfAny("stop() -> LifecycleState ->STOPPED", this->changeStateTo(STOPPED));
+        restoreIoPoolAffinity();
+        restoreMemoryProfile();
         if constexpr (requires(Derived& d) { d.customStop(); }) {
             static_cast<Derived*>(this)->customStop();
         }
@@ -874,6 +1142,143 @@ protected:
         newBlocks.clear();
     }
 
+    /*
+      Live block replacement (read-copy-update):
+
+      - read/copy:  propertyCallbackReplaceBlock() instantiates and initialises the new block, checks that all live connections
+                    of the old block can be taken over, re-targets the graph edges and publishes a copy of the execution plan
+                    with the new block in place of the old one together with an incremented plan epoch.
+      - update:     the runner owning the old block observes the new epoch at its next sample boundary (i.e. in between two
+                    'work(..)' calls) and hands over all stream connections -- buffer readers/writers incl. their read/write
+                    positions, unconsumed samples and pending tags -- to the new block, which replaces the old one in its local
+                    block list. Upstream and downstream blocks keep operating on the very same buffers, hence no sample is dropped
+                    or duplicated and no buffer is drained.
+      - reclaim:    once every runner has acknowledged the epoch (grace period), the old block is stopped and released.
+    */
+    static void checkReplacementPorts(BlockModel& oldBlock, BlockModel& newBlock) {
+        const auto check = [&oldBlock, &newBlock](DynamicPort& oldPort, DynamicPort* newPort) {
+            if (oldPort.isConnected() && (newPort == nullptr || !oldPort.isSwappableWith(*newPort))) {
+                throw gr::exception(std::format("cannot replace {}: connected port '{}' has no compatible counterpart in {}", oldBlock.uniqueName(), oldPort.name, newBlock.typeName()));
+            }
+        };
+        detail::forEachCounterpartPort(oldBlock.dynamicInputPorts(), newBlock.dynamicInputPorts(), check);
+        detail::forEachCounterpartPort(oldBlock.dynamicOutputPorts(), newBlock.dynamicOutputPorts(), check);
+    }
+
+    static void handOverConnections(BlockModel& oldBlock, BlockModel& newBlock) {
+        const auto handOver = [](DynamicPort& oldPort, DynamicPort* newPort) {
+            if (newPort != nullptr && oldPort.isConnected()) {
+                std::ignore = newPort->swapConnection(oldPort);
+            }
+        };
+        detail::forEachCounterpartPort(oldBlock.dynamicInputPorts(), newBlock.dynamicInputPorts(), handOver);
+        detail::forEachCounterpartPort(oldBlock.dynamicOutputPorts(), newBlock.dynamicOutputPorts(), handOver);
+    }
+
+    void retireBlock(const std::shared_ptr<BlockModel>& block) {
+        using enum lifecycle::State;
+        const auto disconnectAll = [](BlockModel::DynamicPorts& ports) {
+            for (auto& entry : ports) {
+                std::ignore = std::visit([](auto& portOrCollection) { return portOrCollection.disconnect(); }, entry);
+            }
+        };
+        disconnectAll(block->dynamicInputPorts()); // N.B. holds only the replacement's unused handlers once the connections were handed over
+        disconnectAll(block->dynamicOutputPorts());
+
+        switch (block->state()) {
+        case REQUESTED_PAUSE: this->emitErrorMessageIfAny("retireBlock -> PAUSED", block->changeStateTo(PAUSED)); [[fallthrough]];
+        case RUNNING:
+        case PAUSED: this->emitErrorMessageIfAny("retireBlock -> REQUESTED_STOP", block->changeStateTo(REQUESTED_STOP)); [[fallthrough]];
+        case IDLE:
+        case INITIALISED:
+        case REQUESTED_STOP: this->emitErrorMessageIfAny("retireBlock -> STOPPED", block->changeStateTo(STOPPED)); break;
+        case STOPPED:
+        case ERROR: break;
+        }
+    }
+
+    void resetPlanUpdates(std::size_t nRunners) {
+        std::lock_guard guard(_planUpdatesMutex);
+        for (const PlanUpdate& update : _planUpdates) { // left-overs of a previous run: the plan and the graph edges already refer to the new blocks
+            retireBlock(update.oldBlock);
+        }
+        _planUpdates.clear();
+        _runnerPlanEpochs.assign(nRunners, _planEpoch.load(std::memory_order_acquire));
+    }
+
+    void applyPlanUpdates(std::size_t runnerID, std::vector<std::shared_ptr<BlockModel>>& localBlockList, std::size_t epoch) {
+        using enum lifecycle::State;
+        {
+            std::lock_guard guard(_planUpdatesMutex);
+            for (PlanUpdate& update : _planUpdates) {
+                auto localBlockIt = std::ranges::find(localBlockList, update.oldBlock);
+                if (update.handedOver || localBlockIt == localBlockList.end()) {
+                    continue;
+                }
+                handOverConnections(*update.oldBlock, *update.newBlock);
+                this->emitErrorMessageIfAny("applyPlanUpdates -> RUNNING", update.newBlock->changeStateTo(RUNNING));
+                *localBlockIt     = update.newBlock;
+                update.handedOver = true;
+            }
+        }
+        acknowledgePlanEpoch(runnerID, epoch);
+    }
+
+    void acknowledgePlanEpoch(std::size_t runnerID, std::size_t epoch) {
+        std::lock_guard guard(_planUpdatesMutex);
+        if (runnerID < _runnerPlanEpochs.size()) {
+            _runnerPlanEpochs[runnerID] = epoch;
+        }
+        const std::size_t graceEpoch = _runnerPlanEpochs.empty() ? std::numeric_limits<std::size_t>::max() : std::ranges::min(_runnerPlanEpochs);
+        std::erase_if(_planUpdates, [this, graceEpoch](const PlanUpdate& update) {
+            if (!update.handedOver || update.epoch > graceEpoch) {
+                return false; // some runner may still refer to the old plan
+            }
+            retireBlock(update.oldBlock);
+            return true;
+        });
+    }
+
+    void publishBlockReplacement(std::shared_ptr<BlockModel> oldBlock, std::shared_ptr<BlockModel> newBlock) {
+        using enum lifecycle::State;
+        // off the hot path: initialise the new block and connect its message ports while the old block keeps processing
+        if (newBlock->state() == IDLE) {
+            this->emitErrorMessageIfAny("publishBlockReplacement -> INITIALISED", newBlock->changeStateTo(INITIALISED));
+        }
+        if (ConnectionResult::SUCCESS != _toChildMessagePort.connect(*newBlock->msgIn)) {
+            this->emitErrorMessage("publishBlockReplacement", std::format("Failed to connect scheduler input message port to child '{}'", newBlock->uniqueName()));
+        }
+        auto toSchedulerBuffer = _fromChildMessagePort.buffer();
+        newBlock->msgOut->setBuffer(toSchedulerBuffer.streamBuffer, toSchedulerBuffer.tagBuffer);
+
+        {
+            std::lock_guard lock(_executionOrderMutex);
+            auto            plan = std::make_shared<JobLists>(*_executionOrder);
+            for (auto& jobList : *plan) {
+                std::ranges::replace(jobList, oldBlock, newBlock);
+            }
+            _executionOrder = std::move(plan);
+        }
+
+        {
+            std::lock_guard guard(_adoptionBlocksMutex); // not yet adopted by any runner -> nobody processes it, swap immediately
+            for (std::vector<std::shared_ptr<BlockModel>>& adoptionList : _adoptionBlocks) {
+                if (auto it = std::ranges::find(adoptionList, oldBlock); it != adoptionList.end()) {
+                    handOverConnections(*oldBlock, *newBlock);
+                    this->emitErrorMessageIfAny("publishBlockReplacement -> RUNNING", newBlock->changeStateTo(RUNNING));
+                    *it = newBlock;
+                    retireBlock(oldBlock);
+                    return;
+                }
+            }
+        }
+
+        std::lock_guard   guard(_planUpdatesMutex);
+        const std::size_t epoch = _planEpoch.load(std::memory_order_relaxed) + 1UZ;
+        _planUpdates.push_back(PlanUpdate{.epoch = epoch, .oldBlock = std::move(oldBlock), .newBlock = std::move(newBlock)});
+        _planEpoch.store(epoch, std::memory_order_release);
+    }
+
     /*
       Moves a block to the zombie list:
 
@@ -943,13 +1348,27 @@ protected:
 
         auto& pluginLoader = gr::globalPluginLoader();
         if (message.cmd == message::Command::Get) {
-            message.data = property_map{{"value", gr::saveGrc(pluginLoader, _graph)}};
+            const bool binaryFormat = [&message] { // optional request {"format": "binary"} -> reply with the compact binary encoding
+                if (!message.data.has_value()) {
+                    return false;
+                }
+                const auto  it     = message.data->find("format"s);
+                const auto* format = it != message.data->end() ? std::get_if<std::string>(&it->second) : nullptr;
+                return format != nullptr && *format == "binary";
+            }();
+            if (binaryFormat) {
+                message.data = property_map{{"value", gr::saveGrcBinary(pluginLoader, _graph)}};
+            } else {
+                message.data = property_map{{"value", gr::saveGrc(pluginLoader, _graph)}};
+            }
         } else if (message.cmd == message::Command::Set) {
-            const auto& data        = message.data.value();
-            auto        yamlContent = std::get<std::string>(data.at("value"s));
+            const auto& data  = message.data.value();
+            const auto& value = data.at("value"s);
 
             try {
-                Graph newGraph = gr::loadGrc(pluginLoader, yamlContent);
+                Graph newGraph = std::holds_alternative<std::vector<std::uint8_t>>(value) //
+                                     ? gr::loadGrc(pluginLoader, std::span<const std::uint8_t>(std::get<std::vector<std::uint8_t>>(value)))
+                                     : gr::loadGrc(pluginLoader, std::get<std::string>(value));
 
                 makeAllZombies();
 
@@ -972,6 +1391,54 @@ protected:
         return message;
     }
 
+    std::optional<Message> propertyCallbackBlockMetrics([[maybe_unused]] std::string_view propertyName, Message message) {
+        assert(propertyName == scheduler::property::kBlockMetrics);
+        if (message.cmd != message::Command::Get) {
+            throw gr::exception(std::format("scheduler {} property {} does not implement command {}, msg: {}", this->unique_name, propertyName, message.cmd, message));
+        }
+        message.data = blockMetrics();
+        return message;
+    }
+
+    void sampleBottleneckAnalyser(bool force = false) {
+        const auto now = std::chrono::steady_clock::now();
+        if (!force && (bottleneck_sample_period.value == 0U || now - _lastBottleneckSample < std::chrono::milliseconds(bottleneck_sample_period.value))) {
+            return;
+        }
+        _lastBottleneckSample = now;
+        _bottleneckAnalyser.sample(blockMetrics());
+
+        if (const auto loads = _bottleneckAnalyser.analyse(); !loads.empty() && loads.front().name != _lastBottleneck) {
+            _lastBottleneck = loads.front().name;
+            this->notifyListeners(scheduler::property::kBottleneck, _bottleneckAnalyser.toPropertyMap());
+        }
+    }
+
+    std::optional<Message> propertyCallbackBottleneck(std::string_view propertyName, Message message) {
+        using enum gr::message::Command;
+        assert(propertyName == scheduler::property::kBottleneck);
+
+        if (message.cmd == Set) { // any 'Set' resets the sampling window
+            _bottleneckAnalyser.reset();
+            _lastBottleneck.clear();
+            return std::nullopt;
+        } else if (message.cmd == Get) {
+            sampleBottleneckAnalyser(bottleneck_sample_period.value == 0U || _bottleneckAnalyser.nSamples() == 0UZ); // on-request sampling if not periodically sampled
+            message.data = _bottleneckAnalyser.toPropertyMap();
+            return message;
+        } else if (message.cmd == Subscribe) {
+            if (!message.clientRequestID.empty()) {
+                this->propertySubscriptions[std::string(propertyName)].insert(message.clientRequestID);
+            }
+            return std::nullopt;
+        } else if (message.cmd == Unsubscribe) {
+            this->propertySubscriptions[std::string(propertyName)].erase(message.clientRequestID);
+            return std::nullopt;
+        }
+
+        throw gr::exception(std::format("scheduler {} property {} does not implement command {}, msg: {}", this->unique_name, propertyName, message.cmd, message));
+    }
+
     std::optional<Message> propertyCallbackReplaceBlock([[maybe_unused]] std::string_view propertyName, Message message) {
         assert(propertyName == scheduler::property::kReplaceBlock);
         using namespace std::string_literals;
@@ -986,8 +1453,30 @@ protected:
             }
         }();
 
-        auto [oldBlock, newBlockRaw] = _graph.replaceBlock(uniqueName, type, properties);
-        makeZombie(std::move(oldBlock));
+        const auto oldIt = std::ranges::find_if(_graph.blocks(), [&uniqueName](const auto& block) { return block->uniqueName() == uniqueName; });
+        if (oldIt == _graph.blocks().end()) {
+            throw gr::exception(std::format("Block {} was not found in {}", uniqueName, _graph.unique_name));
+        }
+        auto newBlock = gr::globalPluginLoader().instantiate(type, properties);
+        if (!newBlock) {
+            throw gr::exception(std::format("Can not create block {}", type));
+        }
+        checkReplacementPorts(**oldIt, *newBlock); // before modifying the graph: either the replacement succeeds or nothing changes
+
+        auto [oldBlock, newBlockRaw] = _graph.replaceBlock(uniqueName, std::move(newBlock));
+        if (lifecycle::isActive(this->state())) {
+            publishBlockReplacement(std::move(oldBlock), newBlockRaw);
+        } else if (_nRunningJobs->value() == 0UZ) { // no runners: the edges are (re-)connected to the new block on start()
+            {
+                std::lock_guard lock(_executionOrderMutex);
+                for (auto& jobList : *_executionOrder) {
+                    std::ranges::replace(jobList, oldBlock, newBlockRaw);
+                }
+            }
+            retireBlock(oldBlock);
+        } else { // shutting down: let the runners clean up the old block
+            makeZombie(std::move(oldBlock));
+        }
 
         std::optional<Message> result = gr::Message{};
         result->endpoint              = scheduler::property::kBlockReplaced;
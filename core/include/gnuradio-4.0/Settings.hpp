@@ -1,12 +1,18 @@
 #ifndef GNURADIO_SETTINGS_HPP
 #define GNURADIO_SETTINGS_HPP
 
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <bit>
 #include <chrono>
 #include <concepts>
+#include <cstdint>
+#include <limits>
 #include <mutex>
 #include <optional>
 #include <set>
+#include <string_view>
 #include <variant>
 
 #include <pmtv/base64/base64.h>
@@ -54,6 +60,118 @@ constexpr bool isWritableMember() {
     return isReadableMember<T>() && !std::is_const_v<T> && !std::is_const_v<TMember>;
 }
 
+/**
+ * @brief compile-time (near-)perfect hash of a fixed set of non-empty keys, mapping each key to an associated index.
+ *
+ * The seed is searched at compile-time such that the keys land in distinct slots of an open-addressing table that is
+ * at least four times larger than the number of keys. Should no collision-free seed be found within 'kMaxSeeds'
+ * attempts, the seed with the shortest linear-probing sequence is used, i.e. look-ups remain correct but may need
+ * a few additional (integer/length) comparisons. A look-up of a non-member key costs one hash and typically one
+ * length comparison.
+ */
+template<std::size_t N>
+class StaticKeyIndex {
+public:
+    static constexpr std::size_t kCapacity = std::bit_ceil(std::max(4UZ * N, 1UZ));
+    static constexpr std::size_t kMaxSeeds = 256UZ;
+
+private:
+    struct Slot {
+        std::string_view key{};
+        std::size_t      index = 0UZ;
+    };
+    std::array<Slot, kCapacity> _slots{};
+    std::uint64_t               _seed     = 0U;
+    std::size_t                 _maxProbe = 0UZ;
+
+    static constexpr std::size_t fill(std::array<Slot, kCapacity>& slots, const std::array<std::string_view, N>& keys, const std::array<std::size_t, N>& indices, std::uint64_t seed) {
+        std::size_t maxProbe = 0UZ;
+        for (std::size_t i = 0UZ; i < N; ++i) {
+            std::size_t pos   = hash(keys[i], seed) & (kCapacity - 1UZ);
+            std::size_t probe = 0UZ;
+            while (!slots[pos].key.empty()) {
+                pos = (pos + 1UZ) & (kCapacity - 1UZ);
+                ++probe;
+            }
+            slots[pos] = Slot{keys[i], indices[i]};
+            maxProbe   = std::max(maxProbe, probe);
+        }
+        return maxProbe;
+    }
+
+public:
+    [[nodiscard]] static constexpr std::uint64_t hash(std::string_view key, std::uint64_t seed) noexcept { // FNV-1a
+        std::uint64_t h = 0xcbf29ce484222325ULL ^ (seed * 0x9e3779b97f4a7c15ULL);
+        for (const char c : key) {
+            h ^= static_cast<std::uint8_t>(c);
+            h *= 0x100000001b3ULL;
+        }
+        return h ^ (h >> 32U);
+    }
+
+    constexpr StaticKeyIndex(const std::array<std::string_view, N>& keys, const std::array<std::size_t, N>& indices) {
+        std::size_t   bestProbe = std::numeric_limits<std::size_t>::max();
+        std::uint64_t bestSeed  = 0U;
+        for (std::uint64_t seed = 0U; seed < kMaxSeeds && bestProbe > 0UZ; ++seed) {
+            std::array<Slot, kCapacity> trial{};
+            if (const std::size_t probe = fill(trial, keys, indices, seed); probe < bestProbe) {
+                bestProbe = probe;
+                bestSeed  = seed;
+            }
+        }
+        _seed     = bestSeed;
+        _maxProbe = fill(_slots, keys, indices, _seed);
+    }
+
+    [[nodiscard]] constexpr std::optional<std::size_t> find(std::string_view key) const noexcept {
+        if constexpr (N == 0UZ) {
+            return std::nullopt;
+        } else {
+            std::size_t pos = hash(key, _seed) & (kCapacity - 1UZ);
+            for (std::size_t probe = 0UZ; probe <= _maxProbe; ++probe) {
+                const Slot& slot = _slots[pos];
+                if (slot.key.empty()) {
+                    return std::nullopt;
+                }
+                if (slot.key.size() == key.size() && slot.key == key) {
+                    return slot.index;
+                }
+                pos = (pos + 1UZ) & (kCapacity - 1UZ);
+            }
+            return std::nullopt;
+        }
+    }
+
+    [[nodiscard]] constexpr bool        contains(std::string_view key) const noexcept { return find(key).has_value(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return N; }
+    [[nodiscard]] constexpr std::size_t maxProbe() const noexcept { return _maxProbe; }
+};
+
+template<typename TBlock, std::size_t Idx>
+constexpr bool isWritableMemberAt() {
+    using MemberType = refl::data_member_type<TBlock, Idx>;
+    return isWritableMember<unwrap_if_wrapped_t<std::remove_cvref_t<MemberType>>, MemberType>();
+}
+
+/// compile-time key index of all `isWritableMember` class members of 'TBlock' (-> reflection member index)
+template<typename TBlock>
+inline constexpr auto writableMemberKeys = []<std::size_t... Is>(std::index_sequence<Is...>) {
+    constexpr std::size_t                   nWritable = (0UZ + ... + static_cast<std::size_t>(isWritableMemberAt<TBlock, Is>()));
+    std::array<std::string_view, nWritable> names{};
+    std::array<std::size_t, nWritable>      indices{};
+    std::size_t                             i = 0UZ;
+    (
+        [&] {
+            if constexpr (isWritableMemberAt<TBlock, Is>()) {
+                names[i]   = refl::data_member_name<TBlock, Is>.view();
+                indices[i] = Is;
+                ++i;
+            }
+        }(),
+        ...);
+    return StaticKeyIndex<nWritable>(names, indices);
+}(std::make_index_sequence<refl::data_member_count<TBlock>>());
+
 inline constexpr uint64_t convertTimePointToUint64Ns(const std::chrono::time_point<std::chrono::system_clock>& tp) {
     const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch()).count();
     return static_cast<uint64_t>(ns);
@@ -691,6 +809,9 @@ public:
 
     NO_INLINE void autoUpdate(const Tag& tag) override {
         if constexpr (refl::reflectable<TBlock>) {
+            if (!_changed.load(std::memory_order_acquire) && !mayAutoUpdate(tag)) {
+                return; // fast path: no context and no writable member key in tag, nothing staged -> nothing to update or clear (lock-free)
+            }
             std::lock_guard lg(_mutex);
             const auto      tagCtx = createSettingsCtxFromTag(tag);
 
@@ -716,17 +837,24 @@ public:
             const property_map& parameters = tag.map;
             bool                wasChanged = false;
             for (const auto& [key, value] : parameters) {
+                const std::optional<std::size_t> memberIdx = settings::writableMemberKeys<TBlock>.find(key); // O(1) instead of comparing against all member names
+                if (!memberIdx || !autoUpdateParameters->second.contains(key)) {
+                    continue;
+                }
                 refl::for_each_data_member_index<TBlock>([&](auto kIdx) {
                     using MemberType = refl::data_member_type<TBlock, kIdx>;
                     using Type       = unwrap_if_wrapped_t<std::remove_cvref_t<MemberType>>;
                     if constexpr (settings::isWritableMember<Type, MemberType>()) {
+                        if (kIdx != *memberIdx) {
+                            return;
+                        }
                         if constexpr (std::is_enum_v<Type>) {
-                            if (refl::data_member_name<TBlock, kIdx>.view() == key && autoUpdateParameters->second.contains(key) && std::holds_alternative<std::string>(value)) {
+                            if (std::holds_alternative<std::string>(value)) {
                                 _stagedParameters.insert_or_assign(key, value);
                                 wasChanged = true;
                             }
                         } else {
-                            if (refl::data_member_name<TBlock, kIdx>.view() == key && autoUpdateParameters->second.contains(key) && std::holds_alternative<Type>(value)) {
+                            if (std::holds_alternative<Type>(value)) {
                                 _stagedParameters.insert_or_assign(key, value);
                                 wasChanged = true;
                             }
@@ -1164,6 +1292,11 @@ private:
         }
     }
 
+    /// @return false if 'tag' can neither switch the context nor update any (writable) setting of 'TBlock'
+    [[nodiscard]] static bool mayAutoUpdate(const Tag& tag) noexcept {
+        return std::ranges::any_of(tag.map, [](const auto& keyValue) { return keyValue.first == gr::tag::CONTEXT.shortKey() || settings::writableMemberKeys<TBlock>.contains(keyValue.first); });
+    }
+
     [[nodiscard]] NO_INLINE std::optional<std::string> contextInTag(const Tag& tag) const {
         if (tag.map.contains(gr::tag::CONTEXT.shortKey())) {
             const pmtv::pmt& ctxInfo = tag.map.at(std::string(gr::tag::CONTEXT.shortKey()));
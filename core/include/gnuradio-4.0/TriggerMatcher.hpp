@@ -135,32 +135,39 @@ inline void reset(property_map& state) noexcept {
     }
 }
 
-inline void verifyFilterState(std::string_view matchCriteria, property_map& state) {
-    using namespace std::string_literals;
-    using namespace gr::trigger::detail;
-    if (state.contains(key::kFilter) && std::holds_alternative<std::string>(state.at(key::kFilter)) && (std::get<std::string>(state.at(key::kFilter)) == matchCriteria)) {
-        return;
-    }
+/// one '[^]<trigger name>/[^]<ctx>' end of the '[<start>, <stop>]' match criteria
+struct Criterion {
+    std::string triggerName{};
+    std::string ctx{};
+    bool        triggerNameEnds = false; ///< '^' prefix: match on the first tag after the one matching the trigger name
+    bool        ctxEnds         = false; ///< '^' prefix: match on the first tag after the one matching the context
+
+    [[nodiscard]] constexpr bool waitsForNonMatch() const noexcept { return triggerNameEnds || ctxEnds; }
+};
+
+/// parsed '[<start>, <stop>]' match criteria
+struct Criteria {
+    Criterion start{};
+    Criterion stop{};
+    bool      startDefined = false;
+    bool      stopDefined  = false;
 
-    state[key::kFilter] = std::string(matchCriteria);
+    [[nodiscard]] constexpr bool isSingleTrigger() const noexcept { return startDefined xor stopDefined; }
+};
 
-    // default config
-    state[key::kStartDefined]         = false;
-    state[key::kStopDefined]          = false;
-    state[key::kStartTriggerName]     = ""s;
-    state[key::kStartCtx]             = ""s;
-    state[key::kStopTriggerName]      = ""s;
-    state[key::kStopCtx]              = ""s;
-    state[key::kStartTriggerNameEnds] = false;
-    state[key::kStartCtxEnds]         = false;
-    state[key::kStopTriggerNameEnds]  = false;
-    state[key::kStopCtxEnds]          = false;
+/// runtime state of the matcher, e.g. one per concurrently open acquisition window
+struct State {
+    bool triggerActive           = false;
+    bool waitingForStartNonMatch = false;
+    bool waitingForStopNonMatch  = false;
 
-    // reset state
-    reset(state);
+    constexpr void reset() noexcept { *this = State{}; }
+};
 
+[[nodiscard]] inline Criteria parseCriteria(std::string_view matchCriteria) {
+    Criteria result;
     if (matchCriteria.empty()) {
-        return;
+        return result;
     }
     std::string_view criteria = matchCriteria;
     if ((criteria.front() == '[') && (criteria.back() == ']')) { // strip surrounding brackets if needed
@@ -179,104 +186,141 @@ inline void verifyFilterState(std::string_view matchCriteria, property_map& stat
     }
 
     if (!startPart.empty()) {
-        detail::parse(startPart, std::get<std::string>(state[key::kStartTriggerName]), std::get<bool>(state[key::kStartTriggerNameEnds]), std::get<std::string>(state[key::kStartCtx]), std::get<bool>(state[key::kStartCtxEnds]));
-        state[key::kStartDefined] = true;
-    } else {
-        state[key::kStartTriggerName] = ""s;
-        state[key::kStartCtx]         = ""s;
+        detail::parse(startPart, result.start.triggerName, result.start.triggerNameEnds, result.start.ctx, result.start.ctxEnds);
+        result.startDefined = true;
     }
-
     if (!stopPart.empty()) {
-        detail::parse(stopPart, std::get<std::string>(state[key::kStopTriggerName]), std::get<bool>(state[key::kStopTriggerNameEnds]), std::get<std::string>(state[key::kStopCtx]), std::get<bool>(state[key::kStopCtxEnds]));
-        state[key::kStopDefined] = true;
-    } else {
-        state[key::kStopTriggerName] = ""s;
-        state[key::kStopCtx]         = ""s;
+        detail::parse(stopPart, result.stop.triggerName, result.stop.triggerNameEnds, result.stop.ctx, result.stop.ctxEnds);
+        result.stopDefined = true;
     }
 
-    if (isSingleTrigger(state) && std::get<bool>(state[key::kStopDefined])) {
-        std::swap(state[key::kStartTriggerName], state[key::kStopTriggerName]);
-        std::swap(state[key::kStartCtx], state[key::kStopCtx]);
-        state[key::kStopTriggerName] = ""s;
-        state[key::kStopCtx]         = ""s;
+    if (result.isSingleTrigger() && result.stopDefined) { // single stop-only trigger acts as start trigger
+        std::swap(result.start.triggerName, result.stop.triggerName);
+        std::swap(result.start.ctx, result.stop.ctx);
+        result.stop.triggerName.clear();
+        result.stop.ctx.clear();
     }
 
-    if (std::get<std::string>(state[key::kStartTriggerName]) == std::get<std::string>(state[key::kStopTriggerName]) && std::get<std::string>(state[key::kStartCtx]) == std::get<std::string>(state[key::kStopCtx])) {
-        state[key::kStartDefined]    = true;
-        state[key::kStopDefined]     = false;
-        state[key::kStopTriggerName] = ""s;
-        state[key::kStopCtx]         = ""s;
+    if (result.start.triggerName == result.stop.triggerName && result.start.ctx == result.stop.ctx) { // identical (or both undefined) start and stop -> single trigger
+        result.startDefined = true;
+        result.stopDefined  = false;
+        result.stop.triggerName.clear();
+        result.stop.ctx.clear();
     }
-
-    state[key::kIsSingleTrigger] = bool(std::get<bool>(state.at(key::kStartDefined)) xor std::get<bool>(state.at(key::kStopDefined)));
+    return result;
 }
 
-[[nodiscard]] inline trigger::MatchResult filter(std::string_view filterDefinition, const Tag& tag, property_map& filterState) {
-    using namespace gr::trigger::detail;
-    verifyFilterState(filterDefinition, filterState); // N.B. automatically generates config and state variables if needed
-
-    const auto startDefined = std::get<bool>(filterState[key::kStartDefined]);
-    const auto stopDefined  = std::get<bool>(filterState[key::kStopDefined]);
-    if ((!startDefined && !stopDefined) || tag.map.empty()) {
-        return trigger::MatchResult::Ignore;
-    }
-    const auto triggerActive    = std::get<bool>(filterState[key::kTriggerActive]);
-    const auto startTriggerName = std::get<std::string>(filterState[key::kStartTriggerName]);
-    const auto startCtx         = std::get<std::string>(filterState[key::kStartCtx]);
-    const auto stopTriggerName  = std::get<std::string>(filterState[key::kStopTriggerName]);
-    const auto stopCtx          = std::get<std::string>(filterState[key::kStopCtx]);
-    /// std::println("filter {} -> '{}'/'{}' & '{}'/'{}'\nfilter state: {}", filterDefinition, startTriggerName, startCtx, stopTriggerName, stopCtx, filterState);
-
-    std::string triggerName;
-    std::string triggerCtx;
-    if (tag.map.contains(tag::TRIGGER_NAME.shortKey()) && std::holds_alternative<std::string>(tag.map.at(tag::TRIGGER_NAME.shortKey()))) {
-        triggerName = std::get<std::string>(tag.map.at(tag::TRIGGER_NAME.shortKey()));
-    }
-    if (tag.map.contains(tag::CONTEXT.shortKey()) && std::holds_alternative<std::string>(tag.map.at(tag::CONTEXT.shortKey()))) {
-        triggerCtx = std::get<std::string>(tag.map.at(tag::CONTEXT.shortKey()));
-    }
-
-    if (isSingleTrigger(filterState)) {
-        bool triggerMatch = startTriggerName.empty() || triggerName == startTriggerName;
-        bool contextMatch = startCtx.empty() || startCtx.contains(triggerCtx);
+/// the '[<start>, <stop>]' state machine shared by 'filter(...)' and 'Compiled'
+[[nodiscard]] constexpr trigger::MatchResult match(const Criteria& criteria, std::string_view triggerName, std::string_view triggerCtx, State& state) noexcept {
+    using enum trigger::MatchResult;
+    if (criteria.isSingleTrigger()) {
+        const bool triggerMatch = criteria.start.triggerName.empty() || triggerName == criteria.start.triggerName;
+        const bool contextMatch = criteria.start.ctx.empty() || std::string_view(criteria.start.ctx).contains(triggerCtx);
         if (triggerMatch && contextMatch) {
-            filterState[key::kWaitingForStartNonMatch] = std::get<bool>(filterState[key::kStartTriggerNameEnds]) || std::get<bool>(filterState[key::kStartCtxEnds]);
-            return MatchResult::Matching;
+            state.waitingForStartNonMatch = criteria.start.waitsForNonMatch();
+            return Matching;
         }
     }
 
-    if (startDefined && stopDefined) {
-        if (!triggerActive || std::get<bool>(filterState[key::kWaitingForStartNonMatch])) {
-            const bool triggerMatch = startTriggerName.empty() || triggerName == startTriggerName;
-            const bool contextMatch = startCtx.empty() || triggerCtx.contains(startCtx);
+    if (criteria.startDefined && criteria.stopDefined) {
+        if (!state.triggerActive || state.waitingForStartNonMatch) {
+            const bool triggerMatch = criteria.start.triggerName.empty() || triggerName == criteria.start.triggerName;
+            const bool contextMatch = criteria.start.ctx.empty() || triggerCtx.contains(criteria.start.ctx);
 
             if (triggerMatch && contextMatch) {
-                filterState[key::kTriggerActive]           = true;
-                filterState[key::kWaitingForStartNonMatch] = std::get<bool>(filterState[key::kStartTriggerNameEnds]) || std::get<bool>(filterState[key::kStartCtxEnds]);
-                return std::get<bool>(filterState[key::kWaitingForStartNonMatch]) ? MatchResult::Ignore : MatchResult::Matching;
-            } else if (std::get<bool>(filterState[key::kWaitingForStartNonMatch])) {
-                filterState[key::kWaitingForStartNonMatch] = false;
-                return MatchResult::Matching;
+                state.triggerActive           = true;
+                state.waitingForStartNonMatch = criteria.start.waitsForNonMatch();
+                return state.waitingForStartNonMatch ? Ignore : Matching;
+            } else if (state.waitingForStartNonMatch) {
+                state.waitingForStartNonMatch = false;
+                return Matching;
             }
         } else {
-            const bool triggerMatch = stopTriggerName.empty() || triggerName == stopTriggerName;
-            const bool contextMatch = stopCtx.empty() || triggerCtx.contains(stopCtx);
-
-            if ((triggerMatch && contextMatch) || std::get<bool>(filterState[key::kWaitingForStopNonMatch])) {
-                filterState[key::kWaitingForStopNonMatch] = std::get<bool>(filterState[key::kStopTriggerNameEnds]) || std::get<bool>(filterState[key::kStopCtxEnds]);
-                if (!std::get<bool>(filterState[key::kWaitingForStopNonMatch])) {
-                    reset(filterState);
-                    return MatchResult::NotMatching;
-                } else if (!triggerMatch || !contextMatch) {
-                    reset(filterState);
-                    return MatchResult::NotMatching;
+            const bool triggerMatch = criteria.stop.triggerName.empty() || triggerName == criteria.stop.triggerName;
+            const bool contextMatch = criteria.stop.ctx.empty() || triggerCtx.contains(criteria.stop.ctx);
+
+            if ((triggerMatch && contextMatch) || state.waitingForStopNonMatch) {
+                state.waitingForStopNonMatch = criteria.stop.waitsForNonMatch();
+                if (!state.waitingForStopNonMatch || !triggerMatch || !contextMatch) {
+                    state.reset();
+                    return NotMatching;
                 }
-                return MatchResult::Ignore;
+                return Ignore;
             }
         }
     }
+    return Ignore;
+}
 
-    return trigger::MatchResult::Ignore;
+/// trigger name and context of the tag, empty if absent or not a string
+[[nodiscard]] inline std::pair<std::string_view, std::string_view> triggerNameAndCtx(const Tag& tag) noexcept {
+    constexpr auto getString = [](const property_map& map, const char* key) -> std::string_view {
+        if (const auto it = map.find(key); it != map.end()) {
+            if (const auto* str = std::get_if<std::string>(&it->second)) {
+                return *str;
+            }
+        }
+        return {};
+    };
+    return {getString(tag.map, tag::TRIGGER_NAME.shortKey()), getString(tag.map, tag::CONTEXT.shortKey())};
+}
+
+inline void verifyFilterState(std::string_view matchCriteria, property_map& state) {
+    if (const auto it = state.find(key::kFilter); it != state.end()) {
+        if (const auto* filter = std::get_if<std::string>(&it->second); filter != nullptr && *filter == matchCriteria) {
+            return;
+        }
+    }
+
+    Criteria criteria = parseCriteria(matchCriteria);
+
+    state[key::kFilter]               = std::string(matchCriteria);
+    state[key::kStartDefined]         = criteria.startDefined;
+    state[key::kStopDefined]          = criteria.stopDefined;
+    state[key::kStartTriggerName]     = std::move(criteria.start.triggerName);
+    state[key::kStartCtx]             = std::move(criteria.start.ctx);
+    state[key::kStopTriggerName]      = std::move(criteria.stop.triggerName);
+    state[key::kStopCtx]              = std::move(criteria.stop.ctx);
+    state[key::kStartTriggerNameEnds] = criteria.start.triggerNameEnds;
+    state[key::kStartCtxEnds]         = criteria.start.ctxEnds;
+    state[key::kStopTriggerNameEnds]  = criteria.stop.triggerNameEnds;
+    state[key::kStopCtxEnds]          = criteria.stop.ctxEnds;
+    state[key::kIsSingleTrigger]      = criteria.isSingleTrigger();
+
+    // reset state
+    reset(state);
+}
+
+/**
+ * @brief generic 'Matcher' interface keeping the parsed criteria and the runtime state in a 'property_map'.
+ * N.B. every call re-validates the criteria and looks the state up by key -- for high tag rates prefer 'Compiled'.
+ */
+[[nodiscard]] inline trigger::MatchResult filter(std::string_view filterDefinition, const Tag& tag, property_map& filterState) {
+    verifyFilterState(filterDefinition, filterState); // N.B. automatically generates config and state variables if needed
+
+    const auto getBool      = [&filterState](const char* key) { return std::get<bool>(filterState.at(key)); };
+    const auto getString    = [&filterState](const char* key) { return std::get<std::string>(filterState.at(key)); };
+    const bool startDefined = getBool(key::kStartDefined);
+    const bool stopDefined  = getBool(key::kStopDefined);
+    if ((!startDefined && !stopDefined) || tag.map.empty()) {
+        return trigger::MatchResult::Ignore;
+    }
+
+    const Criteria criteria{
+        .start        = {.triggerName = getString(key::kStartTriggerName), .ctx = getString(key::kStartCtx), .triggerNameEnds = getBool(key::kStartTriggerNameEnds), .ctxEnds = getBool(key::kStartCtxEnds)},
+        .stop         = {.triggerName = getString(key::kStopTriggerName), .ctx = getString(key::kStopCtx), .triggerNameEnds = getBool(key::kStopTriggerNameEnds), .ctxEnds = getBool(key::kStopCtxEnds)},
+        .startDefined = startDefined,
+        .stopDefined  = stopDefined,
+    };
+    State state{.triggerActive = getBool(key::kTriggerActive), .waitingForStartNonMatch = getBool(key::kWaitingForStartNonMatch), .waitingForStopNonMatch = getBool(key::kWaitingForStopNonMatch)};
+
+    const auto [triggerName, triggerCtx] = triggerNameAndCtx(tag);
+    const trigger::MatchResult result    = match(criteria, triggerName, triggerCtx, state);
+
+    filterState[key::kTriggerActive]           = state.triggerActive;
+    filterState[key::kWaitingForStartNonMatch] = state.waitingForStartNonMatch;
+    filterState[key::kWaitingForStopNonMatch]  = state.waitingForStopNonMatch;
+    return result;
 }
 
 static_assert(Matcher<decltype(&filter)>);
@@ -287,6 +331,43 @@ struct Filter {
 
 static_assert(Matcher<Filter>);
 
+/**
+ * @brief '[<start>, <stop>]' match criteria compiled once into a typed matcher -- same syntax and semantics as 'filter(...)'.
+ *
+ * Matching a tag performs one lookup each for the trigger name and context and compares them against the pre-parsed criteria
+ * without any allocation. The runtime state is kept outside in a trivially copyable 'State', so that one compiled matcher can
+ * serve any number of concurrent acquisition windows.
+ *
+ * usage example:
+ * @code
+ * const Compiled matcher("[CMD_BP_START/FAIR.SELECTOR.C=1, CMD_BP_STOP/FAIR.SELECTOR.C=1]"); // throws gr::exception on ill-formed criteria
+ * State          state;
+ * for (const Tag& tag : tags) {
+ *     if (matcher(tag, state) == MatchResult::Matching) { ... }
+ * }
+ * @endcode
+ */
+class Compiled {
+    std::string _definition{};
+    Criteria    _criteria{};
+
+public:
+    Compiled() = default; // empty criteria: ignores all tags
+    explicit Compiled(std::string_view matchCriteria) : _definition(matchCriteria), _criteria(parseCriteria(matchCriteria)) {}
+
+    [[nodiscard]] constexpr std::string_view definition() const noexcept { return _definition; }
+    [[nodiscard]] constexpr const Criteria&  criteria() const noexcept { return _criteria; }
+    [[nodiscard]] constexpr bool             isSingleTrigger() const noexcept { return _criteria.isSingleTrigger(); }
+
+    [[nodiscard]] trigger::MatchResult operator()(const Tag& tag, State& state) const noexcept {
+        if ((!_criteria.startDefined && !_criteria.stopDefined) || tag.map.empty()) {
+            return trigger::MatchResult::Ignore;
+        }
+        const auto [triggerName, triggerCtx] = triggerNameAndCtx(tag);
+        return match(_criteria, triggerName, triggerCtx, state);
+    }
+};
+
 } // namespace BasicTriggerNameCtxMatcher
 
 } // namespace gr::trigger
@@ -254,8 +254,9 @@ struct ValueParseError {
 
 struct ParseContext {
     std::span<const std::string_view> lines;
-    std::size_t                       lineIdx   = 0;
-    std::size_t                       columnIdx = 0;
+    std::size_t                       lineIdx         = 0;
+    std::size_t                       columnIdx       = 0;
+    bool                              numericFastPath = true; // false: typed numeric sequences take the generic per-element path (e.g. for benchmarking)
 
     std::string_view currentLine() { return lineIdx < lines.size() ? lines[lineIdx] : std::string_view{}; }
 
@@ -930,6 +931,147 @@ struct ConvertList {
     }
 };
 
+// fast path for homogeneous typed numeric sequences (e.g. '!!float32' filter taps): parses the elements with
+// 'std::from_chars' directly into a pre-allocated 'std::vector<T>' instead of creating a 'pmt' per element.
+// Anything that is not a plain numeric element (nested collections, quotes, tags, keys, ...) returns 'std::nullopt'
+// without consuming input so that the generic parser handles (and reports errors for) the sequence unchanged.
+template<typename T>
+inline constexpr bool isFastNumeric = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+inline bool isPlainNumericToken(std::string_view token) {
+    token = trim(token);
+    if (token.empty()) {
+        return false;
+    }
+    constexpr std::string_view invalidFirst = "[{!\"'|>&*";
+    return invalidFirst.find(token.front()) == std::string_view::npos && !token.contains(':');
+}
+
+template<typename T>
+std::optional<T> parseNumericToken(std::string_view token) {
+    token = trim(token);
+    T value{};
+    if (const auto [ptr, ec] = std::from_chars(token.data(), token.data() + token.size(), value); ec == std::errc{} && ptr == token.data() + token.size()) {
+        return value;
+    }
+    if (const std::expected<T, ValueParseError> generic = parseAs<T>(token)) { // YAML specials ('.inf', '0x..', ...) and stof/stod leniency
+        return *generic;
+    }
+    return std::nullopt;
+}
+
+template<typename T>
+struct NumericBlockList {
+    std::optional<pmtv::pmt> operator()([[maybe_unused]] ParseContext& ctx, [[maybe_unused]] int parentIndentLevel) const {
+        if constexpr (!isFastNumeric<T>) {
+            return std::nullopt;
+        } else {
+            ParseContext probe = ctx;
+
+            std::size_t nEstimate = 0UZ; // upper bound: number of lines until the indentation drops back to the parent level
+            for (std::size_t idx = probe.lineIdx; idx < probe.lines.size(); ++idx) {
+                const std::size_t indent = probe.lines[idx].find_first_not_of(' ');
+                if (indent != std::string_view::npos && parentIndentLevel >= 0 && indent <= static_cast<std::size_t>(parentIndentLevel) && idx > probe.lineIdx) {
+                    break;
+                }
+                ++nEstimate;
+            }
+            std::vector<T> values;
+            values.reserve(nEstimate);
+
+            while (!probe.atEndOfDocument()) { // N.B. mirrors the control flow of 'parseList(..)'
+                probe.consumeWhitespaceAndComments();
+                if (probe.atEndOfDocument()) {
+                    break;
+                }
+                if (isIgnorableLine(probe.currentLine())) {
+                    probe.skipToNextLine();
+                    continue;
+                }
+                const std::size_t lineIndent = probe.currentIndent();
+                if (lineIndent == std::string_view::npos) {
+                    probe.skipToNextLine();
+                    continue;
+                }
+                if (parentIndentLevel >= 0 && lineIndent <= static_cast<std::size_t>(parentIndentLevel)) {
+                    break;
+                }
+                if (!probe.consumeIfStartsWith('-')) {
+                    return std::nullopt;
+                }
+                probe.consumeSpaces();
+
+                const std::string_view token = stripComment(probe.remainingLine());
+                if (!isPlainNumericToken(token)) {
+                    return std::nullopt;
+                }
+                const std::optional<T> value = parseNumericToken<T>(token);
+                if (!value) {
+                    return std::nullopt;
+                }
+                values.push_back(*value);
+                probe.skipToNextLine();
+            }
+            ctx = probe;
+            return pmtv::pmt(std::move(values));
+        }
+    }
+};
+
+template<typename T>
+struct NumericFlowList {
+    std::optional<pmtv::pmt> operator()([[maybe_unused]] ParseContext& ctx, [[maybe_unused]] int parentIndentLevel) const { // N.B. 'ctx' is positioned after the opening '['
+        if constexpr (!isFastNumeric<T>) {
+            return std::nullopt;
+        } else {
+            ParseContext      probe        = ctx;
+            const std::size_t startLineIdx = probe.lineIdx;
+
+            std::vector<T> values;
+            values.reserve(static_cast<std::size_t>(std::ranges::count(probe.remainingLine(), ',')) + 1UZ); // exact for single-line sequences
+
+            while (true) { // N.B. mirrors the control flow of 'parseFlow<FlowType::List>(..)'
+                probe.consumeWhitespaceAndComments();
+                if (probe.atEndOfDocument()) {
+                    return std::nullopt;
+                }
+                if (probe.consumeIfStartsWith(']')) {
+                    break;
+                }
+                if (probe.lineIdx > startLineIdx && parentIndentLevel >= 0 && probe.currentIndent() <= static_cast<std::size_t>(parentIndentLevel)) {
+                    return std::nullopt;
+                }
+
+                const std::string_view rest = probe.remainingLine();
+                const std::size_t      end  = rest.find_first_of(",]");
+                if (end == std::string_view::npos) {
+                    return std::nullopt;
+                }
+                const std::string_view token = rest.substr(0UZ, end);
+                if (!isPlainNumericToken(token) || token.contains('#')) {
+                    return std::nullopt;
+                }
+                const std::optional<T> value = parseNumericToken<T>(token);
+                if (!value) {
+                    return std::nullopt;
+                }
+                values.push_back(*value);
+                probe.consume(end);
+
+                if (probe.consumeIfStartsWith(',')) {
+                    continue;
+                }
+                if (probe.consumeIfStartsWith(']')) {
+                    break;
+                }
+                return std::nullopt;
+            }
+            ctx = probe;
+            return pmtv::pmt(std::move(values));
+        }
+    }
+};
+
 enum class FlowType { List, Map };
 template<FlowType Type>
 std::expected<pmtv::pmt, ParseError> parseFlow(ParseContext& ctx, std::string_view typeTag, int parentIndentLevel) {
@@ -942,6 +1084,14 @@ std::expected<pmtv::pmt, ParseError> parseFlow(ParseContext& ctx, std::string_vi
 
     constexpr char closingChar = Type == FlowType::List ? ']' : '}';
 
+    if constexpr (Type == FlowType::List) {
+        if (ctx.numericFastPath && !typeTag.empty()) {
+            if (std::optional<pmtv::pmt> fast = applyTag<std::optional<pmtv::pmt>, NumericFlowList>(typeTag, ctx, parentIndentLevel)) {
+                return ReturnType{std::move(*fast)};
+            }
+        }
+    }
+
     TemporaryResultType result;
 
     while (!ctx.atEndOfDocument()) {
@@ -1132,6 +1282,12 @@ inline std::expected<pmtv::pmt, ParseError> parseList(ParseContext& ctx, std::st
         return l;
     }
 
+    if (ctx.numericFastPath && !typeTag.empty()) {
+        if (std::optional<pmtv::pmt> fast = applyTag<std::optional<pmtv::pmt>, NumericBlockList>(typeTag, ctx, parentIndentLevel)) {
+            return std::move(*fast);
+        }
+    }
+
     // Use std::list instead of std::vector as a workaround to the ASAN problem with emscripten 4.0.8 due to vector reallocation.
     // A list never relocates its nodes, so references and iterators remain valid for the lifetime of the container.
     // Once parsing ends, we copy to std::vector.
@@ -1236,13 +1392,17 @@ std::string serialize(const pmtv::map_t& map) {
     return oss.str();
 }
 
-inline std::expected<pmtv::map_t, ParseError> deserialize(std::string_view yaml_str) {
-    std::vector<std::string_view> lines = detail::split(yaml_str, "\n");
-    detail::ParseContext          ctx{.lines = lines};
+namespace detail {
+inline std::expected<pmtv::map_t, ParseError> deserialize(std::string_view yaml_str, bool numericFastPath) {
+    std::vector<std::string_view> lines = split(yaml_str, "\n");
+    ParseContext                  ctx{.lines = lines, .numericFastPath = numericFastPath};
     ctx.consumeWhitespaceAndComments();
     ctx.consumeIfStartsWith("---");
-    return detail::parseMap(ctx, -1);
+    return parseMap(ctx, -1);
 }
+} // namespace detail
+
+inline std::expected<pmtv::map_t, ParseError> deserialize(std::string_view yaml_str) { return detail::deserialize(yaml_str, true); }
 
 namespace detail {
 template<std::size_t N>
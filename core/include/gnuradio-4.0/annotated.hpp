@@ -96,6 +96,39 @@ struct NoDefaultTagForwarding {};
  */
 struct BackwardTagForwarding {};
 
+/**
+ * @brief Annotates block, declaring that the stream output port 'outputPort' forwards the samples and tags of the stream input
+ * port 'inputPort' unchanged (e.g. copy, probe or routing blocks with a fixed path).
+ *
+ * Downstream ports are then aliased by the graph onto the buffer upstream of the block, gated by the block's input read position:
+ * only read cursors advance and tags are read from the upstream tag buffer, the payload is not copied. Aliased readers are
+ * registered with the upstream buffer and thus back-pressure its writer. As long as all readers of 'outputPort' are aliased, the
+ * block's processOne(..)/processBulk(..) is not invoked; it must therefore neither modify samples nor publish own tags.
+ *
+ * N.B. the upstream buffer size applies to aliased edges, and a pass-through block stopped on its own (i.e. not by an upstream
+ * end-of-stream tag) leaves its aliased readers without an end-of-stream tag.
+ *
+ * @tparam inputPort name of the forwarded input port
+ * @tparam outputPort name of the forwarding output port
+ */
+template<gr::meta::fixed_string inputPort = "in", gr::meta::fixed_string outputPort = "out">
+struct PassThrough {
+    static constexpr gr::meta::fixed_string kInputPort  = inputPort;
+    static constexpr gr::meta::fixed_string kOutputPort = outputPort;
+};
+
+template<typename T>
+concept IsPassThrough = requires {
+    T::kInputPort;
+    T::kOutputPort;
+} && std::is_base_of_v<PassThrough<T::kInputPort, T::kOutputPort>, T>;
+
+template<typename T>
+using is_pass_through = std::bool_constant<IsPassThrough<T>>;
+
+static_assert(is_pass_through<PassThrough<>>::value);
+static_assert(!is_pass_through<int>::value);
+
 /**
  * @brief Annotates block, indicating to perform resampling based on the provided `inputChunkSize` and `outputChunkSize`.
  * For each `inputChunkSize` input samples, `outputChunkSize` output samples are published.
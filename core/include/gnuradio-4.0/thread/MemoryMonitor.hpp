@@ -1,9 +1,14 @@
 #ifndef GNURADIO_MEMORYMONITOR_HPP
 #define GNURADIO_MEMORYMONITOR_HPP
 
+#include <cerrno>
+#include <cstddef>
 #include <filesystem>
 #include <stdexcept>
 #include <string>
+#include <system_error>
+
+#include <gnuradio-4.0/thread/MemoryPrefault.hpp>
 
 #if defined(_WIN32) || defined(_WIN64)
 // clang-format off
@@ -12,6 +17,7 @@
 // clang-format on
 #elif defined(__linux__)
 #include <fstream>
+#include <sys/mman.h>
 #include <unistd.h>
 #elif defined(__APPLE__)
 #include <mach/mach.h>
@@ -88,6 +94,27 @@ inline std::string getPlatformName() {
 #endif
 }
 
+/**
+ * @brief locks all current and future pages of the process in RAM (mlockall(MCL_CURRENT | MCL_FUTURE)), i.e. no page-outs and
+ * no page-faults for already touched memory. Requires CAP_IPC_LOCK or a sufficient RLIMIT_MEMLOCK.
+ * @throws std::system_error on failure
+ */
+inline void lockProcessMemory() {
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        throw std::system_error(errno, std::generic_category(), "lockProcessMemory() - mlockall(MCL_CURRENT | MCL_FUTURE)");
+    }
+#endif
+}
+
+inline void unlockProcessMemory() {
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+    if (munlockall() != 0) {
+        throw std::system_error(errno, std::generic_category(), "unlockProcessMemory() - munlockall()");
+    }
+#endif
+}
+
 } // namespace memory
 
 } // namespace gr
@@ -0,0 +1,44 @@
+#ifndef GNURADIO_MEMORYPREFAULT_HPP
+#define GNURADIO_MEMORYPREFAULT_HPP
+
+#include <cstddef>
+
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+#include <unistd.h>
+#endif
+
+namespace gr::memory {
+
+inline std::size_t pageSize() {
+#if defined(__linux__) && !defined(__EMSCRIPTEN__)
+    static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+#else
+    return 4096UZ;
+#endif
+}
+
+/**
+ * @brief touches every page of [data, data + nBytes) so that the page faults happen now rather than on the first access in the
+ * (latency-critical) processing path. The content is preserved (read & write-back of one byte per page).
+ *
+ * N.B. must not be called while other threads write to the same memory region.
+ * @return number of touched pages
+ */
+inline std::size_t prefault(void* data, std::size_t nBytes) noexcept {
+    if (data == nullptr || nBytes == 0UZ) {
+        return 0UZ;
+    }
+    volatile unsigned char* bytes  = static_cast<volatile unsigned char*>(data);
+    const std::size_t       stride = pageSize();
+    std::size_t             nPages = 0UZ;
+    for (std::size_t offset = 0UZ; offset < nBytes; offset += stride, ++nPages) {
+        bytes[offset] = bytes[offset];
+    }
+    bytes[nBytes - 1UZ] = bytes[nBytes - 1UZ]; // range may end on a page that the stride skipped
+    return nPages;
+}
+
+} // namespace gr::memory
+
+#endif // GNURADIO_MEMORYPREFAULT_HPP
@@ -0,0 +1,301 @@
+#ifndef CPUTOPOLOGY_HPP
+#define CPUTOPOLOGY_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <gnuradio-4.0/thread/thread_affinity.hpp>
+
+namespace gr::thread_pool::thread {
+
+/**
+ * @brief location of a single logical CPU (hardware thread) within the CPU/cache/NUMA hierarchy.
+ *
+ * Cache domains are identified by the lowest CPU id sharing that cache, i.e. two CPUs with the same 'l3Domain' share an L3.
+ */
+struct CpuInfo {
+    std::size_t cpuId     = 0UZ;
+    std::size_t coreId    = 0UZ; ///< physical core, identified by its lowest SMT sibling
+    std::size_t packageId = 0UZ;
+    std::size_t numaNode  = 0UZ;
+    std::size_t l2Domain  = 0UZ;
+    std::size_t l3Domain  = 0UZ;
+    bool        isolated  = false; ///< listed in 'isolcpus' (/sys/devices/system/cpu/isolated)
+    bool        allowed   = true;  ///< part of the process affinity (taskset, cgroup cpuset)
+};
+
+namespace detail {
+/// parses the kernel's cpu-list format, e.g. "0-3,8,10-11\n" -> {0, 1, 2, 3, 8, 10, 11}
+inline std::vector<std::size_t> parseCpuList(std::string_view list) {
+    constexpr auto isSpace = [](char c) { return std::isspace(static_cast<unsigned char>(c)) != 0; };
+
+    std::vector<std::size_t> cpus;
+    while (!list.empty()) {
+        const std::size_t comma = list.find(',');
+        std::string_view  token = list.substr(0UZ, comma);
+        list                    = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1UZ);
+        while (!token.empty() && isSpace(token.front())) {
+            token.remove_prefix(1UZ);
+        }
+        while (!token.empty() && isSpace(token.back())) {
+            token.remove_suffix(1UZ);
+        }
+
+        const std::size_t      dash  = token.find('-');
+        const std::string_view lower = token.substr(0UZ, dash);
+        std::size_t            first = 0UZ;
+        if (token.empty() || std::from_chars(lower.data(), lower.data() + lower.size(), first).ec != std::errc{}) {
+            continue;
+        }
+        std::size_t last = first;
+        if (dash != std::string_view::npos) {
+            const std::string_view upper = token.substr(dash + 1UZ);
+            if (std::from_chars(upper.data(), upper.data() + upper.size(), last).ec != std::errc{} || last < first) {
+                continue;
+            }
+        }
+        for (std::size_t cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+inline std::optional<std::string> readFirstLine(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::in);
+    std::string   line;
+    if (!in.is_open() || !std::getline(in, line)) {
+        return std::nullopt;
+    }
+    return line;
+}
+
+inline std::optional<std::size_t> readValue(const std::filesystem::path& path) {
+    const std::optional<std::string> line = readFirstLine(path);
+    std::size_t                      value{};
+    if (!line || std::from_chars(line->data(), line->data() + line->size(), value).ec != std::errc{}) {
+        return std::nullopt;
+    }
+    return value;
+}
+
+/// CPUs the process may run on -- reflects 'taskset' as well as cgroup cpusets (empty: unknown, i.e. no restriction)
+#if defined(_POSIX_VERSION) && not defined(__EMSCRIPTEN__) && not defined(__APPLE__)
+inline std::vector<bool> allowedCpuMask(const int pid = getPid()) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    if (sched_getaffinity(pid, sizeof(cpu_set_t), &cpuSet) != 0) {
+        return {};
+    }
+    std::vector<bool> mask(CPU_SETSIZE);
+    for (std::size_t i = 0UZ; i < mask.size(); ++i) {
+        mask[i] = CPU_ISSET(i, &cpuSet);
+    }
+    while (!mask.empty() && !mask.back()) {
+        mask.pop_back();
+    }
+    return mask;
+}
+#else
+inline std::vector<bool> allowedCpuMask(const int /*pid*/ = -1) { return {}; }
+#endif
+} // namespace detail
+
+/**
+ * @brief CPU/cache/NUMA topology as exported by the Linux kernel under '/sys/devices/system/cpu'.
+ *
+ * The CPUs are kept in 'topology order', i.e. sorted by NUMA node, package, L3 domain, L2 domain and physical core, so that
+ * neighbouring entries are as close as possible in the memory hierarchy. If the sysfs tree is not available (non-Linux,
+ * restricted containers) every logical CPU is treated as an independent core.
+ *
+ * @code
+ * const auto topology = gr::thread_pool::thread::CpuTopology::read();
+ * for (std::size_t cpu : topology.physicalCores()) { ... } // one CPU per physical core, cache-neighbours first
+ * @endcode
+ */
+class CpuTopology {
+    std::vector<CpuInfo> _cpus;
+
+    static bool isUsable(const CpuInfo& cpu, bool ignoreIsolation) { return cpu.allowed && (ignoreIsolation || !cpu.isolated); }
+
+    [[nodiscard]] bool ignoreIsolation() const { // isolated CPUs are only used if the process is confined to them
+        return std::ranges::none_of(_cpus, [](const CpuInfo& cpu) { return isUsable(cpu, false); });
+    }
+
+public:
+    CpuTopology() = default;
+    explicit CpuTopology(std::vector<CpuInfo> cpus) : _cpus(std::move(cpus)) {
+        std::ranges::sort(_cpus, {}, [](const CpuInfo& cpu) { return std::tuple(cpu.numaNode, cpu.packageId, cpu.l3Domain, cpu.l2Domain, cpu.coreId, cpu.cpuId); });
+    }
+
+    /**
+     * @param sysfsRoot CPU sysfs directory (overridable for testing)
+     * @param allowedMask process CPU affinity, defaults to the calling process' (cgroup-constrained) affinity
+     */
+    [[nodiscard]] static CpuTopology read(const std::filesystem::path& sysfsRoot = "/sys/devices/system/cpu", const std::vector<bool>& allowedMask = detail::allowedCpuMask()) {
+        namespace fs = std::filesystem;
+
+        std::vector<std::size_t> cpuIds = detail::parseCpuList(detail::readFirstLine(sysfsRoot / "online").value_or(""));
+        if (cpuIds.empty()) {
+            cpuIds.resize(std::max(1U, std::thread::hardware_concurrency()));
+            std::iota(cpuIds.begin(), cpuIds.end(), 0UZ);
+        }
+        const std::vector<std::size_t> isolated = detail::parseCpuList(detail::readFirstLine(sysfsRoot / "isolated").value_or(""));
+
+        std::vector<CpuInfo> cpus;
+        cpus.reserve(cpuIds.size());
+        for (const std::size_t cpuId : cpuIds) {
+            const fs::path cpuPath = sysfsRoot / std::format("cpu{}", cpuId);
+            CpuInfo        info{.cpuId = cpuId, .coreId = cpuId};
+            info.packageId = detail::readValue(cpuPath / "topology" / "physical_package_id").value_or(0UZ);
+
+            std::vector<std::size_t> siblings = detail::parseCpuList(detail::readFirstLine(cpuPath / "topology" / "core_cpus_list").value_or(""));
+            if (siblings.empty()) { // pre-5.x kernels
+                siblings = detail::parseCpuList(detail::readFirstLine(cpuPath / "topology" / "thread_siblings_list").value_or(""));
+            }
+            if (!siblings.empty()) {
+                info.coreId = std::ranges::min(siblings);
+            }
+            info.l2Domain = info.coreId;
+
+            std::error_code ec;
+            for (const fs::directory_entry& entry : fs::directory_iterator(cpuPath / "cache", ec)) {
+                if (!entry.path().filename().string().starts_with("index") || detail::readFirstLine(entry.path() / "type") == "Instruction") {
+                    continue;
+                }
+                const std::vector<std::size_t> shared = detail::parseCpuList(detail::readFirstLine(entry.path() / "shared_cpu_list").value_or(""));
+                if (shared.empty()) {
+                    continue;
+                }
+                switch (detail::readValue(entry.path() / "level").value_or(0UZ)) {
+                case 2UZ: info.l2Domain = std::ranges::min(shared); break;
+                case 3UZ: info.l3Domain = std::ranges::min(shared); break;
+                default: break;
+                }
+            }
+            for (const fs::directory_entry& entry : fs::directory_iterator(cpuPath, ec)) { // NUMA membership is exported as 'cpuN/node<M>' link
+                const std::string name = entry.path().filename().string();
+                if (name.starts_with("node")) {
+                    std::ignore = std::from_chars(name.data() + 4, name.data() + name.size(), info.numaNode);
+                }
+            }
+
+            info.isolated = std::ranges::find(isolated, cpuId) != isolated.end();
+            info.allowed  = allowedMask.empty() || (cpuId < allowedMask.size() && allowedMask[cpuId]);
+            cpus.push_back(info);
+        }
+        return CpuTopology(std::move(cpus));
+    }
+
+    [[nodiscard]] const std::vector<CpuInfo>& cpus() const noexcept { return _cpus; }
+
+    [[nodiscard]] const CpuInfo* find(std::size_t cpuId) const {
+        const auto it = std::ranges::find(_cpus, cpuId, &CpuInfo::cpuId);
+        return it != _cpus.end() ? std::addressof(*it) : nullptr;
+    }
+
+    /// @return CPUs that may be used for placement (allowed by the process affinity and not isolated) in topology order
+    [[nodiscard]] std::vector<std::size_t> usableCpus() const {
+        const bool               ignore = ignoreIsolation();
+        std::vector<std::size_t> result;
+        for (const CpuInfo& cpu : _cpus) {
+            if (isUsable(cpu, ignore)) {
+                result.push_back(cpu.cpuId);
+            }
+        }
+        return result;
+    }
+
+    /// @return one usable CPU (the first SMT sibling) per physical core in topology order, i.e. consecutive entries share an L2/L3 where possible
+    [[nodiscard]] std::vector<std::size_t> physicalCores() const {
+        const bool               ignore = ignoreIsolation();
+        std::vector<std::size_t> coreIds;
+        std::vector<std::size_t> result;
+        for (const CpuInfo& cpu : _cpus) {
+            if (isUsable(cpu, ignore) && std::ranges::find(coreIds, cpu.coreId) == coreIds.end()) {
+                coreIds.push_back(cpu.coreId);
+                result.push_back(cpu.cpuId);
+            }
+        }
+        return result;
+    }
+};
+
+/// single-CPU affinity mask compatible with 'setThreadAffinity(..)'
+[[nodiscard]] inline std::vector<bool> cpuMask(std::size_t cpuId) {
+    std::vector<bool> mask(cpuId + 1UZ, false);
+    mask[cpuId] = true;
+    return mask;
+}
+
+/**
+ * @brief CPU placement of the scheduler runners and the auxiliary (IO) pools.
+ *
+ * 'runnerCpus[i]' is the CPU runner 'i' is pinned to. 'ioMask' covers the usable CPUs that are not used by any runner
+ * (not even via an SMT sibling) and is intended for 'BasicThreadPool::setAffinityMask(..)' of IO-bound pools.
+ */
+struct CpuPlacement {
+    std::vector<std::size_t> runnerCpus;
+    std::vector<bool>        ioMask;
+};
+
+/**
+ * @brief pins 'nRunners' one per physical core in topology order.
+ *
+ * Since the schedulers distribute the processing order round-robin across runners (i.e. producer/consumer pairs mostly
+ * end up on runners 'i' and 'i+1'), consecutive runners are placed on cores sharing an L2/L3. If there are more runners
+ * than cores, the runners wrap around. The IO pools keep the remaining cores, fall back to the SMT siblings of the runner
+ * cores, and only share the runner CPUs if nothing else is left.
+ */
+[[nodiscard]] inline CpuPlacement planPlacement(const CpuTopology& topology, std::size_t nRunners) {
+    CpuPlacement                   placement;
+    const std::vector<std::size_t> cores  = topology.physicalCores();
+    const std::vector<std::size_t> usable = topology.usableCpus();
+    if (cores.empty() || nRunners == 0UZ) {
+        return placement;
+    }
+
+    std::vector<std::size_t> runnerCores;
+    placement.runnerCpus.reserve(nRunners);
+    for (std::size_t i = 0UZ; i < nRunners; ++i) {
+        const std::size_t cpuId = cores[i % cores.size()];
+        placement.runnerCpus.push_back(cpuId);
+        runnerCores.push_back(topology.find(cpuId)->coreId);
+    }
+
+    placement.ioMask.assign(std::ranges::max(usable) + 1UZ, false);
+    const auto assignIo = [&](auto predicate) {
+        bool any = false;
+        for (const std::size_t cpuId : usable) {
+            if (predicate(cpuId)) {
+                placement.ioMask[cpuId] = true;
+                any                     = true;
+            }
+        }
+        return any;
+    };
+    if (assignIo([&](std::size_t cpuId) { return std::ranges::find(runnerCores, topology.find(cpuId)->coreId) == runnerCores.end(); })) {
+        return placement; // free physical cores
+    }
+    if (assignIo([&](std::size_t cpuId) { return std::ranges::find(placement.runnerCpus, cpuId) == placement.runnerCpus.end(); })) {
+        return placement; // SMT siblings of the runner cores
+    }
+    std::ignore = assignIo([](std::size_t) { return true; });
+    return placement;
+}
+
+} // namespace gr::thread_pool::thread
+
+#endif // CPUTOPOLOGY_HPP
@@ -509,11 +509,11 @@ private:
         thread::setThreadSchedulingParameter(_schedulingPolicy, _schedulingPriority, thread);
         if (!_affinityMask.empty()) {
             if (_taskType == TaskType::IO_BOUND) {
-                thread::setThreadAffinity(_affinityMask);
+                thread::setThreadAffinity(_affinityMask, thread);
                 return;
             }
             const std::vector<bool> affinityMask = distributeThreadAffinityAcrossCores(_affinityMask, threadID);
-            thread::setThreadAffinity(affinityMask);
+            thread::setThreadAffinity(affinityMask, thread);
         }
     }
 
@@ -523,13 +523,17 @@ private:
         }
         std::vector<bool> affinityMask;
         std::size_t       coreCount = 0;
+        const std::size_t nThreads  = std::max(minThreads(), 1U);
         for (bool value : globalAffinityMask) {
             if (value) {
-                affinityMask.push_back(coreCount++ % minThreads() == threadID);
+                affinityMask.push_back(coreCount++ % nThreads == threadID % nThreads);
             } else {
                 affinityMask.push_back(false);
             }
         }
+        if (std::ranges::none_of(affinityMask, [](bool enabled) { return enabled; })) { // fewer enabled cores than threads
+            return globalAffinityMask;
+        }
         return affinityMask;
     }
 
@@ -0,0 +1,67 @@
+#include <benchmark.hpp>
+
+#include <filesystem>
+#include <format>
+
+#include <unistd.h>
+
+#include <gnuradio-4.0/BlockRegistry.hpp>
+#include <gnuradio-4.0/PluginLoader.hpp>
+
+/**
+ * start-up time of 'PluginLoader' using the test plugins: eager loading without manifest vs. lazy loading from a warm manifest
+ */
+
+inline constexpr std::size_t N_ITER = 20;
+
+using paths = std::vector<std::filesystem::path>;
+
+inline const boost::ut::suite<"PluginLoader start-up"> _pluginLoaderBenchmarks = [] {
+    using namespace boost::ut;
+    using namespace benchmark;
+    using namespace gr;
+
+    const paths                 pluginPaths{"core/test/plugins", "test/plugins", "plugins"};
+    const std::filesystem::path manifestFile = std::filesystem::temp_directory_path() / std::format("bm_plugin_manifest.{}.txt", ::getpid());
+    std::filesystem::remove(manifestFile);
+
+    ::benchmark::benchmark<N_ITER>("w/o manifest - construct (dlopen all)") = [&pluginPaths] {
+        BlockRegistry registry;
+        PluginLoader  loader(registry, pluginPaths, std::filesystem::path{});
+        expect(gt(loader.nLoadedPlugins(), 0UZ));
+    };
+
+    ::benchmark::benchmark<N_ITER>("w/o manifest - construct + instantiate 1 block") = [&pluginPaths] {
+        BlockRegistry registry;
+        PluginLoader  loader(registry, pluginPaths, std::filesystem::path{});
+        expect(loader.instantiate("good::divide<float64>") != nullptr);
+    };
+
+    { // first scan populates the manifest
+        BlockRegistry registry;
+        PluginLoader  loader(registry, pluginPaths, manifestFile);
+    }
+
+    ::benchmark::benchmark<N_ITER>("warm manifest - construct (lazy)") = [&pluginPaths, &manifestFile] {
+        BlockRegistry registry;
+        PluginLoader  loader(registry, pluginPaths, manifestFile);
+        expect(eq(loader.nLoadedPlugins(), 0UZ));
+    };
+
+    ::benchmark::benchmark<N_ITER>("warm manifest - construct + instantiate 1 block") = [&pluginPaths, &manifestFile] {
+        BlockRegistry registry;
+        PluginLoader  loader(registry, pluginPaths, manifestFile);
+        expect(loader.instantiate("good::divide<float64>") != nullptr);
+        expect(eq(loader.nLoadedPlugins(), 1UZ));
+    };
+
+    ::benchmark::benchmark<N_ITER>("warm manifest - construct + loadAll()") = [&pluginPaths, &manifestFile] {
+        BlockRegistry registry;
+        PluginLoader  loader(registry, pluginPaths, manifestFile);
+        loader.loadAll();
+    };
+
+    std::filesystem::remove(manifestFile);
+};
+
+int main() { /* not needed by the UT framework */ }
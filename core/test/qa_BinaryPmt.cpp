@@ -0,0 +1,184 @@
+#include <boost/ut.hpp>
+
+#include <bit>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gnuradio-4.0/BinaryPmt.hpp>
+#include <gnuradio-4.0/YamlPmt.hpp>
+
+namespace {
+pmtv::map_t testMap() {
+    using namespace std::string_literals;
+    pmtv::map_t map;
+    map["null"]       = std::monostate{};
+    map["bool"]       = true;
+    map["uint8"]      = std::uint8_t(255U);
+    map["uint16"]     = std::uint16_t(65535U);
+    map["uint32"]     = std::numeric_limits<std::uint32_t>::max();
+    map["uint64"]     = std::numeric_limits<std::uint64_t>::max();
+    map["int8"]       = std::int8_t(-128);
+    map["int16"]      = std::int16_t(-32768);
+    map["int32"]      = std::numeric_limits<std::int32_t>::min();
+    map["int64"]      = std::numeric_limits<std::int64_t>::min();
+    map["float32"]    = 3.14f;
+    map["float64"]    = -2.718281828459045;
+    map["complex32"]  = std::complex<float>(1.f, -1.f);
+    map["complex64"]  = std::complex<double>(-1.5, 2.5);
+    map["string"]     = "hello world"s;
+    map["empty str"]  = std::string();
+    map["multi:line"] = "line 1\nline 2\t\"quoted\""s;
+
+    map["vec bool"]    = std::vector<bool>{true, false, true};
+    map["vec uint8"]   = std::vector<std::uint8_t>{0U, 1U, 255U};
+    map["vec int16"]   = std::vector<std::int16_t>{-1, 0, 1};
+    map["vec int64"]   = std::vector<std::int64_t>{std::numeric_limits<std::int64_t>::min(), 0, std::numeric_limits<std::int64_t>::max()};
+    map["vec float32"] = std::vector<float>{1.f, 2.f, 3.f};
+    map["vec float64"] = std::vector<double>{};
+    map["vec c64"]     = std::vector<std::complex<double>>{{1., 2.}, {3., 4.}};
+    map["vec string"]  = std::vector<std::string>{"a"s, ""s, "c d"s};
+
+    pmtv::map_t nested;
+    nested["float32"]  = 1.f; // same key as in the parent -> shared string table entry
+    nested["sub"]      = pmtv::map_t{{"x"s, std::int32_t(42)}};
+    nested["empty"]    = pmtv::map_t{};
+    map["nested"]      = nested;
+    map["vec pmt"]     = std::vector<pmtv::pmt>{pmtv::pmt{std::int64_t(1)}, pmtv::pmt{"two"s}, pmtv::pmt{nested}, pmtv::pmt{std::vector<pmtv::pmt>{}}};
+    return map;
+}
+} // namespace
+
+const boost::ut::suite<"BinaryPmt"> _binaryPmtTests = [] {
+    using namespace boost::ut;
+    using namespace std::literals;
+    namespace binary = pmtv::binary;
+    namespace yaml   = pmtv::yaml;
+
+    "round-trip all types"_test = [] {
+        const pmtv::map_t original = testMap();
+        const auto        encoded  = binary::serialize(original);
+        expect(binary::isBinary(encoded));
+
+        const auto decoded = binary::deserialize(encoded);
+        expect(decoded.has_value()) << [&] { return decoded.error().message; } << fatal;
+        expect(decoded.value() == original);
+        expect(binary::serialize(decoded.value()) == encoded) << "encoding is deterministic";
+    };
+
+    "round-trip single pmt"_test = [] {
+        for (const pmtv::pmt& value : {pmtv::pmt{std::monostate{}}, pmtv::pmt{42.0}, pmtv::pmt{"str"s}, pmtv::pmt{std::vector<float>{1.f, 2.f}}, pmtv::pmt{testMap()}}) {
+            const auto decoded = binary::deserializePmt(binary::serialize(value));
+            expect(decoded.has_value() && decoded.value() == value);
+        }
+    };
+
+    "agrees with YAML"_test = [] {
+        constexpr std::string_view src = R"(
+blocks:
+  - name: ArraySink<double>
+    id: gr::testing::ArraySink<double>
+    parameters:
+      name: ArraySink<double>
+      taps: !!float32
+        - 0.5
+        - -0.25
+        - 0.125
+connections:
+  - [ArraySource<double>, [0, 0], ArraySink<double>, [1, 1]]
+  - [ArraySource<double>, [0, 1], ArraySink<double>, [1, 0]]
+)";
+        const auto fromYaml = yaml::deserialize(src);
+        expect(fromYaml.has_value()) << fatal;
+
+        const auto fromBinary = binary::deserialize(binary::serialize(fromYaml.value()));
+        expect(fromBinary.has_value()) << fatal;
+        expect(fromBinary.value() == fromYaml.value());
+        expect(eq(yaml::serialize(fromBinary.value()), yaml::serialize(fromYaml.value())));
+
+        const auto original = testMap(); // YAML -> binary -> YAML of the full type set
+        const auto viaYaml  = yaml::deserialize(yaml::serialize(original));
+        expect(viaYaml.has_value()) << fatal;
+        const auto viaBinary = binary::deserialize(binary::serialize(viaYaml.value()));
+        expect(viaBinary.has_value() && viaBinary.value() == viaYaml.value());
+    };
+
+    "large vectors are bulk-copied"_test = [] {
+        std::vector<float> taps(100'000UZ);
+        std::iota(taps.begin(), taps.end(), 0.f);
+        const pmtv::map_t map{{"taps"s, taps}, {"nan"s, std::numeric_limits<double>::quiet_NaN()}};
+
+        const auto encoded = binary::serialize(map);
+        expect(lt(encoded.size(), taps.size() * sizeof(float) + 64UZ));
+        expect(lt(encoded.size(), yaml::serialize(map).size()));
+
+        const auto decoded = binary::deserialize(encoded);
+        expect(decoded.has_value()) << fatal;
+        expect(std::get<std::vector<float>>(decoded->at("taps"s)) == taps);
+        expect(std::isnan(std::get<double>(decoded->at("nan"s))));
+    };
+
+    "repeated keys are stored once"_test = [] {
+        std::vector<pmtv::pmt> blocks;
+        for (std::size_t i = 0UZ; i < 100UZ; ++i) {
+            blocks.emplace_back(pmtv::map_t{{"a_rather_long_parameter_name"s, std::int32_t(1)}});
+        }
+        const auto encoded = binary::serialize(pmtv::map_t{{"blocks"s, blocks}});
+        expect(lt(encoded.size(), 100UZ * std::string_view("a_rather_long_parameter_name").size()));
+    };
+
+    "decode errors"_test = [] {
+        const auto encoded = binary::serialize(testMap());
+
+        expect(!binary::deserialize(std::span(encoded).first(encoded.size() - 1UZ)).has_value()) << "truncated";
+        expect(!binary::deserialize(std::span(encoded).first(3UZ)).has_value()) << "header only";
+
+        auto trailing = encoded;
+        trailing.push_back(0U);
+        const auto trailingResult = binary::deserialize(trailing);
+        expect(!trailingResult.has_value() && trailingResult.error().message.contains("trailing"));
+
+        auto badMagic = encoded;
+        badMagic[0]   = 'X';
+        expect(!binary::isBinary(badMagic));
+        expect(!binary::deserialize(badMagic).has_value());
+
+        auto badVersion = encoded;
+        badVersion[4]   = static_cast<std::uint8_t>(binary::kVersion + 1U);
+        const auto versionResult = binary::deserialize(badVersion);
+        expect(!versionResult.has_value() && versionResult.error().message.contains("version"));
+
+        expect(!binary::deserialize(binary::serialize(pmtv::pmt{42})).has_value()) << "root must be a map";
+        expect(!binary::deserialize("key: value"sv).has_value()) << "YAML is not binary";
+    };
+
+    "foreign byte-order"_test = [] {
+        const bool hostIsBig = std::endian::native == std::endian::big;
+        // header, empty key table, int32 scalar 0x01020304 and float32 vector{1.0f} as written by the opposite byte-order
+        std::vector<std::uint8_t> foreign{'G', 'R', 'P', 'B', binary::kVersion, hostIsBig ? std::uint8_t(0U) : std::uint8_t(1U), 0U};
+        const auto                appendSwapped = [&foreign](const auto& value) {
+            const auto* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+            for (std::size_t i = sizeof(value); i > 0UZ; --i) {
+                foreign.push_back(bytes[i - 1UZ]);
+            }
+        };
+
+        foreign.push_back(static_cast<std::uint8_t>(binary::detail::TypeCode::Int32));
+        appendSwapped(std::int32_t(0x01020304));
+        const auto decodedScalar = binary::deserializePmt(foreign);
+        expect(decodedScalar.has_value() && std::get<std::int32_t>(decodedScalar.value()) == 0x01020304);
+
+        foreign.resize(7UZ);
+        foreign.push_back(static_cast<std::uint8_t>(binary::detail::TypeCode::Float32) | static_cast<std::uint8_t>(binary::detail::TypeCode::VectorFlag));
+        foreign.push_back(1U); // count
+        appendSwapped(1.0f);
+        const auto decodedVector = binary::deserializePmt(foreign);
+        expect(decodedVector.has_value() && std::get<std::vector<float>>(decodedVector.value()) == std::vector<float>{1.0f});
+    };
+};
+
+int main() { /* tests are statically executed */ }
@@ -1,3 +1,5 @@
+#include <filesystem>
+#include <fstream>
 #include <utility>
 #include <vector>
 
@@ -7,6 +9,7 @@
 
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/MetricsExporter.hpp>
 #include <gnuradio-4.0/Scheduler.hpp>
 #include <gnuradio-4.0/basic/ClockSource.hpp>
 #include <gnuradio-4.0/meta/UnitTestHelper.hpp>
@@ -1053,6 +1056,82 @@ const boost::ut::suite<"Requested Work Tests"> _requestedWorkTests = [] {
         auto resultSink = sink.work(100);
         expect(eq(resultSink.performed_work, 100UZ));
     };
+
+    "runtime metrics"_test = [] {
+        using namespace std::string_literals;
+        gr::Graph graph;
+        auto&     src       = graph.emplaceBlock<TagSource<float, ProcessFunction::USE_PROCESS_BULK>>({{"n_samples_max", gr::Size_t(1000)}, {"disconnect_on_done", false}});
+        auto&     testBlock = graph.emplaceBlock<Resampler<float>>({{"disconnect_on_done", false}});
+        auto&     sink      = graph.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>({{"disconnect_on_done", false}});
+
+        expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(testBlock)));
+        expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(testBlock).template to<"in">(sink)));
+        graph.reconnectAllEdges();
+        for (auto& block : graph.blocks()) {
+            std::ignore = block->changeStateTo(lifecycle::State::INITIALISED);
+            std::ignore = block->changeStateTo(lifecycle::State::RUNNING);
+        }
+
+        expect(eq(src.work(100).performed_work, 100UZ));
+        expect(eq(testBlock.work(10).performed_work, 10UZ));
+        expect(eq(testBlock.work(30).performed_work, 30UZ));
+
+        expect(eq(src.workMetrics.nWorkCalls(), 1UZ));
+        expect(eq(src.workMetrics.nSamplesOut(), 100UZ));
+        expect(eq(testBlock.workMetrics.nWorkCalls(), 2UZ));
+        expect(eq(testBlock.workMetrics.nSamplesIn(), 40UZ));
+        expect(eq(testBlock.workMetrics.nSamplesOut(), 40UZ));
+        expect(eq(testBlock.workMetrics.nStatus(work::Status::OK), 2UZ));
+        expect(eq(testBlock.workMetrics.nStatus(work::Status::INSUFFICIENT_OUTPUT_ITEMS), 0UZ));
+
+        const property_map metrics = testBlock.runtimeMetrics();
+        expect(eq(std::get<std::uint64_t>(metrics.at("nWorkCalls"s)), 2UZ));
+        expect(gt(std::get<std::uint64_t>(metrics.at("maxWorkLatencyNs"s)), 0UZ));
+        expect(eq(std::get<std::uint64_t>(std::get<property_map>(metrics.at("status"s)).at("OK"s)), 2UZ));
+        const auto& ports = std::get<std::vector<pmtv::pmt>>(metrics.at("ports"s));
+        expect(eq(ports.size(), 2UZ)) << fatal;
+        const auto& inPort  = std::get<property_map>(ports[0]);
+        const auto& outPort = std::get<property_map>(ports[1]);
+        expect(eq(std::get<std::string>(inPort.at("direction"s)), "INPUT"s));
+        expect(eq(std::get<std::uint64_t>(inPort.at("fillLevel"s)), 60UZ)) << "100 produced - 40 consumed";
+        expect(eq(std::get<std::uint64_t>(outPort.at("fillLevel"s)), 40UZ)) << "not yet consumed by the sink";
+        expect(gt(std::get<std::uint64_t>(outPort.at("bufferSize"s)), 0UZ));
+
+        std::ignore = sink.work();
+        expect(eq(std::get<std::uint64_t>(std::get<property_map>(std::get<std::vector<pmtv::pmt>>(testBlock.runtimeMetrics().at("ports"s))[1]).at("fillLevel"s)), 0UZ));
+
+        const std::string prometheus = gr::metrics::formatPrometheus({{testBlock.unique_name, metrics}});
+        expect(prometheus.contains("# TYPE gr4_block_nWorkCalls_total counter\n"));
+        expect(prometheus.contains(std::format("gr4_block_nWorkCalls_total{{block=\"{}\"}} 2\n", testBlock.unique_name)));
+        expect(prometheus.contains(std::format("gr4_block_status_total{{block=\"{}\",status=\"OK\"}} 2\n", testBlock.unique_name)));
+        expect(prometheus.contains("# TYPE gr4_block_maxWorkLatencyNs gauge\n")) << "gauges carry no '_total' suffix";
+        expect(prometheus.contains(std::format("gr4_block_fillLevel{{block=\"{}\",port=\"in\",direction=\"INPUT\"}} 60\n", testBlock.unique_name)));
+        expect(prometheus.contains("# TYPE gr4_block_fillLevel gauge\n"));
+
+        const std::string csv = gr::metrics::formatCsv({{"a,b"s, metrics}}, std::chrono::system_clock::time_point(std::chrono::milliseconds(42)));
+        expect(csv.contains("42,\"a,b\",nSamplesIn,40\n"));
+        expect(csv.contains("42,\"a,b\",status.OK,2\n"));
+
+        const auto path = std::filesystem::temp_directory_path() / std::format("qa_Block_metrics_{}.csv", testBlock.unique_id);
+        std::filesystem::remove(path);
+        {
+            gr::metrics::PeriodicExporter exporter([&testBlock] { return property_map{{testBlock.unique_name, testBlock.runtimeMetrics()}}; }, path, gr::metrics::Format::CSV, std::chrono::hours(1));
+            expect(exporter.exportNow().has_value());
+        } // destructor performs a final export
+        std::ifstream     file(path);
+        const std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+        expect(content.starts_with(gr::metrics::kCsvHeader));
+        expect(eq(std::ranges::count(content, '\n'), 1L + 2L * std::ranges::count(csv, '\n'))) << "header + explicit and final export";
+        std::filesystem::remove(path);
+
+        expect(gt(testBlock.prefaultBuffers(), 0UZ)) << "output stream buffer pages";
+        expect(eq(testBlock.workMetrics.nWorkCalls(), 2UZ)) << "prefaulting does not count as work";
+
+        testBlock.workMetrics.reset();
+        expect(eq(testBlock.workMetrics.nWorkCalls(), 0UZ));
+        expect(eq(testBlock.workMetrics.maxWorkLatencyNs(), 0UZ));
+        expect(eq(testBlock.workMetrics.nSamplesIn(), 0UZ));
+    };
 };
 
 const boost::ut::suite<"BlockingIO Tests"> _blockingIOTests = [] {
@@ -1,6 +1,7 @@
 #include <boost/ut.hpp>
 
 #include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/DataSetPool.hpp>
 
 const boost::ut::suite<"DataSet<T>"> _dataSetAPI = [] {
     using namespace boost::ut;
@@ -90,4 +91,82 @@ const boost::ut::suite<"DataSet<T>"> _dataSetAPI = [] {
     };
 };
 
+const boost::ut::suite<"DataSetPool<T>"> _dataSetPool = [] {
+    using namespace boost::ut;
+    using namespace std::string_view_literals;
+
+    "acquire returns pre-sized DataSet"_test = [] {
+        gr::DataSetPool<float> pool;
+        gr::DataSet<float>     ds = pool.acquire({4, 8}, 2UZ);
+
+        expect(eq(ds.nDimensions(), 2UZ));
+        expect(eq(ds.extents[0], 4));
+        expect(eq(ds.extents[1], 8));
+        expect(eq(ds.axis_values.size(), 2UZ));
+        expect(ge(ds.axis_values[1].capacity(), 8UZ));
+        expect(ds.signal_values.empty());
+        expect(ge(ds.signal_values.capacity(), 2UZ * 4UZ * 8UZ));
+        expect(eq(ds.meta_information.size(), 2UZ));
+        expect(eq(ds.timing_events.size(), 2UZ));
+        expect(eq(pool.statistics().first, 0UZ)) << "nothing to recycle yet";
+    };
+
+    "release recycles storage"_test = [] {
+        gr::DataSetPool<float> pool;
+        gr::DataSet<float>     ds = pool.acquire({1024}, 1UZ);
+        ds.signal_names           = {"sig"};
+        ds.signal_values.resize(1024UZ, 42.f);
+        ds.axis_values[0].resize(1024UZ, 1.f);
+        ds.meta_information[0]["key"] = 1;
+        ds.timing_events[0].emplace_back(0, gr::property_map{{"key", 2}});
+        const float* storage = ds.signal_values.data();
+
+        pool.release(std::move(ds));
+        expect(eq(pool.size(), 1UZ));
+
+        gr::DataSet<float> recycled = pool.acquire({512}, 1UZ);
+        expect(eq(pool.size(), 0UZ));
+        expect(eq(pool.statistics().first, 1UZ));
+        expect(recycled.signal_values.data() == storage) << "signal storage should be re-used";
+        expect(recycled.signal_values.empty());
+        expect(recycled.signal_names.empty());
+        expect(recycled.axis_values[0].empty());
+        expect(ge(recycled.axis_values[0].capacity(), 1024UZ));
+        expect(recycled.meta_information[0].empty());
+        expect(recycled.timing_events[0].empty());
+        expect(eq(recycled.extents[0], 512));
+    };
+
+    "best-fit and capacity limit"_test = [] {
+        gr::DataSetPool<double> pool(2UZ);
+        for (std::int32_t n : {16, 1024, 256}) {
+            gr::DataSet<double> ds = pool.acquire({n});
+            ds.signal_values.resize(static_cast<std::size_t>(n));
+            pool.release(std::move(ds));
+        }
+        expect(eq(pool.size(), 2UZ)) << "smallest DataSet is dropped beyond the capacity limit";
+
+        gr::DataSet<double> ds = pool.acquire({200});
+        expect(ge(ds.signal_values.capacity(), 200UZ));
+        expect(lt(ds.signal_values.capacity(), 1024UZ)) << "smallest fitting DataSet is preferred";
+
+        pool.release(gr::DataSet<double>{}); // nothing to recycle
+        expect(eq(pool.size(), 1UZ));
+    };
+
+    "publishRecycled swaps into slot"_test = [] {
+        gr::DataSetPool<float> pool;
+        gr::DataSet<float>     slot = pool.acquire({64});
+        slot.signal_values.resize(64UZ, 1.f);
+        gr::DataSet<float> next = pool.acquire({64});
+        next.signal_values.resize(64UZ, 2.f);
+        next.signal_names = {"next"};
+
+        gr::publishRecycled(slot, std::move(next), pool);
+        expect(eq(slot.signalName(0), "next"sv));
+        expect(eq(slot.signal_values[0], 2.f));
+        expect(eq(pool.size(), 1UZ)) << "previous slot content returned to the pool";
+    };
+};
+
 int main() { /* tests are statically executed */ }
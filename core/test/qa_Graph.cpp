@@ -117,6 +117,67 @@ const boost::ut::suite<"GraphTests"> _1 = [] {
         expect(eq(src.out[1].bufferSize(), 4096UZ)); // port default buffer size
         expect(eq(src.out[2].bufferSize(), 4096UZ)); // port default buffer size
     };
+
+    "pass-through blocks alias the upstream buffer"_test = [] {
+        constexpr gr::Size_t kNSamples = 100'000U;
+        Graph                graph;
+        auto&                src      = graph.emplaceBlock<TagSource<float, ProcessFunction::USE_PROCESS_BULK>>({{"n_samples_max", kNSamples}, {"mark_tag", false}});
+        auto&                forward1 = graph.emplaceBlock<Forward<float>>();
+        auto&                forward2 = graph.emplaceBlock<Forward<float>>();
+        auto&                sink     = graph.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_ONE>>();
+        src._tags                     = {Tag(10UZ, {{"key", "first"}}), Tag(5'000UZ, {{"key", "second"}}), Tag(90'000UZ, {{"key", "third"}})};
+
+        // connected in reverse order: the graph defers the downstream edges until the pass-through inputs are connected
+        expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(forward2, 65536UZ).to<"in">(sink)));
+        expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(forward1).to<"in">(forward2)));
+        expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(forward1)));
+        expect(graph.connectPendingEdges());
+
+        expect(eq(forward1.out.nAliasedReaders(), 1UZ));
+        expect(eq(forward2.out.nAliasedReaders(), 1UZ));
+        expect(eq(forward1.out.nReaders(), 0UZ));
+        expect(eq(forward2.out.nReaders(), 0UZ));
+        expect(eq(src.out.nReaders(), 3UZ)) << "forward1.in + aliased forward2.in + aliased sink.in";
+        expect(ge(src.out.bufferSize(), 65536UZ)) << "upstream buffer satisfies the min. buffer size of the aliased edge";
+
+        scheduler::Simple sched;
+        if (auto ret = sched.exchange(std::move(graph)); !ret) {
+            throw std::runtime_error(std::format("failed to initialize scheduler: {}", ret.error()));
+        }
+        expect(sched.runAndWait().has_value());
+
+        expect(eq(sink._nSamplesProduced, kNSamples));
+        expect(eq(sink._samples.size(), static_cast<std::size_t>(kNSamples)));
+        bool samplesMatch = true;
+        for (std::size_t i = 0UZ; i < sink._samples.size(); ++i) {
+            samplesMatch = samplesMatch && sink._samples[i] == static_cast<float>(i);
+        }
+        expect(samplesMatch) << "samples are forwarded unmodified and in order";
+        expect(eq(forward1.out.streamWriter().position(), 0UZ)) << "no samples copied";
+        expect(eq(forward2.out.streamWriter().position(), 0UZ)) << "no samples copied";
+
+        std::vector<Tag> userTags;
+        std::ranges::copy_if(sink._tags, std::back_inserter(userTags), [](const Tag& tag) { return tag.map.contains("key"); });
+        expect(eq(userTags.size(), src._tags.size()));
+        for (std::size_t i = 0UZ; i < std::min(userTags.size(), src._tags.size()); ++i) {
+            expect(eq(userTags[i].index, src._tags[i].index));
+            expect(userTags[i].map == src._tags[i].map);
+        }
+    };
+
+    "Copy keeps its own output buffer"_test = [] {
+        Graph graph;
+        auto& src  = graph.emplaceBlock<NullSource<float>>();
+        auto& copy = graph.emplaceBlock<Copy<float>>();
+        auto& sink = graph.emplaceBlock<NullSink<float>>();
+        expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(copy)));
+        expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(copy).to<"in">(sink)));
+        expect(graph.connectPendingEdges());
+
+        expect(eq(copy.out.nAliasedReaders(), 0UZ));
+        expect(eq(copy.out.nReaders(), 1UZ));
+        expect(eq(src.out.nReaders(), 1UZ));
+    };
 };
 
 const boost::ut::suite<"GraphExtensionsTests"> _2 = [] {
@@ -9,6 +9,7 @@
 #include <gnuradio-4.0/testing/NullSources.hpp>
 
 #include <chrono>
+#include <fstream>
 
 using TraceVectorType = std::vector<std::string>;
 
@@ -542,6 +543,44 @@ struct BusyLoopBlock : public gr::Block<BusyLoopBlock<T>> {
     }
 };
 
+/// locked process memory in kB ('VmLck' in /proc/self/status, 0 if unavailable)
+inline std::size_t lockedMemoryKiB() {
+    std::ifstream status("/proc/self/status");
+    std::string   line;
+    while (std::getline(status, line)) {
+        if (line.starts_with("VmLck:")) {
+            return static_cast<std::size_t>(std::stoull(line.substr(6UZ)));
+        }
+    }
+    return 0UZ;
+}
+
+/// records the real-time profile seen by its runner on the first 'processOne(..)' call: prefault hook, memory lock and scheduling policy
+template<typename T>
+struct RealtimeProfileProbe : public gr::Block<RealtimeProfileProbe<T>> {
+    gr::PortIn<T> in;
+
+    GR_MAKE_REFLECTABLE(RealtimeProfileProbe, in);
+
+    std::size_t                                  _nPrefaultCalls = 0UZ;
+    bool                                         _recorded       = false;
+    std::size_t                                  _lockedKiB      = 0UZ;
+    gr::thread_pool::thread::SchedulingParameter _runnerScheduling{};
+
+    std::size_t prefault() noexcept {
+        _nPrefaultCalls++;
+        return 0UZ;
+    }
+
+    void processOne(T) {
+        if (!_recorded) {
+            _recorded         = true;
+            _lockedKiB        = lockedMemoryKiB();
+            _runnerScheduling = gr::thread_pool::thread::getThreadSchedulingParameter();
+        }
+    }
+};
+
 const boost::ut::suite<"SchedulerTests"> SchedulerSettingsTests = [] {
     using namespace boost::ut;
     using namespace gr;
@@ -587,6 +626,41 @@ const boost::ut::suite<"SchedulerTests"> SchedulerSettingsTests = [] {
 
         expect(sched.runAndWait().has_value());
     };
+
+    "real-time profile applied and restored"_test = [] {
+        using namespace gr::thread_pool::thread;
+        const SchedulingParameter threadSchedulingBefore = getThreadSchedulingParameter(); // singleThreaded: the runner is the calling thread
+        const std::size_t         lockedBefore           = lockedMemoryKiB();
+
+        gr::Graph flow;
+        auto&     source = flow.emplaceBlock<gr::testing::ConstantSource<float>>({{"n_samples_max", gr::Size_t(10'000U)}});
+        auto&     probe  = flow.emplaceBlock<RealtimeProfileProbe<float>>();
+        expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(source).to<"in">(probe)));
+
+        gr::scheduler::Simple<> sched{{"prefault_buffers", true}, {"lock_memory", true}, {"runner_policy", std::string("FIFO")}, {"runner_priority", 1}};
+        if (auto ret = sched.exchange(std::move(flow)); !ret) {
+            expect(false) << std::format("couldn't initialise scheduler. error: {}", ret.error()) << fatal;
+        }
+        expect(sched.runAndWait().has_value());
+
+        expect(eq(probe._nPrefaultCalls, 1UZ)) << "prefault_buffers: block hook called once at start()";
+        expect(probe._recorded) << fatal;
+
+        if (probe._runnerScheduling.policy == Policy::FIFO) {
+            expect(eq(probe._runnerScheduling.priority, 1)) << "runner_priority applied";
+        } else {
+            std::println("N.B. insufficient privileges for SCHED_FIFO -- runner policy not applied, only its restoration is tested");
+        }
+        const SchedulingParameter threadSchedulingAfter = getThreadSchedulingParameter();
+        expect(threadSchedulingAfter.policy == threadSchedulingBefore.policy) << "runner_policy restored";
+        expect(eq(threadSchedulingAfter.priority, threadSchedulingBefore.priority)) << "runner_priority restored";
+
+        if (probe._lockedKiB > lockedBefore) {
+            expect(eq(lockedMemoryKiB(), lockedBefore)) << "lock_memory released at stop()";
+        } else {
+            std::println("N.B. insufficient privileges for mlockall(..) -- memory lock release not tested");
+        }
+    };
 };
 
 const boost::ut::suite<"SchedulerTests"> SchedulerTests = [] {
@@ -701,6 +775,23 @@ const boost::ut::suite<"SchedulerTests"> SchedulerTests = [] {
         expect(that % t.size() >= 8u);
     };
 
+    "SimpleScheduler_pinned_runners_restore_io_pool"_test = [] {
+        auto* ioPool = dynamic_cast<gr::thread_pool::ThreadPoolWrapper*>(gr::thread_pool::Manager::defaultIoPool().get());
+        expect(fatal(ioPool != nullptr));
+        const std::vector<bool> maskBefore = ioPool->impl().getAffinityMask();
+
+        std::shared_ptr<Tracer>                                              trace = std::make_shared<Tracer>();
+        gr::scheduler::Simple<gr::scheduler::ExecutionPolicy::multiThreaded> sched{{"pin_runners", true}};
+        if (auto ret = sched.exchange(getGraphLinear(trace)); !ret) {
+            expect(false) << std::format("couldn't initialise scheduler. error: {}", ret.error()) << fatal;
+        }
+        expect(sched.runAndWait().has_value());
+
+        const std::vector<bool> maskAfter = ioPool->impl().getAffinityMask();
+        const bool              restored  = maskAfter == maskBefore || (maskBefore.empty() && std::ranges::all_of(maskAfter, std::identity{}));
+        expect(restored) << std::format("shared IO pool affinity not restored: before [{}] after [{}]", gr::join(maskBefore, ", "), gr::join(maskAfter, ", "));
+    };
+
     "BreadthFirstScheduler_linear_multi_threaded"_test = [] {
         std::shared_ptr<Tracer>                                                    trace = std::make_shared<Tracer>();
         gr::scheduler::BreadthFirst<gr::scheduler::ExecutionPolicy::multiThreaded> sched;
@@ -1217,4 +1308,69 @@ const boost::ut::suite<"SchedulerTests"> SchedulerTests = [] {
     std::println("N.B. test-suite finished");
 };
 
+const boost::ut::suite<"BottleneckAnalyser"> BottleneckAnalyserTests = [] {
+    using namespace boost::ut;
+    using namespace gr;
+    using namespace std::string_literals;
+
+    auto blockMetrics = [](std::uint64_t processingTimeNs, std::vector<std::pair<std::string, std::uint64_t>> portFill) { // fill levels w.r.t. a buffer size of 100
+        std::vector<pmtv::pmt> ports;
+        for (const auto& [direction, fill] : portFill) {
+            ports.emplace_back(property_map{{"name"s, "port"s}, {"direction"s, direction}, {"bufferSize"s, std::uint64_t(100)}, {"fillLevel"s, fill}});
+        }
+        return property_map{{"nWorkCalls"s, std::uint64_t(1)}, {"processingTimeNs"s, processingTimeNs}, {"status"s, property_map{{"INSUFFICIENT_OUTPUT_ITEMS"s, std::uint64_t(0)}}}, {"ports"s, std::move(ports)}};
+    };
+
+    "identifies block with full inputs and empty outputs"_test = [&blockMetrics] {
+        gr::metrics::BottleneckAnalyser analyser(4UZ);
+        expect(analyser.analyse().empty());
+        for (std::uint64_t i = 0U; i < 8U; ++i) { // source -> A -> B (slow) -> sink
+            analyser.sample(property_map{
+                {"source"s, blockMetrics(10U * i, {{"OUTPUT"s, 95U}})},                      //
+                {"A"s, blockMetrics(20U * i, {{"INPUT"s, 95U}, {"OUTPUT"s, 90U + i % 2U}})}, //
+                {"B"s, blockMetrics(100U * i, {{"INPUT"s, 90U + i % 2U}, {"OUTPUT"s, 2U}})}, //
+                {"sink"s, blockMetrics(10U * i, {{"INPUT"s, 2U}})}});
+        }
+        expect(eq(analyser.nSamples(), 8UZ));
+
+        const auto loads = analyser.analyse();
+        expect(eq(loads.size(), 4UZ)) << fatal;
+        expect(eq(loads.front().name, "B"s));
+        expect(approx(loads.front().inputFill, 0.905, 1e-9));
+        expect(approx(loads.front().outputFill, 0.02, 1e-9));
+        expect(approx(loads.front().processingShare, 300. / 420., 1e-9)) << "window deltas: 30 + 60 + 300 + 30";
+
+        const property_map report = analyser.toPropertyMap();
+        expect(eq(std::get<std::string>(report.at("bottleneck"s)), "B"s));
+        expect(eq(std::get<property_map>(report.at("blocks"s)).size(), 4UZ));
+
+        analyser.sample(property_map{{"sink"s, blockMetrics(0U, {{"INPUT"s, 0U}})}}); // removed blocks are dropped
+        expect(eq(analyser.analyse().size(), 1UZ));
+        analyser.reset();
+        expect(eq(analyser.nSamples(), 0UZ));
+    };
+
+    "slow source and slow sink"_test = [&blockMetrics] {
+        gr::metrics::BottleneckAnalyser analyser;
+        analyser.sample(property_map{{"source"s, blockMetrics(0U, {{"OUTPUT"s, 0U}})}, {"filter"s, blockMetrics(0U, {{"INPUT"s, 0U}, {"OUTPUT"s, 0U}})}, {"sink"s, blockMetrics(0U, {{"INPUT"s, 0U}})}});
+        expect(eq(analyser.analyse().front().name, "source"s)) << "all buffers empty -> source-limited";
+
+        analyser.reset();
+        analyser.sample(property_map{{"source"s, blockMetrics(0U, {{"OUTPUT"s, 100U}})}, {"filter"s, blockMetrics(0U, {{"INPUT"s, 100U}, {"OUTPUT"s, 100U}})}, {"sink"s, blockMetrics(0U, {{"INPUT"s, 100U}})}});
+        expect(eq(analyser.analyse().front().name, "sink"s)) << "all buffers full -> sink-limited";
+    };
+
+    "scheduler sampling"_test = [] {
+        std::shared_ptr<Tracer> trace = std::make_shared<Tracer>();
+        gr::scheduler::Simple<> sched;
+        sched.bottleneck_sample_period = 1U;
+        if (auto ret = sched.exchange(getGraphLinear(trace)); !ret) {
+            expect(false) << std::format("couldn't initialise scheduler. error: {}", ret.error()) << fatal;
+        }
+        expect(sched.runAndWait().has_value());
+        expect(eq(sched.bottleneckAnalyser().analyse().size(), gr::graph::countBlocks<block::Category::TransparentBlockGroup>(sched.graph(), block::Category::NormalBlock))) //
+            << "one entry per block once sampled";
+    };
+};
+
 int main() { /* tests are statically executed */ }
@@ -25,8 +25,9 @@ TestContext* context = new TestContext(paths{}, // plugin paths
     gr::blocklib::initGrBasicBlocks,            //
     gr::blocklib::initGrTestingBlocks);
 
-class TestScheduler {
-    using TScheduler = gr::scheduler::Simple<gr::scheduler::ExecutionPolicy::singleThreaded>;
+template<gr::scheduler::ExecutionPolicy executionPolicy = gr::scheduler::ExecutionPolicy::singleThreaded>
+class BasicTestScheduler {
+    using TScheduler = gr::scheduler::Simple<executionPolicy>;
     std::future<std::expected<void, gr::Error>> schedulerRet_;
 
     gr::Graph& withTestingSourceAndSink(gr::Graph& graph) const noexcept {
@@ -40,8 +41,8 @@ public:
     gr::MsgPortOut toScheduler;
     gr::MsgPortIn  fromScheduler;
 
-    TestScheduler(gr::Graph graph, bool addTestSourceAndSink = true) {
-        if (auto ret = scheduler_.exchange(addTestSourceAndSink ? std::move(withTestingSourceAndSink(graph)) : std::move(graph)); !ret) {
+    BasicTestScheduler(gr::Graph graph, bool addTestSourceAndSink = true, std::string_view poolName = gr::thread_pool::kDefaultCpuPoolId) {
+        if (auto ret = scheduler_.exchange(addTestSourceAndSink ? std::move(withTestingSourceAndSink(graph)) : std::move(graph), poolName); !ret) {
             throw std::runtime_error(std::format("failed to initialize scheduler: {}", ret.error()));
         }
         using namespace gr::testing;
@@ -51,12 +52,12 @@ public:
         run();
     }
 
-    ~TestScheduler() { stop(); }
+    ~BasicTestScheduler() { stop(); }
 
-    TestScheduler(const TestScheduler&)            = delete;
-    TestScheduler& operator=(const TestScheduler&) = delete;
-    TestScheduler(TestScheduler&&)                 = delete;
-    TestScheduler& operator=(TestScheduler&&)      = delete;
+    BasicTestScheduler(const BasicTestScheduler&)            = delete;
+    BasicTestScheduler& operator=(const BasicTestScheduler&) = delete;
+    BasicTestScheduler(BasicTestScheduler&&)                 = delete;
+    BasicTestScheduler& operator=(BasicTestScheduler&&)      = delete;
 
     void run() {
         schedulerRet_ = gr::test::thread_pool::executeScheduler("qa_SchMess::scheduler", scheduler_);
@@ -88,6 +89,75 @@ public:
     std::expected<void, gr::Error> changeStateTo(gr::lifecycle::State state) { return scheduler_.changeStateTo(state); }
 };
 
+using TestScheduler = BasicTestScheduler<>;
+
+namespace {
+/// endless counting source emitting a 'trigger_time' tag that carries the sample index every 'tag_interval' samples
+template<typename T>
+struct TaggedCountingSource : gr::Block<TaggedCountingSource<T>> {
+    gr::PortOut<T> out;
+
+    gr::Size_t tag_interval = 97U;
+    gr::Size_t chunk_size   = 64U; // max. samples per 'work(..)' call -> many sample boundaries
+
+    GR_MAKE_REFLECTABLE(TaggedCountingSource, out, tag_interval, chunk_size);
+
+    std::uint64_t _nSamplesProduced = 0U;
+
+    gr::work::Status processBulk(gr::OutputSpanLike auto& outSpan) {
+        const std::size_t nSamples = std::min(outSpan.size(), static_cast<std::size_t>(chunk_size));
+        for (std::size_t i = 0UZ; i < nSamples; ++i) {
+            const std::uint64_t index = _nSamplesProduced + i;
+            outSpan[i]                = static_cast<T>(index);
+            if (index % tag_interval == 0U) {
+                outSpan.publishTag(gr::property_map{{std::string(gr::tag::TRIGGER_TIME.shortKey()), index}}, i);
+            }
+        }
+        outSpan.publish(nSamples);
+        _nSamplesProduced += nSamples;
+        return gr::work::Status::OK;
+    }
+};
+
+/// checks on-the-fly (i.e. without storing) that every sample and every 'trigger_time' tag of 'TaggedCountingSource' arrives exactly once and in order
+template<typename T>
+struct ContinuitySink : gr::Block<ContinuitySink<T>> {
+    gr::PortIn<T> in;
+
+    gr::Size_t tag_interval = 97U;
+
+    GR_MAKE_REFLECTABLE(ContinuitySink, in, tag_interval);
+
+    std::atomic<std::uint64_t> _nSamples{0U};
+    std::atomic<std::uint64_t> _nTags{0U};
+    std::atomic<std::uint64_t> _nSampleErrors{0U};
+    std::atomic<std::uint64_t> _nTagErrors{0U};
+
+    void processOne(const T& sample) {
+        const std::uint64_t expected = _nSamples.load(std::memory_order_relaxed);
+        if (sample != static_cast<T>(expected)) {
+            _nSampleErrors.fetch_add(1U, std::memory_order_relaxed);
+        }
+
+        bool hasTag = false;
+        if (this->inputTagsPresent()) {
+            const auto& map = this->mergedInputTag().map;
+            if (auto it = map.find(std::string(gr::tag::TRIGGER_TIME.shortKey())); it != map.end()) {
+                hasTag = true;
+                _nTags.fetch_add(1U, std::memory_order_relaxed);
+                if (const auto* index = std::get_if<std::uint64_t>(&it->second); index == nullptr || *index != expected) {
+                    _nTagErrors.fetch_add(1U, std::memory_order_relaxed); // tag at the wrong sample
+                }
+            }
+        }
+        if (hasTag != (expected % tag_interval == 0U)) {
+            _nTagErrors.fetch_add(1U, std::memory_order_relaxed); // missing or spurious tag
+        }
+        _nSamples.store(expected + 1U, std::memory_order_release);
+    }
+};
+} // namespace
+
 const boost::ut::suite TopologyGraphTests = [] {
     using namespace std::string_literals;
     using namespace boost::ut;
@@ -223,6 +293,56 @@ const boost::ut::suite TopologyGraphTests = [] {
         };
     };
 
+    constexpr auto replacementPolicies = std::tuple<std::integral_constant<ExecutionPolicy, ExecutionPolicy::singleThreaded>, std::integral_constant<ExecutionPolicy, ExecutionPolicy::multiThreaded>>{};
+
+    "gap-free block replacement while running"_test = []<typename SchedulerPolicy> {
+        gr::Graph graph(context->loader);
+
+        auto& source = graph.emplaceBlock<TaggedCountingSource<double>>();
+        auto& copy   = graph.emplaceBlock("gr::testing::Copy<float64>", {});
+        auto& sink   = graph.emplaceBlock<ContinuitySink<double>>();
+        expect(eq(graph.connect(source, "out"s, copy, "in"s), ConnectionResult::SUCCESS));
+        expect(eq(graph.connect(copy, "out"s, sink, "in"s), ConnectionResult::SUCCESS));
+        std::string middleBlock(copy->uniqueName());
+
+        // multiThreaded: dedicated pool with one runner per block, i.e. the replacement is handed over across runners
+        constexpr std::string_view poolName = "qa_SchMess::replacement";
+        if constexpr (SchedulerPolicy::value == ExecutionPolicy::multiThreaded) {
+            using namespace gr::thread_pool;
+            Manager::instance().replacePool(std::string(poolName), std::make_shared<ThreadPoolWrapper>(std::make_unique<BasicThreadPool>(std::string(poolName), TaskType::CPU_BOUND, 3U, 3U), "CPU"));
+        }
+        BasicTestScheduler<SchedulerPolicy::value> scheduler(std::move(graph), false, SchedulerPolicy::value == ExecutionPolicy::multiThreaded ? poolName : gr::thread_pool::kDefaultCpuPoolId);
+        if constexpr (SchedulerPolicy::value == ExecutionPolicy::multiThreaded) {
+            const auto jobs = scheduler.scheduler().jobs();
+            expect(fatal(eq(jobs->size(), 3UZ)));
+            expect(std::ranges::all_of(*jobs, [](const auto& jobList) { return jobList.size() == 1UZ; })) << "source, middle block and sink on different runners";
+        }
+
+        const auto awaitMoreSamples = [&sink](std::uint64_t nSamples) {
+            const std::uint64_t target = sink._nSamples.load(std::memory_order_acquire) + nSamples;
+            return awaitCondition(5s, [&sink, target] { return sink._nSamples.load(std::memory_order_acquire) >= target; });
+        };
+
+        for (std::size_t replacement = 0UZ; replacement < 3UZ; ++replacement) {
+            expect(awaitMoreSamples(10'000U)) << std::format("data is flowing before replacement #{}", replacement);
+            auto reply = testing::sendAndWaitForReply<Set>(scheduler.toScheduler, scheduler.fromScheduler, scheduler.unique_name(), scheduler::property::kReplaceBlock, //
+                {{"uniqueName", middleBlock}, {"type", "gr::testing::Copy<float64>"}, {"properties", property_map{}}},                                                  //
+                ReplyChecker{.expectedEndpoint = scheduler::property::kBlockReplaced});
+            expect(fatal(reply.has_value()));
+            const std::string newBlock = std::get<std::string>(reply->data.value().at("unique_name"s));
+            expect(neq(newBlock, middleBlock));
+            middleBlock = newBlock;
+        }
+        expect(awaitMoreSamples(10'000U)) << "data is flowing through the last replacement";
+
+        expect(eq(scheduler.graph().blocks().size(), 3UZ));
+        expect(std::ranges::any_of(scheduler.graph().blocks(), [&middleBlock](const auto& block) { return block->uniqueName() == middleBlock && block->state() == lifecycle::State::RUNNING; }));
+        expect(gt(sink._nSamples.load(), 40'000UZ));
+        expect(gt(sink._nTags.load(), 400UZ));
+        expect(eq(sink._nSampleErrors.load(), 0UZ)) << "samples lost, duplicated or reordered across the swap";
+        expect(eq(sink._nTagErrors.load(), 0UZ)) << "tags lost, duplicated or misplaced across the swap";
+    } | replacementPolicies;
+
     "Edge addition tests"_test = [&] {
         gr::Graph testGraph(context->loader);
 
@@ -370,6 +490,75 @@ const boost::ut::suite TopologyGraphTests = [] {
             });
     };
 
+    "Get GRC binary tests"_test = [] {
+        gr::Graph testGraph(context->loader);
+        testGraph.emplaceBlock("gr::testing::Copy<float32>", {});
+        testGraph.emplaceBlock("gr::testing::Copy<float32>", {});
+
+        TestScheduler scheduler(std::move(testGraph));
+
+        testing::sendAndWaitForReply<Get>(scheduler.toScheduler, scheduler.fromScheduler, scheduler.unique_name(), //
+            scheduler::property::kGraphGRC, {{"format", std::string("binary")}}, [](const Message& reply) {
+                if (reply.endpoint == scheduler::property::kGraphGRC && reply.data.has_value()) {
+                    const auto& data = reply.data.value();
+                    expect(data.contains("value")) << "Reply should contain 'value' field";
+                    const auto& binary = std::get<std::vector<std::uint8_t>>(data.at("value"));
+                    expect(pmtv::binary::isBinary(binary));
+
+                    auto graphFromBinary = gr::loadGrc(context->loader, std::span<const std::uint8_t>(binary));
+                    expect(eq(graphFromBinary.blocks().size(), 4UZ)) << std::format("Expected 4 blocks in loaded graph, got {} blocks", graphFromBinary.blocks().size());
+
+                    return true;
+                }
+
+                return false;
+            });
+    };
+
+    "Get block metrics"_test = [] {
+        gr::Graph testGraph(context->loader);
+        testGraph.emplaceBlock("gr::testing::Copy<float32>", {});
+
+        TestScheduler scheduler(std::move(testGraph));
+
+        testing::sendAndWaitForReply<Get>(scheduler.toScheduler, scheduler.fromScheduler, scheduler.unique_name(), //
+            scheduler::property::kBlockMetrics, {}, [](const Message& reply) {
+                if (reply.endpoint == scheduler::property::kBlockMetrics && reply.data.has_value()) {
+                    const auto& data = reply.data.value();
+                    expect(eq(data.size(), 3UZ)) << "one entry per block";
+                    for (const auto& [uniqueName, value] : data) {
+                        const auto& metrics = std::get<property_map>(value);
+                        expect(metrics.contains("nWorkCalls")) << uniqueName;
+                        expect(metrics.contains("processingTimeNs")) << uniqueName;
+                        expect(std::get<property_map>(metrics.at("status")).contains("INSUFFICIENT_OUTPUT_ITEMS")) << uniqueName;
+                        expect(metrics.contains("ports")) << uniqueName;
+                    }
+                    return true;
+                }
+                return false;
+            });
+    };
+
+    "Get bottleneck analysis"_test = [] {
+        gr::Graph testGraph(context->loader);
+        testGraph.emplaceBlock("gr::testing::Copy<float32>", {});
+
+        TestScheduler scheduler(std::move(testGraph));
+
+        testing::sendAndWaitForReply<Get>(scheduler.toScheduler, scheduler.fromScheduler, scheduler.unique_name(), //
+            scheduler::property::kBottleneck, {}, [](const Message& reply) {
+                if (reply.endpoint == scheduler::property::kBottleneck && reply.data.has_value()) {
+                    const auto& data = reply.data.value();
+                    expect(ge(std::get<std::uint64_t>(data.at("nSamples")), 1UZ)) << "sampled on request";
+                    const auto& blocks = std::get<property_map>(data.at("blocks"));
+                    expect(eq(blocks.size(), 3UZ)) << "one entry per block";
+                    expect(blocks.contains(std::get<std::string>(data.at("bottleneck"))));
+                    return true;
+                }
+                return false;
+            });
+    };
+
     "UI constraints setting test"_test = [] {
         gr::Graph testGraph(context->loader);
         auto&     copy1 = testGraph.emplaceBlock("gr::testing::Copy<float32>", {});
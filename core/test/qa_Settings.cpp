@@ -890,6 +890,35 @@ const boost::ut::suite CtxSettingsTests = [] {
         testStored(sinkOne);
     };
 
+    "CtxSettings tag key fast-path"_test = [] {
+        constexpr settings::StaticKeyIndex<3UZ> keys({"sample_rate", "signal_name", "n_samples_max"}, {4UZ, 7UZ, 9UZ});
+        static_assert(keys.contains("sample_rate"));
+        static_assert(keys.find("n_samples_max") == 9UZ);
+        static_assert(!keys.contains("trigger_time"));
+        static_assert(!keys.contains("sample_rat"));
+        static_assert(!keys.contains(""));
+
+        constexpr const auto& recorderKeys = settings::writableMemberKeys<SettingsChangeRecorder<float>>;
+        static_assert(recorderKeys.contains("scaling_factor"));
+        static_assert(recorderKeys.contains("name"));
+        static_assert(!recorderKeys.contains(gr::tag::TRIGGER_TIME.shortKey()));
+
+        auto block = SettingsChangeRecorder<float>();
+        block.init(block.progress); // N.B. self-assign existing progress and thread-pool (just for unit-tests)
+        std::ignore = block.settings().applyStagedParameters();
+        block.settings().setChanged(false);
+        expect(eq(recorderKeys.size(), block.settings().autoUpdateParameters().size())) << "all writable members are auto-updatable by default";
+
+        block.settings().autoUpdate(Tag{0, {{gr::tag::TRIGGER_TIME.shortKey(), std::uint64_t(42)}, {"local_time", std::uint64_t(43)}}});
+        expect(!block.settings().changed()) << "tag without writable keys must be rejected";
+        expect(block.settings().stagedParameters().empty());
+
+        block.settings().autoUpdate(Tag{0, {{gr::tag::TRIGGER_TIME.shortKey(), std::uint64_t(42)}, {"scaling_factor", 3.f}}});
+        expect(block.settings().changed());
+        expect(eq(block.settings().stagedParameters().size(), 1UZ));
+        expect(eq(std::get<float>(block.settings().stagedParameters().at("scaling_factor")), 3.f));
+    };
+
     "CtxSettings supported context types"_test = [&] {
         Graph      testGraph;
         auto&      block    = testGraph.emplaceBlock<SettingsChangeRecorder<int>>({{"scaling_factor", 1}});
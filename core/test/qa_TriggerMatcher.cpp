@@ -250,6 +250,62 @@ const boost::ut::suite<"BasicTriggerNameCtxMatcher"> triggerTest = [] {
             expect(eq(matcher(filter, createTag("alarm", "room1"), state), Matching));
         };
     };
+
+    "Compiled matcher"_test = [] {
+        using namespace std::string_literals;
+        using enum gr::trigger::MatchResult;
+        using namespace gr::trigger::BasicTriggerNameCtxMatcher;
+        constexpr auto createTag = [](std::string triggerName, std::string cxt) noexcept { return Tag(0, {{tag::TRIGGER_NAME.shortKey(), triggerName}, {tag::CONTEXT.shortKey(), cxt}}); };
+
+        "parsing"_test = [] {
+            expect(!Compiled().isSingleTrigger());
+            expect(eq(Compiled().definition(), ""s));
+
+            const Compiled range("[^alarm/room1, alarm/^room3]");
+            expect(eq(range.definition(), "[^alarm/room1, alarm/^room3]"s));
+            expect(!range.isSingleTrigger());
+            expect(eq(range.criteria().start.triggerName, "alarm"s));
+            expect(eq(range.criteria().start.ctx, "room1"s));
+            expect(range.criteria().start.triggerNameEnds);
+            expect(eq(range.criteria().stop.ctx, "room3"s));
+            expect(range.criteria().stop.ctxEnds);
+
+            const Compiled stopOnly("[, alarm/room1]");
+            expect(stopOnly.isSingleTrigger());
+            expect(eq(stopOnly.criteria().start.triggerName, "alarm"s)) << "single stop trigger acts as start trigger";
+
+            expect(Compiled("[alarm/room1, alarm/room1]").isSingleTrigger());
+            expect(throws([] { std::ignore = Compiled("[alarm/room1"); }));
+            expect(throws([] { std::ignore = Compiled("alarm/room1/cabinet"); }));
+        };
+
+        "same results as filter(...)"_test = [&createTag] {
+            const std::vector<std::string> criteria = {"[alarm/room1, alarm/room3]", "[alarm/room1, alarm/^room3]", "[alarm/^room1, alarm/^room3]", "[^alarm/room1, alarm/room3]", "[^alarm/^room1, ^alarm/room3]", "[alarm/room1]", "[, alarm/room1]", "[/room2, /room3]", "alarm", ""};
+            const std::vector<Tag>         tags     = {Tag{}, createTag("alarm", "room1"), createTag("alarm", "room1"), createTag("other", "room2"), createTag("alarm", "room2"), createTag("alarm", "room3"), createTag("info", "room3"), //
+                                createTag("alarm", "room4"), createTag("alarm", "room1"), createTag("other", "room1"), createTag("alarm", "room3"), createTag("other", "room4"), createTag("", ""), createTag("alarm", "room2")};
+            for (const auto& definition : criteria) {
+                const Compiled matcher(definition);
+                State          state;
+                property_map   filterState;
+                for (std::size_t i = 0UZ; i < tags.size(); ++i) {
+                    const MatchResult expected = filter(definition, tags[i], filterState);
+                    expect(eq(matcher(tags[i], state), expected)) << std::format("criteria '{}' tag #{}", definition, i);
+                    expect(eq(state.triggerActive, std::get<bool>(filterState.at("triggerActive"))));
+                }
+                expect(eq(matcher.isSingleTrigger(), isSingleTrigger(filterState))) << std::format("criteria '{}'", definition);
+            }
+        };
+
+        "independent states"_test = [&createTag] {
+            const Compiled matcher("[alarm/room1, alarm/room3]");
+            State          first;
+            State          second;
+            expect(eq(matcher(createTag("alarm", "room1"), first), Matching));
+            expect(eq(matcher(createTag("alarm", "room3"), second), Ignore)) << "second window not started";
+            expect(eq(matcher(createTag("alarm", "room3"), first), NotMatching));
+            expect(!first.triggerActive);
+        };
+    };
 };
 
 int main() { /* not needed for UT */ }
@@ -1,6 +1,7 @@
 #include "pmtv/pmt.hpp"
 #include <boost/ut.hpp>
 
+#include <cmath>
 #include <cstdint>
 #include <gnuradio-4.0/meta/formatter.hpp>
 
@@ -911,6 +912,78 @@ list2: !!float32
         };
     };
 
+    "typed numeric sequences - fast path"_test = [] {
+        // the from_chars fast path must yield exactly what the generic per-element parser yields (incl. errors)
+        const auto parseBoth = [](std::string_view src, std::source_location location = std::source_location::current()) {
+            const auto fast    = yaml::detail::deserialize(src, true);
+            const auto generic = yaml::detail::deserialize(src, false);
+            expect(eq(fast.has_value(), generic.has_value()), location) << src;
+            if (fast.has_value() && generic.has_value()) {
+                expect(!diff(*generic, *fast), location) << src;
+            } else {
+                expect(eq(formatResult(fast), formatResult(generic)), location) << src;
+            }
+            return fast;
+        };
+
+        const auto blockStyle = parseBoth(R"(
+taps: !!float32
+  - 0.5
+  -   -0.25   # comment
+  # comment line
+
+  - .inf
+  - -.inf
+  - .nan
+  - +1.5
+  - 1e3
+ints: !!int32
+  - 0x1F
+  - 0o17
+  - 0b101
+  - -42
+next: 1
+)");
+        expect(blockStyle.has_value()) << fatal;
+        const auto& taps = std::get<std::vector<float>>(blockStyle->at("taps"s));
+        expect(eq(taps.size(), 8UZ)) << fatal;
+        expect(eq(taps[0], 0.5f));
+        expect(eq(taps[1], -0.25f));
+        expect(std::isinf(taps[2]) && taps[2] > 0.f);
+        expect(std::isinf(taps[3]) && taps[3] < 0.f);
+        expect(std::isnan(taps[4]));
+        expect(eq(taps[5], 1.5f));
+        expect(eq(taps[6], 1000.f));
+        expect(std::get<std::vector<std::int32_t>>(blockStyle->at("ints"s)) == std::vector<std::int32_t>{31, 15, 5, -42});
+        expect(eq(std::get<std::int64_t>(blockStyle->at("next"s)), std::int64_t(1)));
+
+        const auto flowStyle = parseBoth(R"(
+taps: !!float64 [0.5, -0.25 ,  1e-3, .nan]
+multiLine: !!uint8 [1, 2,
+    3, 255]
+empty: !!int16 []
+)");
+        expect(flowStyle.has_value()) << fatal;
+        expect(eq(std::get<std::vector<double>>(flowStyle->at("taps"s)).size(), 4UZ));
+        expect(std::get<std::vector<std::uint8_t>>(flowStyle->at("multiLine"s)) == std::vector<std::uint8_t>{1U, 2U, 3U, 255U});
+        expect(std::get<std::vector<std::int16_t>>(flowStyle->at("empty"s)).empty());
+
+        // sequences the fast path declines and hands over to the generic parser
+        parseBoth("values: !!float32 [1.0, \"2.0\", 3.0]");
+        parseBoth("values: !!float32 [1.0, 2.0 # comment\n  , 3.0]");
+        parseBoth("values: !!str [a, b]");
+        parseBoth("values: !!bool\n  - true\n  - false");
+        parseBoth("values: !!complex64\n  - (1.0, -1.0)");
+
+        // errors are reported by the generic parser
+        parseBoth("values: !!float32 [1.0, abc, 3.0]");
+        parseBoth("values: !!int8 [1, 300]");
+        parseBoth("values: !!int32\n  - 1\n  - 2.5x\n");
+        parseBoth("values: !!float32\n  - 1.0\n  - !!float64 2.0\n");
+        parseBoth("values: !!float32\n  - 1.0\n  - [2.0]\n");
+        parseBoth("values: !!float32 [1.0, 2.0");
+    };
+
     "Odd Keys"_test = [] {
         constexpr std::string_view src = R"yaml(
 : empty key
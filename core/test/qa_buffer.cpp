@@ -557,6 +557,83 @@ const boost::ut::suite CircularBufferTests = [] {
         reader1Thread.join();
         reader2Thread.join();
     };
+
+    "prefault"_test = [] {
+        std::vector<std::int32_t> raw(3UZ * gr::memory::pageSize() / sizeof(std::int32_t) + 1UZ);
+        std::iota(raw.begin(), raw.end(), 0);
+        expect(eq(gr::memory::prefault(raw.data(), raw.size() * sizeof(std::int32_t)), 4UZ));
+        expect(eq(gr::memory::prefault(nullptr, 42UZ), 0UZ));
+        expect(raw.back() == static_cast<std::int32_t>(raw.size() - 1UZ)) << "content preserved";
+
+        gr::CircularBuffer<std::int32_t> buffer(1024);
+        auto                             writer = buffer.new_writer();
+        auto                             reader = buffer.new_reader();
+        expect(gt(buffer.prefault(), 0UZ));
+        {
+            auto out = writer.tryReserve(4UZ);
+            std::iota(out.begin(), out.end(), 1);
+            out.publish(4UZ);
+        }
+        expect(gt(buffer.prefault(), 0UZ));
+        auto in = reader.get(4UZ);
+        expect(std::ranges::equal(in, std::array{1, 2, 3, 4})) << "content preserved";
+        expect(in.consume(4UZ));
+
+        gr::HistoryBuffer<double> history(1024UZ);
+        history.push_back(42.0);
+        expect(gt(history.prefault(), 0UZ));
+        expect(eq(history[0], 42.0));
+    };
+
+    "gated reader"_test = [] {
+        gr::CircularBuffer<std::int32_t> buffer(1024);
+        auto                             writer = buffer.new_writer();
+        auto                             reader = buffer.new_reader();                        // e.g. the input of a pass-through block
+        auto                             gated  = buffer.new_reader(reader.readSequence()); // e.g. the aliased downstream input
+        expect(gated.isGated());
+        expect(!reader.isGated());
+        expect(eq(buffer.n_readers(), 2UZ));
+        {
+            auto out = writer.tryReserve(8UZ);
+            std::iota(out.begin(), out.end(), 1);
+            out.publish(8UZ);
+        }
+        expect(eq(reader.available(), 8UZ));
+        expect(eq(gated.available(), 0UZ)) << "nothing forwarded yet";
+
+        expect(reader.get(3UZ).consume(3UZ));
+        expect(eq(gated.available(), 3UZ));
+        {
+            auto in = gated.get(gated.available());
+            expect(std::ranges::equal(in, std::array{1, 2, 3}));
+            expect(in.consume(3UZ));
+        }
+        expect(eq(gated.available(), 0UZ));
+
+        // the gated reader back-pressures the writer like any other reader
+        expect(reader.get(5UZ).consume(5UZ));
+        expect(eq(writer.available(), buffer.size() - 5UZ)) << "gated reader still holds 5 samples";
+        expect(gated.get(5UZ).consume(5UZ));
+        expect(eq(writer.available(), buffer.size()));
+
+        // late-created gated reader starts at the gate position
+        auto late = buffer.new_reader(reader.readSequence());
+        expect(eq(late.position(), reader.position()));
+        expect(eq(late.available(), 0UZ));
+
+        // ungated reader created at a given start position, e.g. the aliased tag reader starting at the forwarded input's tag position
+        {
+            auto out = writer.tryReserve(4UZ);
+            std::iota(out.begin(), out.end(), 9);
+            out.publish(4UZ);
+        }
+        auto tagLike = buffer.new_reader(nullptr, reader.position());
+        expect(!tagLike.isGated());
+        expect(eq(tagLike.position(), reader.position()));
+        expect(eq(tagLike.available(), 4UZ)) << "includes samples published before the reader was created";
+        auto ahead = buffer.new_reader(nullptr, std::numeric_limits<std::size_t>::max());
+        expect(eq(ahead.available(), 0UZ)) << "start position is capped at the publish cursor";
+    };
 };
 
 const boost::ut::suite UserDefinedTypeCasting = [] {
@@ -970,6 +1047,29 @@ const boost::ut::suite HistoryBufferTest = [] {
         hb2.pop_back(); // remove '5'
         expect(eq(hb2[hb2.size() - 1], 4));
     };
+
+    "HistoryBuffer - bulk push_front and contiguous views"_test = [] {
+        HistoryBuffer<int> bulk(5);
+        HistoryBuffer<int> single(5);
+        for (const std::vector<int>& chunk : {std::vector<int>{1, 2, 3}, std::vector<int>{4, 5}, std::vector<int>{6, 7, 8, 9}, std::vector<int>{}, std::vector<int>{10, 11, 12, 13, 14, 15, 16}}) {
+            bulk.push_front(chunk);
+            for (const int value : chunk) {
+                single.push_front(value);
+            }
+            expect(eq(bulk.size(), single.size()));
+            expect(std::ranges::equal(bulk, single)) << "bulk push_front equals element-wise push_front";
+            expect(std::ranges::equal(bulk.first(bulk.size()), single)) << "contiguous view across the wrap-around";
+        }
+        expect(std::ranges::equal(bulk.first(3UZ), std::array{16, 15, 14})) << "newest first";
+        expect(std::ranges::equal(bulk.last(2UZ), std::array{13, 12}));
+        expect(eq(bulk.first(42UZ).size(), 5UZ)) << "clamped to size()";
+
+        HistoryBuffer<int, 4> fixed;
+        fixed.push_back(std::array{1, 2, 3});
+        fixed.push_back(std::array{4, 5});
+        expect(std::ranges::equal(fixed.last(2UZ), std::array{4, 5})) << "newest last in push_back usage";
+        expect(std::ranges::equal(fixed.first(4UZ), std::array{2, 3, 4, 5}));
+    };
 };
 
 int main() { /* not needed for UT */ }
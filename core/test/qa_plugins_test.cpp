@@ -1,5 +1,8 @@
 #include <array>
 #include <cassert>
+#include <filesystem>
+#include <format>
+#include <fstream>
 #include <iostream>
 
 #include <boost/ut.hpp>
@@ -167,4 +170,64 @@ const boost::ut::suite BasicPluginBlocksConnectionTests = [] {
     };
 };
 
+const boost::ut::suite PluginManifestTests = [] {
+    using namespace boost::ut;
+    using namespace gr;
+
+    const std::filesystem::path manifestFile = std::filesystem::temp_directory_path() / std::format("qa_plugins_manifest.{}.txt", ::getpid());
+    std::filesystem::remove(manifestFile);
+    const paths pluginPaths{"core/test/plugins", "test/plugins", "plugins"};
+
+    "cold start writes manifest"_test = [&] {
+        BlockRegistry registry;
+        PluginLoader  loader(registry, pluginPaths, manifestFile);
+        expect(std::filesystem::exists(manifestFile));
+        expect(gt(loader.nLoadedPlugins(), 0UZ)) << "plugins are loaded once to discover their blocks";
+
+        const PluginManifest manifest = PluginManifest::read(manifestFile);
+        expect(!manifest.entries.empty());
+        expect(std::ranges::any_of(manifest.entries, [](const auto& entry) { return std::ranges::find(entry.second.blockNames, "good::divide<float64>") != entry.second.blockNames.end(); }));
+        expect(std::ranges::any_of(manifest.entries, [](const auto& entry) { return entry.first.ends_with("bad_plugin.so") && !entry.second.status.empty(); }));
+    };
+
+    "warm start loads plugins lazily"_test = [&] {
+        BlockRegistry registry;
+        PluginLoader  loader(registry, pluginPaths, manifestFile);
+        expect(eq(loader.nLoadedPlugins(), 0UZ));
+        expect(!loader.failedPlugins().empty()) << "known-bad plugins are reported from the manifest";
+
+        auto known = loader.availableBlocks();
+        expect(std::ranges::find(known, "good::divide<float64>") != known.end());
+        expect(eq(loader.nLoadedPlugins(), 0UZ));
+
+        expect(loader.instantiate("good::divide<float64>") != nullptr);
+        expect(eq(loader.nLoadedPlugins(), 1UZ));
+        expect(loader.isBlockAvailable("good::multiply<float64>"));
+        expect(!loader.isBlockAvailable("ThisBlockDoesNotExist<float64>"));
+
+        loader.loadAll();
+        expect(eq(loader.nLoadedPlugins(), loader.plugins().size()));
+    };
+
+    "corrupt manifest triggers rescan"_test = [&] {
+        {
+            std::ofstream out(manifestFile, std::ios::trunc);
+            out << PluginManifest::kHeader << "\nP\tnot-a-number\n";
+        }
+        BlockRegistry registry;
+        PluginLoader  loader(registry, pluginPaths, manifestFile);
+        expect(gt(loader.nLoadedPlugins(), 0UZ));
+        expect(!PluginManifest::read(manifestFile).entries.empty());
+    };
+
+    "disabled manifest"_test = [&] {
+        BlockRegistry registry;
+        PluginLoader  loader(registry, pluginPaths, std::filesystem::path{});
+        expect(loader.manifestFile().empty());
+        expect(loader.instantiate("good::fixed_source<float64>") != nullptr);
+    };
+
+    std::filesystem::remove(manifestFile);
+};
+
 int main() { /* not needed for UT */ }
@@ -1,7 +1,10 @@
 #include <boost/ut.hpp>
 
+#include <filesystem>
 #include <format>
+#include <fstream>
 
+#include <gnuradio-4.0/thread/cpu_topology.hpp>
 #include <gnuradio-4.0/thread/thread_affinity.hpp>
 
 const boost::ut::suite ThreadAffinityTests = [] {
@@ -28,6 +31,82 @@ const boost::ut::suite ThreadAffinityTests = [] {
         expect(that % gr::thread_pool::thread::detail::getEnumPolicy(-2) == gr::thread_pool::thread::Policy::UNKNOWN);
     };
 
+    "parse cpu list"_test = [] {
+        using gr::thread_pool::thread::detail::parseCpuList;
+        expect(parseCpuList("") == std::vector<std::size_t>{});
+        expect(parseCpuList("3\n") == std::vector<std::size_t>{3UZ});
+        expect(parseCpuList("0-3,8,10-11\n") == std::vector<std::size_t>{0UZ, 1UZ, 2UZ, 3UZ, 8UZ, 10UZ, 11UZ});
+        expect(parseCpuList(" 2 , 5-4,x,6") == std::vector<std::size_t>{2UZ, 6UZ}) << "skips malformed entries";
+    };
+
+    "cpu topology and placement"_test = [] {
+        using namespace gr::thread_pool::thread;
+        namespace fs = std::filesystem;
+
+        // 4 cores with 2 SMT threads each (cpu N and N+4), L2 per core, two L3 domains {core 0, 2} and {core 1, 3}, core 3 isolated
+        const fs::path root = fs::temp_directory_path() / "gr4_qa_cpu_topology";
+        fs::remove_all(root);
+        const auto writeFile = [](const fs::path& path, std::string_view content) {
+            fs::create_directories(path.parent_path());
+            std::ofstream(path) << content << '\n';
+        };
+        writeFile(root / "online", "0-7");
+        writeFile(root / "isolated", "3,7");
+        for (std::size_t cpu = 0UZ; cpu < 8UZ; ++cpu) {
+            const std::size_t core    = cpu % 4UZ;
+            const fs::path    cpuPath = root / std::format("cpu{}", cpu);
+            writeFile(cpuPath / "topology" / "physical_package_id", "0");
+            writeFile(cpuPath / "topology" / "core_cpus_list", std::format("{},{}", core, core + 4UZ));
+            writeFile(cpuPath / "cache" / "index0" / "type", "Instruction");
+            writeFile(cpuPath / "cache" / "index0" / "level", "1");
+            writeFile(cpuPath / "cache" / "index0" / "shared_cpu_list", std::format("{},{}", core, core + 4UZ));
+            writeFile(cpuPath / "cache" / "index2" / "type", "Unified");
+            writeFile(cpuPath / "cache" / "index2" / "level", "2");
+            writeFile(cpuPath / "cache" / "index2" / "shared_cpu_list", std::format("{},{}", core, core + 4UZ));
+            writeFile(cpuPath / "cache" / "index3" / "type", "Unified");
+            writeFile(cpuPath / "cache" / "index3" / "level", "3");
+            writeFile(cpuPath / "cache" / "index3" / "shared_cpu_list", core % 2UZ == 0UZ ? "0,2,4,6" : "1,3,5,7");
+            fs::create_directories(cpuPath / "node0");
+        }
+
+        const CpuTopology topology = CpuTopology::read(root, std::vector<bool>(8UZ, true));
+        expect(eq(topology.cpus().size(), 8UZ));
+        expect(eq(topology.find(6UZ)->coreId, 2UZ));
+        expect(eq(topology.find(6UZ)->l3Domain, 0UZ));
+        expect(eq(topology.find(5UZ)->l3Domain, 1UZ));
+        expect(topology.find(7UZ)->isolated);
+        expect(topology.usableCpus() == std::vector<std::size_t>{0UZ, 4UZ, 2UZ, 6UZ, 1UZ, 5UZ}) << std::format("usable: {}", gr::join(topology.usableCpus(), ", "));
+        expect(topology.physicalCores() == std::vector<std::size_t>{0UZ, 2UZ, 1UZ}) << "cores sharing an L3 are neighbours, isolated core 3 is skipped";
+
+        const CpuPlacement placement = planPlacement(topology, 2UZ);
+        expect(placement.runnerCpus == std::vector<std::size_t>{0UZ, 2UZ});
+        expect(placement.ioMask == std::vector<bool>{false, true, false, false, false, true, false}) << "IO pool on the remaining core (cpu 1 and its SMT sibling 5)";
+
+        const CpuPlacement oversubscribed = planPlacement(topology, 4UZ);
+        expect(oversubscribed.runnerCpus == std::vector<std::size_t>{0UZ, 2UZ, 1UZ, 0UZ}) << "runners wrap around";
+        expect(oversubscribed.ioMask == std::vector<bool>{false, false, false, false, true, true, true}) << "IO pool on the SMT siblings";
+
+        // cgroup cpuset/taskset restricted to core 0 and 1
+        const CpuTopology restricted = CpuTopology::read(root, std::vector<bool>{true, true, false, false, true, true});
+        expect(restricted.physicalCores() == std::vector<std::size_t>{0UZ, 1UZ});
+        expect(planPlacement(restricted, 1UZ).ioMask == std::vector<bool>{false, true, false, false, false, true});
+
+        // process confined to isolated CPUs -> isolation is ignored
+        const CpuTopology confined = CpuTopology::read(root, std::vector<bool>{false, false, false, true});
+        expect(confined.physicalCores() == std::vector<std::size_t>{3UZ});
+        expect(planPlacement(confined, 1UZ).ioMask == std::vector<bool>{false, false, false, true}) << "nothing else left";
+
+        const CpuTopology fallback = CpuTopology::read(root / "does_not_exist", {});
+        expect(!fallback.cpus().empty()) << "falls back to hardware_concurrency()";
+        expect(eq(fallback.physicalCores().size(), fallback.cpus().size()));
+        fs::remove_all(root);
+
+        const CpuTopology system = CpuTopology::read();
+        expect(!system.physicalCores().empty());
+        expect(le(system.physicalCores().size(), system.usableCpus().size()));
+        expect(eq(planPlacement(system, 3UZ).runnerCpus.size(), 3UZ));
+    };
+
 #if not defined(__EMSCRIPTEN__) && not defined(__APPLE__)
     "basic thread affinity"_test = [] {
         using namespace gr::thread_pool;
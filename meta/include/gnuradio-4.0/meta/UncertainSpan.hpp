@@ -0,0 +1,377 @@
+#ifndef GNURADIO_UNCERTAINSPAN_HPP
+#define GNURADIO_UNCERTAINSPAN_HPP
+
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <numbers>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <vir/simd.h>
+
+#include <gnuradio-4.0/meta/UncertainValue.hpp>
+
+namespace gr {
+
+/**
+ * @brief Structure-of-arrays (SoA) view of a sequence of real-valued uncertain samples, i.e. the counterpart of
+ * 'std::span<UncertainValue<T>>' with the mean values and the uncertainties stored in two separate contiguous ranges.
+ *
+ * The batched kernels in 'gr::math' (add, subtract, multiply, divide, abs, sqrt, pow, sin, cos, exp, log, log10) operate on
+ * these views with one SIMD register per value and per uncertainty lane and implement the same (uncorrelated) propagation
+ * rules as the scalar 'UncertainValue<T>' operators. The output may alias any of the inputs (in-place operation).
+ *
+ * usage example:
+ * UncertainVector<float> a(n), b(n);
+ * gr::toSoA(std::span<const UncertainValue<float>>(input), a.span());
+ * gr::math::multiply(a.span(), b.span(), a.span()); // a *= b
+ * gr::toAoS(a.span(), std::span<UncertainValue<float>>(output));
+ */
+template<typename T>
+requires std::floating_point<std::remove_const_t<T>>
+struct UncertainSpan {
+    using value_type = std::remove_const_t<T>;
+
+    std::span<T> value{};       /// mean values
+    std::span<T> uncertainty{}; /// uncorrelated standard deviations
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept {
+        assert(value.size() == uncertainty.size());
+        return value.size();
+    }
+    [[nodiscard]] constexpr bool empty() const noexcept { return value.empty(); }
+
+    [[nodiscard]] constexpr UncertainSpan subspan(std::size_t offset, std::size_t count = std::dynamic_extent) const noexcept { return {value.subspan(offset, count), uncertainty.subspan(offset, count)}; }
+
+    [[nodiscard]] constexpr UncertainValue<value_type> operator[](std::size_t index) const noexcept { return {value[index], uncertainty[index]}; }
+
+    constexpr explicit(false) operator UncertainSpan<const value_type>() const noexcept
+    requires(!std::is_const_v<T>)
+    {
+        return {value, uncertainty};
+    }
+};
+
+/// owning SoA storage, e.g. for the scratch buffers of uncertainty-carrying blocks
+template<std::floating_point T>
+struct UncertainVector {
+    std::vector<T> value{};
+    std::vector<T> uncertainty{};
+
+    UncertainVector() = default;
+    explicit UncertainVector(std::size_t size) : value(size), uncertainty(size) {}
+
+    [[nodiscard]] std::size_t size() const noexcept { return value.size(); }
+    void                      resize(std::size_t size) {
+        value.resize(size);
+        uncertainty.resize(size);
+    }
+
+    [[nodiscard]] UncertainSpan<T>       span() noexcept { return {value, uncertainty}; }
+    [[nodiscard]] UncertainSpan<const T> span() const noexcept { return {value, uncertainty}; }
+};
+
+/// array-of-structs -> structure-of-arrays
+template<std::floating_point T>
+constexpr void toSoA(std::span<const UncertainValue<T>> input, UncertainSpan<T> output) noexcept {
+    assert(output.size() >= input.size());
+    for (std::size_t i = 0UZ; i < input.size(); ++i) {
+        output.value[i]       = input[i].value;
+        output.uncertainty[i] = input[i].uncertainty;
+    }
+}
+
+/// structure-of-arrays -> array-of-structs
+template<std::floating_point T>
+constexpr void toAoS(UncertainSpan<const std::type_identity_t<T>> input, std::span<UncertainValue<T>> output) noexcept {
+    assert(output.size() >= input.size());
+    for (std::size_t i = 0UZ; i < input.size(); ++i) {
+        output[i] = {input.value[i], input.uncertainty[i]};
+    }
+}
+
+namespace detail {
+// element-wise math for scalars and SIMD registers: 'std::experimental::simd' math overloads are found via ADL,
+// SIMD types without them (e.g. the vir-simd fallback implementation) are evaluated lane by lane
+template<typename V, typename Fn>
+[[nodiscard]] V lanewise(const V& x, Fn fn) noexcept {
+    if constexpr (std::floating_point<V>) {
+        return fn(x);
+    } else {
+        return V([&x, &fn](auto i) { return fn(x[i]); });
+    }
+}
+
+template<typename V>
+[[nodiscard]] V simdAbs(const V& x) noexcept {
+    if constexpr (std::floating_point<V>) {
+        return std::abs(x);
+    } else if constexpr (requires { abs(x); }) {
+        return abs(x);
+    } else {
+        return lanewise(x, [](auto v) { return std::abs(v); });
+    }
+}
+
+template<typename V>
+[[nodiscard]] V simdSqrt(const V& x) noexcept {
+    if constexpr (std::floating_point<V>) {
+        return std::sqrt(x);
+    } else if constexpr (requires { sqrt(x); }) {
+        return sqrt(x);
+    } else {
+        return lanewise(x, [](auto v) { return std::sqrt(v); });
+    }
+}
+
+template<typename V>
+[[nodiscard]] V simdHypot(const V& x, const V& y) noexcept {
+    if constexpr (std::floating_point<V>) {
+        return std::hypot(x, y);
+    } else if constexpr (requires { hypot(x, y); }) {
+        return hypot(x, y);
+    } else {
+        return V([&x, &y](auto i) { return std::hypot(x[i], y[i]); });
+    }
+}
+
+template<typename V, typename U>
+[[nodiscard]] V simdPow(const V& x, U exponent) noexcept {
+    if constexpr (std::floating_point<V>) {
+        return std::pow(x, exponent);
+    } else if constexpr (requires { pow(x, V(exponent)); }) {
+        return pow(x, V(exponent));
+    } else {
+        return lanewise(x, [exponent](auto v) { return std::pow(v, exponent); });
+    }
+}
+
+template<typename V>
+[[nodiscard]] V simdSin(const V& x) noexcept {
+    if constexpr (std::floating_point<V>) {
+        return std::sin(x);
+    } else if constexpr (requires { sin(x); }) {
+        return sin(x);
+    } else {
+        return lanewise(x, [](auto v) { return std::sin(v); });
+    }
+}
+
+template<typename V>
+[[nodiscard]] V simdCos(const V& x) noexcept {
+    if constexpr (std::floating_point<V>) {
+        return std::cos(x);
+    } else if constexpr (requires { cos(x); }) {
+        return cos(x);
+    } else {
+        return lanewise(x, [](auto v) { return std::cos(v); });
+    }
+}
+
+template<typename V>
+[[nodiscard]] V simdExp(const V& x) noexcept {
+    if constexpr (std::floating_point<V>) {
+        return std::exp(x);
+    } else if constexpr (requires { exp(x); }) {
+        return exp(x);
+    } else {
+        return lanewise(x, [](auto v) { return std::exp(v); });
+    }
+}
+
+template<typename V>
+[[nodiscard]] V simdLog(const V& x) noexcept {
+    if constexpr (std::floating_point<V>) {
+        return std::log(x);
+    } else if constexpr (requires { log(x); }) {
+        return log(x);
+    } else {
+        return lanewise(x, [](auto v) { return std::log(v); });
+    }
+}
+
+template<typename V>
+[[nodiscard]] V simdLog10(const V& x) noexcept {
+    if constexpr (std::floating_point<V>) {
+        return std::log10(x);
+    } else if constexpr (requires { log10(x); }) {
+        return log10(x);
+    } else {
+        return lanewise(x, [](auto v) { return std::log10(v); });
+    }
+}
+
+template<typename V, typename T>
+[[nodiscard]] V loadBatch(const T* data) noexcept {
+    if constexpr (std::floating_point<V>) {
+        return *data;
+    } else {
+        return V(data, vir::stdx::element_aligned);
+    }
+}
+
+template<typename V, typename T>
+void storeBatch(const V& x, T* data) noexcept {
+    if constexpr (std::floating_point<V>) {
+        *data = x;
+    } else {
+        x.copy_to(data, vir::stdx::element_aligned);
+    }
+}
+
+template<typename V>
+[[nodiscard]] V selectBatch(const auto& mask, const V& ifTrue, V ifFalse) noexcept {
+    if constexpr (std::floating_point<V>) {
+        return mask ? ifTrue : ifFalse;
+    } else {
+        vir::stdx::where(mask, ifFalse) = ifTrue;
+        return ifFalse;
+    }
+}
+
+/// applies 'fn.template operator()<V>(i)' to full SIMD registers and the scalar version to the remaining tail
+template<typename T, typename Fn>
+void forEachBatch(std::size_t nSamples, Fn&& fn) noexcept {
+    using V       = vir::stdx::native_simd<T>;
+    std::size_t i = 0UZ;
+    for (; i + V::size() <= nSamples; i += V::size()) {
+        fn.template operator()<V>(i);
+    }
+    for (; i < nSamples; ++i) {
+        fn.template operator()<T>(i);
+    }
+}
+
+template<typename T, typename Fn>
+void transformBatch(UncertainSpan<const T> x, UncertainSpan<T> out, Fn&& fn) noexcept {
+    assert(out.size() >= x.size());
+    forEachBatch<T>(x.size(), [&]<typename V>(std::size_t i) {
+        const auto [value, uncertainty] = fn(loadBatch<V>(x.value.data() + i), loadBatch<V>(x.uncertainty.data() + i));
+        storeBatch(value, out.value.data() + i);
+        storeBatch(uncertainty, out.uncertainty.data() + i);
+    });
+}
+
+template<typename T, typename Fn>
+void transformBatch(UncertainSpan<const T> lhs, UncertainSpan<const T> rhs, UncertainSpan<T> out, Fn&& fn) noexcept {
+    assert(lhs.size() == rhs.size() && out.size() >= lhs.size());
+    forEachBatch<T>(lhs.size(), [&]<typename V>(std::size_t i) {
+        const auto [value, uncertainty] = fn(loadBatch<V>(lhs.value.data() + i), loadBatch<V>(lhs.uncertainty.data() + i), loadBatch<V>(rhs.value.data() + i), loadBatch<V>(rhs.uncertainty.data() + i));
+        storeBatch(value, out.value.data() + i);
+        storeBatch(uncertainty, out.uncertainty.data() + i);
+    });
+}
+
+template<typename V>
+struct UncertainBatch {
+    V value;
+    V uncertainty;
+};
+template<typename V>
+UncertainBatch(V, V) -> UncertainBatch<V>;
+} // namespace detail
+
+} // namespace gr
+
+namespace gr::math {
+
+/********************** batched (SoA) versions of the UncertainValue<T> operators and functions *********************************/
+
+template<std::floating_point T>
+void add(UncertainSpan<const std::type_identity_t<T>> lhs, UncertainSpan<const std::type_identity_t<T>> rhs, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(lhs, rhs, out, []<typename V>(const V& a, const V& ua, const V& b, const V& ub) { return gr::detail::UncertainBatch{a + b, gr::detail::simdHypot(ua, ub)}; });
+}
+
+template<std::floating_point T>
+void add(UncertainSpan<const std::type_identity_t<T>> lhs, std::type_identity_t<T> rhs, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(lhs, out, [rhs]<typename V>(const V& a, const V& ua) { return gr::detail::UncertainBatch{a + V(rhs), ua}; });
+}
+
+template<std::floating_point T>
+void subtract(UncertainSpan<const std::type_identity_t<T>> lhs, UncertainSpan<const std::type_identity_t<T>> rhs, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(lhs, rhs, out, []<typename V>(const V& a, const V& ua, const V& b, const V& ub) { return gr::detail::UncertainBatch{a - b, gr::detail::simdHypot(ua, ub)}; });
+}
+
+template<std::floating_point T>
+void subtract(UncertainSpan<const std::type_identity_t<T>> lhs, std::type_identity_t<T> rhs, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(lhs, out, [rhs]<typename V>(const V& a, const V& ua) { return gr::detail::UncertainBatch{a - V(rhs), ua}; });
+}
+
+template<std::floating_point T>
+void multiply(UncertainSpan<const std::type_identity_t<T>> lhs, UncertainSpan<const std::type_identity_t<T>> rhs, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(lhs, rhs, out, []<typename V>(const V& a, const V& ua, const V& b, const V& ub) { return gr::detail::UncertainBatch{a * b, gr::detail::simdHypot(a * ub, b * ua)}; });
+}
+
+template<std::floating_point T>
+void multiply(UncertainSpan<const std::type_identity_t<T>> lhs, std::type_identity_t<T> rhs, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(lhs, out, [rhs]<typename V>(const V& a, const V& ua) { return gr::detail::UncertainBatch{a * V(rhs), ua * V(rhs)}; });
+}
+
+template<std::floating_point T>
+void divide(UncertainSpan<const std::type_identity_t<T>> lhs, UncertainSpan<const std::type_identity_t<T>> rhs, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(lhs, rhs, out, []<typename V>(const V& a, const V& ua, const V& b, const V& ub) { return gr::detail::UncertainBatch{a / b, gr::detail::simdHypot(ua / b, ub * a / (b * b))}; });
+}
+
+template<std::floating_point T>
+void divide(UncertainSpan<const std::type_identity_t<T>> lhs, std::type_identity_t<T> rhs, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(lhs, out, [rhs]<typename V>(const V& a, const V& ua) { return gr::detail::UncertainBatch{a / V(rhs), ua / V(std::abs(rhs))}; });
+}
+
+template<std::floating_point T>
+void abs(UncertainSpan<const std::type_identity_t<T>> x, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(x, out, []<typename V>(const V& a, const V& ua) { return gr::detail::UncertainBatch{gr::detail::simdAbs(a), ua}; });
+}
+
+/// N.B. zero base: x^0 -> {1, 0}, otherwise {0, 0} (cf. scalar 'gr::math::pow')
+template<std::floating_point T>
+void pow(UncertainSpan<const std::type_identity_t<T>> base, std::type_identity_t<T> exponent, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(base, out, [exponent]<typename V>(const V& a, const V& ua) {
+        const V value       = gr::detail::simdPow(a, exponent);
+        const V uncertainty = gr::detail::simdAbs(value * V(exponent) * ua / a);
+        const V zero(T(0));
+        return gr::detail::UncertainBatch{gr::detail::selectBatch(a == zero, V(exponent == T(0) ? T(1) : T(0)), value), gr::detail::selectBatch(a == zero, zero, uncertainty)};
+    });
+}
+
+template<std::floating_point T>
+void sqrt(UncertainSpan<const std::type_identity_t<T>> x, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(x, out, []<typename V>(const V& a, const V& ua) {
+        const V value = gr::detail::simdSqrt(a);
+        const V zero(T(0));
+        return gr::detail::UncertainBatch{value, gr::detail::selectBatch(a == zero, zero, gr::detail::simdAbs(V(T(0.5)) * ua / value))}; // d/dx sqrt(x) = 1/(2·sqrt(x))
+    });
+}
+
+template<std::floating_point T>
+void sin(UncertainSpan<const std::type_identity_t<T>> x, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(x, out, []<typename V>(const V& a, const V& ua) { return gr::detail::UncertainBatch{gr::detail::simdSin(a), gr::detail::simdAbs(gr::detail::simdCos(a) * ua)}; });
+}
+
+template<std::floating_point T>
+void cos(UncertainSpan<const std::type_identity_t<T>> x, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(x, out, []<typename V>(const V& a, const V& ua) { return gr::detail::UncertainBatch{gr::detail::simdCos(a), gr::detail::simdAbs(gr::detail::simdSin(a) * ua)}; });
+}
+
+template<std::floating_point T>
+void exp(UncertainSpan<const std::type_identity_t<T>> x, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(x, out, []<typename V>(const V& a, const V& ua) {
+        const V value = gr::detail::simdExp(a);
+        return gr::detail::UncertainBatch{value, gr::detail::simdAbs(value * ua)};
+    });
+}
+
+template<std::floating_point T>
+void log(UncertainSpan<const std::type_identity_t<T>> x, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(x, out, []<typename V>(const V& a, const V& ua) { return gr::detail::UncertainBatch{gr::detail::simdLog(a), gr::detail::simdAbs(ua / a)}; });
+}
+
+template<std::floating_point T>
+void log10(UncertainSpan<const std::type_identity_t<T>> x, UncertainSpan<T> out) noexcept {
+    gr::detail::transformBatch<T>(x, out, []<typename V>(const V& a, const V& ua) { return gr::detail::UncertainBatch{gr::detail::simdLog10(a), gr::detail::simdAbs(ua / (a * V(std::numbers::ln10_v<T>)))}; });
+}
+
+} // namespace gr::math
+
+#endif // GNURADIO_UNCERTAINSPAN_HPP
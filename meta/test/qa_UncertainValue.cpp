@@ -2,6 +2,7 @@
 
 #include <complex>
 
+#include <gnuradio-4.0/meta/UncertainSpan.hpp>
 #include <gnuradio-4.0/meta/UncertainValue.hpp>
 
 #include <gnuradio-4.0/meta/formatter.hpp>
@@ -872,4 +873,91 @@ const boost::ut::suite<"UncertainValue<T> - additional tests"> _additionalTests
     } | std::tuple<float, double, gr::UncertainValue<float>, gr::UncertainValue<double>>{};
 };
 
+const boost::ut::suite<"batched (SoA) UncertainValue<T> kernels"> _uncertainSpan = [] {
+    using namespace boost::ut;
+    using namespace gr;
+
+    "SoA kernels vs. scalar UncertainValue operators"_test = []<typename T>(const T&) {
+        constexpr std::size_t nSamples  = 67UZ; // N.B. full SIMD registers + scalar tail
+        const T               tolerance = std::is_same_v<T, float> ? T(1e-5f) : T(1e-12);
+
+        std::vector<UncertainValue<T>> a(nSamples);
+        std::vector<UncertainValue<T>> b(nSamples);
+        for (std::size_t i = 0UZ; i < nSamples; ++i) {
+            a[i] = {T(0.5) + T(0.1) * static_cast<T>(i % 13UZ), T(0.01) * static_cast<T>(i % 7UZ + 1UZ)};
+            b[i] = {T(2) - T(0.05) * static_cast<T>(i % 11UZ), T(0.02) * static_cast<T>(i % 5UZ + 1UZ)};
+        }
+        a[3].value = T(0); // zero base for sqrt/pow
+
+        UncertainVector<T> lhs(nSamples);
+        UncertainVector<T> rhs(nSamples);
+        UncertainVector<T> result(nSamples);
+        toSoA<T>(a, lhs.span());
+        toSoA<T>(b, rhs.span());
+
+        const auto check = [&](std::string_view name, auto&& expected) {
+            std::vector<UncertainValue<T>> actual(nSamples);
+            toAoS<T>(result.span(), actual);
+            for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                const UncertainValue<T> ref   = expected(a[i], b[i]);
+                const T                 scale = std::max(T(1), std::abs(ref.value));
+                expect(approx(actual[i].value, ref.value, tolerance * scale) && approx(actual[i].uncertainty, ref.uncertainty, tolerance * scale)) //
+                    << std::format("{}[{}]: {} vs. expected {}", name, i, actual[i], ref);
+            }
+        };
+
+        math::add<T>(lhs.span(), rhs.span(), result.span());
+        check("add", [](auto x, auto y) { return x + y; });
+        math::add<T>(lhs.span(), T(2), result.span());
+        check("add scalar", [](auto x, auto) { return x + T(2); });
+        math::subtract<T>(lhs.span(), rhs.span(), result.span());
+        check("subtract", [](auto x, auto y) { return x - y; });
+        math::subtract<T>(lhs.span(), T(2), result.span());
+        check("subtract scalar", [](auto x, auto) { return x - T(2); });
+        math::multiply<T>(lhs.span(), rhs.span(), result.span());
+        check("multiply", [](auto x, auto y) { return x * y; });
+        math::multiply<T>(lhs.span(), T(-3), result.span());
+        check("multiply scalar", [](auto x, auto) { return x * T(-3); });
+        math::divide<T>(lhs.span(), rhs.span(), result.span());
+        check("divide", [](auto x, auto y) { return x / y; });
+        math::divide<T>(lhs.span(), T(-4), result.span());
+        check("divide scalar", [](auto x, auto) { return x / T(-4); });
+        math::abs<T>(lhs.span(), result.span());
+        check("abs", [](auto x, auto) { return math::abs(x); });
+        math::sqrt<T>(lhs.span(), result.span());
+        check("sqrt", [](auto x, auto) { return math::sqrt(x); });
+        math::pow<T>(lhs.span(), T(2.5), result.span());
+        check("pow", [](auto x, auto) { return math::pow(x, T(2.5)); });
+        math::pow<T>(lhs.span(), T(0), result.span());
+        check("pow 0", [](auto x, auto) { return math::pow(x, T(0)); });
+        math::sin<T>(lhs.span(), result.span());
+        check("sin", [](auto x, auto) { return math::sin(x); });
+        math::cos<T>(lhs.span(), result.span());
+        check("cos", [](auto x, auto) { return math::cos(x); });
+        math::exp<T>(lhs.span(), result.span());
+        check("exp", [](auto x, auto) { return math::exp(x); });
+        math::log<T>(rhs.span(), result.span());
+        check("log", [](auto, auto y) { return math::log(y); });
+        math::log10<T>(rhs.span(), result.span());
+        check("log10", [](auto, auto y) { return math::log10(y); });
+
+        std::ranges::copy(lhs.value, result.value.begin()); // in-place: result *= rhs
+        std::ranges::copy(lhs.uncertainty, result.uncertainty.begin());
+        math::multiply<T>(result.span(), rhs.span(), result.span());
+        check("multiply in-place", [](auto x, auto y) { return x * y; });
+    } | std::tuple<float, double>{};
+
+    "UncertainSpan accessors"_test = [] {
+        UncertainVector<double> buffer(4UZ);
+        expect(eq(buffer.size(), 4UZ));
+        UncertainSpan<double> view = buffer.span();
+        view.value[2]              = 3.0;
+        view.uncertainty[2]        = 0.5;
+        expect(eq(view.subspan(2UZ).size(), 2UZ));
+        expect(view.subspan(2UZ)[0] == UncertainValue<double>{3.0, 0.5});
+        const UncertainSpan<const double> constView = view;
+        expect(eq(constView[2].uncertainty, 0.5));
+    };
+};
+
 int main() { /* tests are statically executed */ }